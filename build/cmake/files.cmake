@@ -546,6 +546,7 @@ set(BASE_CMN_HDR
     wx/hash.h
     wx/hashmap.h
     wx/hashset.h
+    wx/flathashmap.h
     wx/iconloc.h
     wx/init.h
     wx/intl.h
@@ -639,10 +639,13 @@ Related Overviews: @ref overview_container
 
 @li wxArray<T>: A legacy dynamic array, use std::vector or wxVector instead.
 @li wxArrayString: An efficient container for storing wxString objects
+@li wxFlatHashMap<K,T>: A hash map using open addressing
+@li wxFlatHashSet<K>: A hash set using open addressing
 @li wxHashMap<T>: A type-safe hash map implementation (macro based)
 @li wxHashSet<T>: A type-safe hash set implementation(macro based)
 @li wxHashTable: A simple hash table implementation (deprecated, use wxHashMap)
 @li wxList<T>: A type-safe linked list implementation (macro based)
+@li wxStringSearchIndex: An index for finding strings by prefix or substring
 @li wxVector<T>: A template-based vector implementation identical to std::vector
 
 
@@ -50,6 +50,16 @@ int wxCMPFUNC_CONV wxCmpNatural(const wxString& s1, const wxString& s2);
 WXDLLIMPEXP_BASE
 int wxCMPFUNC_CONV wxCmpNaturalGeneric(const wxString& s1, const wxString& s2);
 
+// Return the key such that comparing the keys of two strings byte by byte
+// gives the same result as wxCmpNaturalGeneric() for these strings.
+WXDLLIMPEXP_BASE std::string wxGetNaturalSortKey(const wxString& s);
+
+// wxCmpNatural() is the same as wxCmpNaturalGeneric() unless it's natively
+// implemented, in which case wxGetNaturalSortKey() can't be used with it.
+#if !(defined(__WINDOWS__) || defined(__DARWIN__))
+    #define wxHAS_GENERIC_CMP_NATURAL
+#endif
+
 inline int wxCMPFUNC_CONV wxNaturalStringSortAscending(const wxString& s1, const wxString& s2)
 {
     return wxCmpNatural(s1, s2);
@@ -123,14 +133,7 @@ class WXDLLIMPEXP_BASE wxSortedArrayString : public wxSortedArrayStringBase
 public:
     wxSortedArrayString() : wxSortedArrayStringBase(wxStringSortAscending)
         { }
-    wxSortedArrayString(const wxArrayString& src)
-        : wxSortedArrayStringBase(wxStringSortAscending)
-    {
-        reserve(src.size());
-
-        for ( size_t n = 0; n < src.size(); n++ )
-            Add(src[n]);
-    }
+    wxSortedArrayString(const wxArrayString& src);
     explicit wxSortedArrayString(wxArrayString::CompareFunction compareFunction)
         : wxSortedArrayStringBase(compareFunction)
         { }
@@ -489,6 +492,62 @@ WXDLLIMPEXP_BASE wxArrayString wxSplit(const wxString& str,
                                        const wxChar escape = wxT('\\'));
 
 
+// ----------------------------------------------------------------------------
+// wxStringSearchIndex: allows to quickly find all strings with the given
+// prefix or containing the given substring in a fixed array of strings.
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxStringSearchIndex
+{
+public:
+    wxStringSearchIndex() = default;
+
+    explicit wxStringSearchIndex(const wxArrayString& strings,
+                                 bool caseSensitive = true)
+    {
+        Set(strings, caseSensitive);
+    }
+
+    // (Re)build the index for the given strings.
+    void Set(const wxArrayString& strings, bool caseSensitive = true);
+
+    size_t GetCount() const { return m_strings.size(); }
+    const wxString& GetString(size_t n) const { return m_strings[n]; }
+    const wxArrayString& GetStrings() const { return m_strings; }
+
+    // Return the indices of all strings starting with the given prefix or
+    // containing the given substring, in increasing order.
+    std::vector<size_t> FindPrefix(const wxString& prefix) const;
+    std::vector<size_t> FindSubstring(const wxString& substring) const;
+
+private:
+    // Return the string used for comparisons: either the string itself or its
+    // lower case version.
+    const wxString& GetKey(size_t n) const
+    {
+        return m_caseSensitive ? m_strings[n] : m_keys[n];
+    }
+
+    wxString MakeKey(const wxString& s) const
+    {
+        return m_caseSensitive ? s : s.Lower();
+    }
+
+    wxArrayString m_strings;
+
+    // Lower case versions of the strings, only used if not case sensitive.
+    std::vector<wxString> m_keys;
+
+    // Indices of the strings sorted in the keys order.
+    std::vector<size_t> m_sorted;
+
+    // Bit masks of the characters present in each key, used to quickly skip
+    // the keys which can't contain the substring being searched for.
+    std::vector<wxUint64> m_charMasks;
+
+    bool m_caseSensitive = true;
+};
+
 // ----------------------------------------------------------------------------
 // This helper class allows to pass both C array of wxStrings or wxArrayString
 // using the same interface.
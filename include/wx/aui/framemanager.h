@@ -26,6 +26,8 @@
 #include "wx/bmpbndl.h"
 #include "wx/overlay.h"
 
+#include <vector>
+
 enum wxAuiManagerDock
 {
     wxAUI_DOCK_NONE = 0,
@@ -615,6 +617,9 @@ protected:
     /// Ends a resize action, or for live update, resizes the sash
     bool DoEndResizeAction(wxMouseEvent& event);
 
+    /// Updates the layout after changing the size of the dock or its panes
+    void UpdateDockLayout(wxAuiDockInfo& dock);
+
     void SetActivePane(wxWindow* active_pane);
 
 public:
@@ -733,6 +738,12 @@ private:
     // use GetMinDockInDirection() instead to not have to remember this -1.
     wxAuiMinDock* m_minDocks[wxAUI_DOCK_LEFT] = { nullptr };
 
+    // Values determining the layout used for the last hint rectangle computed
+    // by CalculateHintRect() (empty if none) and this rectangle itself, in
+    // client coordinates.
+    std::vector<int> m_hintLayoutKey;
+    wxRect m_hintLayoutRect;
+
     // Mask of directions where we are allowed to create docks for minimized
     // panes.
     int m_minDockAllowed = wxLEFT | wxRIGHT | wxBOTTOM;
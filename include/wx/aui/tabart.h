@@ -29,6 +29,7 @@
 
 #include "wx/aui/framemanager.h" // wxAuiPaneButtonState and wxAuiButtonId
 
+#include <unordered_map>
 #include <vector>
 
 class wxAuiNotebookPage;
@@ -243,6 +244,14 @@ protected:
                  wxRect* outRect,
                  wxBitmap* outBitmap = nullptr);
 
+    // Return the extent of the given text when using the measuring font.
+    //
+    // The results are cached, as the same captions are measured very often,
+    // e.g. for all tabs whenever the tab control is repainted or laid out.
+    wxSize GetMeasuringTextExtent(wxReadOnlyDC& dc,
+                                  wxWindow* wnd,
+                                  const wxString& text);
+
 
     // Note: all these fields are protected for compatibility reasons, but
     // shouldn't be accessed directly.
@@ -284,6 +293,12 @@ private:
                      const wxRect& rect,
                      const wxBitmap& bmp,
                      int buttonState);
+
+    // Cache used by GetMeasuringTextExtent(), only valid for the font and
+    // DPI stored here.
+    std::unordered_map<wxString, wxSize> m_textExtents;
+    wxFont m_textExtentsFont;
+    wxSize m_textExtentsDPI;
 };
 
 // This tab art provider draws flat tabs with a thin border.
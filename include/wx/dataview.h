@@ -272,6 +272,15 @@ public:
                          unsigned int column, bool ascending ) const;
     virtual bool HasDefaultCompare() const { return false; }
 
+    // Override to return true if Compare() is not overridden, i.e. the items
+    // are compared by their values only, allowing the control to retrieve
+    // every value just once when sorting.
+    virtual bool UsesDefaultCompare() const { return false; }
+
+    // compare the values as the default Compare() does, returning 0 if they
+    // are equal
+    int CompareValues(const wxVariant& value1, const wxVariant& value2) const;
+
     // internal
     virtual bool IsListModel() const { return false; }
     virtual bool IsVirtualListModel() const { return false; }
@@ -1128,6 +1137,9 @@ public:
     virtual bool SetValueByRow( const wxVariant &value,
                            unsigned int row, unsigned int col ) override;
 
+    // we don't override Compare(), so the items can be sorted by their values
+    virtual bool UsesDefaultCompare() const override { return true; }
+
 
 public:
     wxVector<wxDataViewListStoreLine*> m_data;
@@ -1559,6 +1559,132 @@ private:
 
 using wxDateTimeArray = wxBaseArray<wxDateTime>;
 
+// ----------------------------------------------------------------------------
+// wxDateTimeFormatter: formats many dates using the same format string
+// ----------------------------------------------------------------------------
+
+// The format string is analysed only once, when this object is created, and
+// the localized month and week day names and AM/PM strings are cached, so
+// creating a new object is required if the current locale changes.
+//
+// The results are always the same as those of wxDateTime::Format() with the
+// same format.
+class WXDLLIMPEXP_BASE wxDateTimeFormatter
+{
+public:
+    explicit
+    wxDateTimeFormatter(const wxString& format = wxASCII_STR(wxDefaultDateTimeFormat));
+
+    // format the date into the provided buffer, which is always NUL-terminated
+    // if size is not 0, and return the length of the full result: if it is
+    // greater or equal to size, the result was truncated
+    size_t Format(const wxDateTime& dt,
+                  wxChar *buf,
+                  size_t size,
+                  const wxDateTime::TimeZone& tz = wxDateTime::Local) const;
+
+    // append the formatted date to the given string
+    void FormatTo(wxString& str,
+                  const wxDateTime& dt,
+                  const wxDateTime::TimeZone& tz = wxDateTime::Local) const;
+
+    // return the formatted date
+    wxString Format(const wxDateTime& dt,
+                    const wxDateTime::TimeZone& tz = wxDateTime::Local) const
+    {
+        wxString str;
+        FormatTo(str, dt, tz);
+        return str;
+    }
+
+private:
+    // a single element of the format string
+    struct Item
+    {
+        enum Type
+        {
+            Literal,    // text is output as is
+            Number,     // numeric field spec zero-padded to width
+            WeekDay,    // week day name, abbreviated if width is 1
+            Month,      // month name, abbreviated if width is 1
+            AmPm,       // AM or PM string
+            Fallback    // text is passed to wxDateTime::Format()
+        };
+
+        Type type;
+        wxChar spec;
+        int width;
+        wxString text;
+    };
+
+    template <typename T> void DoFormat(T& out,
+                                        const wxDateTime& dt,
+                                        const wxDateTime::TimeZone& tz) const;
+
+    std::vector<Item> m_items;
+
+    // the cached names, only initialized if they're used
+    wxString m_weekDayNames[2][7];
+    wxString m_monthNames[2][12];
+    wxString m_amPm[2];
+};
+
+// ----------------------------------------------------------------------------
+// wxDateTimeParser: parses many dates using the same format string
+// ----------------------------------------------------------------------------
+
+// This is similar to wxDateTimeFormatter, but for wxDateTime::ParseFormat().
+class WXDLLIMPEXP_BASE wxDateTimeParser
+{
+public:
+    explicit
+    wxDateTimeParser(const wxString& format = wxASCII_STR(wxDefaultDateTimeFormat));
+
+    // parse the date in the same way as wxDateTime::ParseFormat() does
+    //
+    // if end is null, the entire string must be parsed for the function to
+    // succeed, otherwise it is filled with the end of the parsed part
+    bool Parse(const wxString& date,
+               wxDateTime& dt,
+               const wxDateTime& dateDef = wxDefaultDateTime,
+               wxString::const_iterator *end = nullptr) const;
+
+private:
+    // a single element of the format string
+    struct Item
+    {
+        enum Type
+        {
+            Literal,    // character spec must be matched as is
+            Space,      // any number of spaces
+            Number,     // numeric field spec of at most width digits
+            WeekDay,    // week day name, abbreviated if width is 1
+            Month,      // month name, abbreviated if width is 1
+            AmPm        // AM or PM string
+        };
+
+        Type type;
+        wxChar spec;
+        int width;
+    };
+
+    // the original format, used if we can't parse it ourselves
+    wxString m_format;
+
+    // the items of the format or empty if it contains anything not
+    // supported by it and m_format must be used
+    std::vector<Item> m_items;
+
+    // the cached names, only initialized if they're used: notice that the
+    // trailing period of the abbreviated month names, if any, is removed
+    // and stored separately, as it's not part of the alphabetic token
+    wxString m_weekDayNames[2][7];
+    wxString m_monthNames[2][12];
+    bool m_monthAbbrHasPeriod[12];
+    wxString m_am,
+             m_pm;
+};
+
 // ----------------------------------------------------------------------------
 // wxDateTimeHolidayAuthority: an object of this class will decide whether a
 // given date is a holiday and is used by all functions working with "work
@@ -0,0 +1,698 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/flathashmap.h
+// Purpose:     wxFlatHashMap and wxFlatHashSet classes
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_FLATHASHMAP_H_
+#define _WX_FLATHASHMAP_H_
+
+#include "wx/hashmap.h"
+#include "wx/except.h"
+
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+// wxFlatHashTable: open addressing hash table used by the classes below
+// ----------------------------------------------------------------------------
+
+// This is a Robin Hood hash table storing the elements directly in a single
+// array, without allocating a node per element, and using linear probing.
+//
+// Each slot has an associated "distance": 0 for empty slots or 1 + distance
+// from the slot the element would ideally be stored in ("home" slot) for the
+// occupied ones. The elements of each cluster are kept sorted by their home
+// slots, which allows to stop searching as soon as a slot with a smaller
+// distance is found and to remove the elements by shifting the subsequent
+// ones back, without using tombstones.
+//
+// The probe sequence never wraps around: the array contains m_maxDist extra
+// slots after the m_buckets ones that can be home slots and no element can
+// be stored further than m_maxDist from its home slot. This ensures that
+// erasing an element never moves an already visited element in front of the
+// iterator and so erase() can be used while iterating over the table.
+//
+// KeyOf must provide a static Get() function returning the key of the value.
+template <typename Value, typename Key, typename KeyOf,
+          typename Hash, typename KeyEqual>
+class wxFlatHashTable
+{
+public:
+    typedef Key key_type;
+    typedef Value value_type;
+    typedef Hash hasher;
+    typedef KeyEqual key_equal;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+
+private:
+    // T is either value_type or const value_type.
+    template <typename T>
+    class IteratorImpl
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename wxFlatHashTable::value_type value_type;
+        typedef ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+        IteratorImpl() : m_table(nullptr), m_pos(0) { }
+
+        // Allow converting iterator to const_iterator, but not vice versa.
+        template <typename U>
+        IteratorImpl(const IteratorImpl<U>& it,
+                     typename std::enable_if<
+                        std::is_same<T, const U>::value, int>::type = 0)
+            : m_table(it.m_table), m_pos(it.m_pos) { }
+
+        reference operator*() const { return m_table->m_slots[m_pos]; }
+        pointer operator->() const { return &m_table->m_slots[m_pos]; }
+
+        IteratorImpl& operator++()
+        {
+            m_pos = m_table->FindOccupied(m_pos + 1);
+            return *this;
+        }
+
+        IteratorImpl operator++(int)
+        {
+            IteratorImpl it = *this;
+            ++*this;
+            return it;
+        }
+
+        bool operator==(const IteratorImpl& other) const
+            { return m_pos == other.m_pos && m_table == other.m_table; }
+        bool operator!=(const IteratorImpl& other) const
+            { return !(*this == other); }
+
+    private:
+        IteratorImpl(const wxFlatHashTable* table, size_t pos)
+            : m_table(table), m_pos(pos) { }
+
+        const wxFlatHashTable* m_table;
+        size_t m_pos;
+
+        friend class wxFlatHashTable;
+        template <typename U> friend class IteratorImpl;
+    };
+
+public:
+    typedef IteratorImpl<value_type> iterator;
+    typedef IteratorImpl<const value_type> const_iterator;
+
+    explicit wxFlatHashTable(size_type n = 0,
+                             const hasher& hf = hasher(),
+                             const key_equal& eq = key_equal())
+        : m_hasher(hf),
+          m_equal(eq)
+    {
+        Init();
+
+        if ( n )
+            reserve(n);
+    }
+
+    wxFlatHashTable(const wxFlatHashTable& other)
+        : m_hasher(other.m_hasher),
+          m_equal(other.m_equal)
+    {
+        Init();
+
+        CopyFrom(other);
+    }
+
+    wxFlatHashTable(wxFlatHashTable&& other) noexcept
+        : m_hasher(other.m_hasher),
+          m_equal(other.m_equal)
+    {
+        Init();
+
+        swap(other);
+    }
+
+    wxFlatHashTable& operator=(const wxFlatHashTable& other)
+    {
+        if ( &other != this )
+        {
+            Free();
+            Init();
+
+            m_hasher = other.m_hasher;
+            m_equal = other.m_equal;
+
+            CopyFrom(other);
+        }
+
+        return *this;
+    }
+
+    wxFlatHashTable& operator=(wxFlatHashTable&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~wxFlatHashTable()
+    {
+        Free();
+    }
+
+    void swap(wxFlatHashTable& other) noexcept
+    {
+        std::swap(m_slots, other.m_slots);
+        std::swap(m_dists, other.m_dists);
+        std::swap(m_buckets, other.m_buckets);
+        std::swap(m_maxDist, other.m_maxDist);
+        std::swap(m_shift, other.m_shift);
+        std::swap(m_size, other.m_size);
+        std::swap(m_hasher, other.m_hasher);
+        std::swap(m_equal, other.m_equal);
+    }
+
+    hasher hash_function() const { return m_hasher; }
+    key_equal key_eq() const { return m_equal; }
+
+    size_type size() const { return m_size; }
+    size_type max_size() const { return size_type(-1) / sizeof(value_type); }
+    bool empty() const { return m_size == 0; }
+    size_type bucket_count() const { return m_buckets; }
+
+    iterator begin() { return iterator(this, FindOccupied(0)); }
+    iterator end() { return iterator(this, GetSlotCount()); }
+    const_iterator begin() const { return const_iterator(this, FindOccupied(0)); }
+    const_iterator end() const { return const_iterator(this, GetSlotCount()); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    // Removes all elements but keeps the memory allocated for them.
+    void clear()
+    {
+        const size_t count = GetSlotCount();
+        for ( size_t pos = 0; pos < count; ++pos )
+        {
+            if ( m_dists[pos] )
+            {
+                m_slots[pos].~value_type();
+                m_dists[pos] = 0;
+            }
+        }
+
+        m_size = 0;
+    }
+
+    // Ensures that at least n elements can be stored without reallocating.
+    void reserve(size_type n)
+    {
+        size_t buckets = MIN_BUCKETS;
+        while ( !CanStore(buckets, n) )
+            buckets *= 2;
+
+        if ( buckets > m_buckets )
+            Rehash(buckets, m_maxDist);
+    }
+
+    iterator find(const key_type& key)
+        { return iterator(this, FindIndex(key)); }
+    const_iterator find(const key_type& key) const
+        { return const_iterator(this, FindIndex(key)); }
+
+    size_type count(const key_type& key) const
+        { return FindIndex(key) != GetSlotCount() ? 1 : 0; }
+
+    bool contains(const key_type& key) const
+        { return count(key) != 0; }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return DoInsert(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return DoInsert(std::move(value));
+    }
+
+    template <typename InputIterator>
+    void insert(InputIterator first, InputIterator last)
+    {
+        for ( ; first != last; ++first )
+            insert(*first);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return DoInsert(value_type(std::forward<Args>(args)...));
+    }
+
+    // Returns the iterator to the element following the erased one.
+    iterator erase(const_iterator it)
+    {
+        DoErase(it.m_pos);
+
+        // The next element, if any, was shifted into this slot.
+        return iterator(this, FindOccupied(it.m_pos));
+    }
+
+    iterator erase(iterator it)
+    {
+        return erase(const_iterator(it));
+    }
+
+    size_type erase(const key_type& key)
+    {
+        const size_t pos = FindIndex(key);
+        if ( pos == GetSlotCount() )
+            return 0;
+
+        DoErase(pos);
+
+        return 1;
+    }
+
+protected:
+    // Returns the total number of slots, which is also used as invalid index.
+    size_t GetSlotCount() const { return m_buckets + m_maxDist; }
+
+    value_type& GetValueAt(size_t pos) const { return m_slots[pos]; }
+
+    // Returns the hash value used by this class, which is the value returned
+    // by the hash function with its bits spread out using Fibonacci hashing,
+    // as the hash functions for integers and pointers are identity.
+    wxUint64 GetHash(const key_type& key) const
+    {
+        return static_cast<wxUint64>(m_hasher(key)) * wxULL(0x9e3779b97f4a7c15);
+    }
+
+    // Returns the index of the slot containing the element with the given key
+    // or GetSlotCount() if there is none.
+    size_t FindIndex(const key_type& key) const
+    {
+        return m_size ? FindIndex(key, GetHash(key)) : GetSlotCount();
+    }
+
+    // Same as above, but takes the hash of the key returned by GetHash().
+    size_t FindIndex(const key_type& key, wxUint64 hash) const
+    {
+        if ( !m_size )
+            return GetSlotCount();
+
+        size_t pos = GetHomeSlot(hash);
+        for ( size_t dist = 1; ; ++pos, ++dist )
+        {
+            // As all distances are <= m_maxDist, this always stops at most at
+            // the last slot.
+            const size_t posDist = m_dists[pos];
+            if ( posDist < dist )
+                return GetSlotCount();
+
+            if ( posDist == dist && m_equal(KeyOf::Get(m_slots[pos]), key) )
+                return pos;
+        }
+    }
+
+    // Inserts the value if it's not present yet and returns the iterator to
+    // it and the flag indicating whether it was inserted.
+    template <typename V>
+    std::pair<iterator, bool> DoInsert(V&& value)
+    {
+        const wxUint64 hash = GetHash(KeyOf::Get(value));
+        size_t pos = FindIndex(KeyOf::Get(value), hash);
+        if ( pos != GetSlotCount() )
+            return std::make_pair(iterator(this, pos), false);
+
+        pos = InsertNew(std::forward<V>(value), hash);
+        return std::make_pair(iterator(this, pos), true);
+    }
+
+    // Inserts the value which must not be present in the table yet and
+    // returns the index of the slot it was stored in. The hash must be the
+    // value returned by GetHash() for its key.
+    template <typename V>
+    size_t InsertNew(V&& value, wxUint64 hash)
+    {
+        if ( !CanStore(m_buckets, m_size + 1) )
+            Rehash(m_buckets ? m_buckets * 2 : MIN_BUCKETS, m_maxDist);
+
+        for ( ;; )
+        {
+            const size_t pos = TryInsert(std::forward<V>(value), hash);
+            if ( pos != GetSlotCount() )
+                return pos;
+
+            // The value didn't fit: if the table is reasonably full, it's
+            // because of normal clustering, so just make it bigger, but if it
+            // isn't, the hash function must be bad and we need to allow the
+            // elements to be stored further from their home slots.
+            if ( m_size >= m_buckets / 2 )
+                Rehash(m_buckets * 2, m_maxDist);
+            else
+                Rehash(m_buckets, m_maxDist * 2);
+        }
+    }
+
+private:
+    // Minimal number of buckets in a non-empty table, must be a power of 2.
+    static const size_t MIN_BUCKETS = 8;
+
+    // Minimal value of m_maxDist, must be a power of 2 too.
+    static const size_t MIN_MAX_DIST = 16;
+
+    void Init()
+    {
+        m_slots = nullptr;
+        m_dists = nullptr;
+        m_buckets = 0;
+        m_maxDist = 0;
+        m_shift = 0;
+        m_size = 0;
+    }
+
+    void Free()
+    {
+        clear();
+
+        ::operator delete(m_slots);
+    }
+
+    // Returns true if the table with the given number of buckets can store
+    // the given number of elements without exceeding the maximal load factor
+    // of 7/8.
+    static bool CanStore(size_t buckets, size_t n)
+    {
+        return n <= buckets - buckets / 8;
+    }
+
+    size_t GetHomeSlot(wxUint64 hash) const
+    {
+        return static_cast<size_t>(hash >> m_shift);
+    }
+
+    // Returns the index of the first occupied slot starting from the given one
+    // or GetSlotCount() if there are none.
+    size_t FindOccupied(size_t pos) const
+    {
+        const size_t count = GetSlotCount();
+        while ( pos < count && !m_dists[pos] )
+            ++pos;
+
+        return pos;
+    }
+
+    // Tries to insert a new value without reallocating the table and returns
+    // the index of the slot it was stored in or GetSlotCount() if it's not
+    // possible. Note that value is only moved from if the insertion succeeds.
+    template <typename V>
+    size_t TryInsert(V&& value, wxUint64 hash)
+    {
+        // Find the slot to insert the value into.
+        size_t pos = GetHomeSlot(hash);
+        size_t dist = 1;
+        while ( m_dists[pos] >= dist )
+        {
+            ++pos;
+            if ( ++dist > m_maxDist )
+                return GetSlotCount();
+        }
+
+        // Find the first empty slot after it and check that all the elements
+        // before it can be shifted forward by one.
+        const size_t count = GetSlotCount();
+        size_t empty = pos;
+        for ( ; m_dists[empty]; ++empty )
+        {
+            if ( m_dists[empty] == m_maxDist || empty + 1 == count )
+                return count;
+        }
+
+        // Do shift them, starting from the end.
+        if ( empty != pos )
+        {
+            new (&m_slots[empty]) value_type(std::move(m_slots[empty - 1]));
+            m_dists[empty] = m_dists[empty - 1] + 1;
+
+            for ( size_t n = empty - 1; n != pos; --n )
+            {
+                m_slots[n] = std::move(m_slots[n - 1]);
+                m_dists[n] = m_dists[n - 1] + 1;
+            }
+
+            m_slots[pos] = std::forward<V>(value);
+        }
+        else
+        {
+            new (&m_slots[pos]) value_type(std::forward<V>(value));
+        }
+
+        m_dists[pos] = static_cast<wxUint32>(dist);
+        ++m_size;
+
+        return pos;
+    }
+
+    void DoErase(size_t pos)
+    {
+        // Shift back all the elements following this one and not in their
+        // home slots.
+        const size_t count = GetSlotCount();
+        for ( ; pos + 1 < count && m_dists[pos + 1] > 1; ++pos )
+        {
+            m_slots[pos] = std::move(m_slots[pos + 1]);
+            m_dists[pos] = m_dists[pos + 1] - 1;
+        }
+
+        m_slots[pos].~value_type();
+        m_dists[pos] = 0;
+        --m_size;
+    }
+
+    // Allocates the memory for the table with the given parameters, without
+    // initializing anything but the distances.
+    void Allocate(size_t buckets, size_t maxDist)
+    {
+        const size_t count = buckets + maxDist;
+
+        // Allocate a single block for both the slots and the distances, the
+        // latter are stored after the former. Note that both buckets and
+        // maxDist are powers of 2 greater than or equal to 8, so the offset of
+        // the distances is always suitably aligned.
+        void* const
+            p = ::operator new(count*(sizeof(value_type) + sizeof(wxUint32)));
+
+        m_slots = static_cast<value_type*>(p);
+        m_dists = reinterpret_cast<wxUint32*>(m_slots + count);
+        for ( size_t n = 0; n < count; ++n )
+            m_dists[n] = 0;
+
+        m_buckets = buckets;
+        m_maxDist = maxDist;
+
+        m_shift = 64;
+        for ( ; buckets > 1; buckets /= 2 )
+            --m_shift;
+    }
+
+    void Rehash(size_t buckets, size_t maxDist)
+    {
+        if ( maxDist < MIN_MAX_DIST )
+            maxDist = MIN_MAX_DIST;
+
+        value_type* const oldSlots = m_slots;
+        wxUint32* const oldDists = m_dists;
+        const size_t oldCount = GetSlotCount();
+
+        Allocate(buckets, maxDist);
+        m_size = 0;
+
+        for ( size_t pos = 0; pos < oldCount; ++pos )
+        {
+            if ( oldDists[pos] )
+            {
+                value_type& value = oldSlots[pos];
+                InsertNew(std::move(value), GetHash(KeyOf::Get(value)));
+                oldSlots[pos].~value_type();
+            }
+        }
+
+        ::operator delete(oldSlots);
+    }
+
+    void CopyFrom(const wxFlatHashTable& other)
+    {
+        if ( !other.m_buckets )
+            return;
+
+        // Use the same layout, so that we can just copy all elements.
+        Allocate(other.m_buckets, other.m_maxDist);
+
+        const size_t count = GetSlotCount();
+        for ( size_t pos = 0; pos < count; ++pos )
+        {
+            if ( other.m_dists[pos] )
+            {
+                new (&m_slots[pos]) value_type(other.m_slots[pos]);
+                m_dists[pos] = other.m_dists[pos];
+                ++m_size;
+            }
+        }
+    }
+
+
+    value_type* m_slots;
+    wxUint32* m_dists;
+
+    // Number of slots which can be home slots, power of 2 or 0.
+    size_t m_buckets;
+
+    // Maximal distance of an element from its home slot and the number of the
+    // extra slots after the m_buckets ones.
+    size_t m_maxDist;
+
+    // Shift used to get the home slot from the hash.
+    unsigned m_shift;
+
+    size_t m_size;
+
+    hasher m_hasher;
+    key_equal m_equal;
+};
+
+// ----------------------------------------------------------------------------
+// wxFlatHashMap and wxFlatHashSet
+// ----------------------------------------------------------------------------
+
+template <typename Key, typename T>
+struct wxFlatHashMapKeyOf
+{
+    static const Key& Get(const std::pair<Key, T>& value) { return value.first; }
+};
+
+template <typename Key>
+struct wxFlatHashSetKeyOf
+{
+    static const Key& Get(const Key& value) { return value; }
+};
+
+// Note that, unlike in std::unordered_map, value_type is std::pair<Key, T>
+// and not std::pair<const Key, T>, as the elements need to be movable, so the
+// keys must not be modified via the iterators.
+template <typename Key, typename T,
+          typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class wxFlatHashMap
+    : public wxFlatHashTable<std::pair<Key, T>, Key,
+                             wxFlatHashMapKeyOf<Key, T>, Hash, KeyEqual>
+{
+private:
+    typedef wxFlatHashTable<std::pair<Key, T>, Key,
+                            wxFlatHashMapKeyOf<Key, T>, Hash, KeyEqual> Base;
+
+public:
+    typedef T mapped_type;
+
+    using Base::Base;
+
+    mapped_type& operator[](const Key& key)
+    {
+        const wxUint64 hash = this->GetHash(key);
+        size_t pos = this->FindIndex(key, hash);
+        if ( pos == this->GetSlotCount() )
+        {
+            pos = this->InsertNew(typename Base::value_type(key, mapped_type()),
+                                  hash);
+        }
+
+        return this->GetValueAt(pos).second;
+    }
+
+    mapped_type& at(const Key& key)
+    {
+        return this->GetValueAt(FindExistingIndex(key)).second;
+    }
+
+    const mapped_type& at(const Key& key) const
+    {
+        return this->GetValueAt(FindExistingIndex(key)).second;
+    }
+
+private:
+    // Return the index of the element with the given key, which must exist:
+    // if it doesn't, throw std::out_of_range, as std::unordered_map::at()
+    // does, or abort if exceptions are disabled.
+    size_t FindExistingIndex(const Key& key) const
+    {
+        const size_t pos = this->FindIndex(key);
+        if ( pos == this->GetSlotCount() )
+        {
+#ifdef wxNO_EXCEPTIONS
+            wxFAIL_MSG( "key not found" );
+            std::abort();
+#else
+            throw std::out_of_range("wxFlatHashMap::at(): key not found");
+#endif
+        }
+
+        return pos;
+    }
+};
+
+template <typename Key,
+          typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class wxFlatHashSet
+    : public wxFlatHashTable<Key, Key, wxFlatHashSetKeyOf<Key>, Hash, KeyEqual>
+{
+private:
+    typedef wxFlatHashTable<Key, Key,
+                            wxFlatHashSetKeyOf<Key>, Hash, KeyEqual> Base;
+
+public:
+    using Base::Base;
+};
+
+// ----------------------------------------------------------------------------
+// Macros for declaring flat hash map and set classes
+// ----------------------------------------------------------------------------
+
+// These macros can be used instead of the corresponding WX_DECLARE_HASH_XXX()
+// ones to use the open addressing hash table instead of the node based one.
+//
+// Note that, unlike with the standard classes, inserting or erasing elements
+// invalidates all iterators, pointers and references to the other elements.
+
+#define WX_DECLARE_FLAT_HASH_MAP( KEY_T, VALUE_T, HASH_T, KEY_EQ_T, CLASSNAME ) \
+    class CLASSNAME : public wxFlatHashMap< KEY_T, VALUE_T, HASH_T, KEY_EQ_T > \
+    { \
+    public: \
+        using wxFlatHashMap< KEY_T, VALUE_T, HASH_T, KEY_EQ_T >::wxFlatHashMap; \
+    }
+
+#define WX_DECLARE_FLAT_STRING_HASH_MAP( VALUE_T, CLASSNAME ) \
+    WX_DECLARE_FLAT_HASH_MAP( wxString, VALUE_T, wxStringHash, wxStringEqual, \
+                              CLASSNAME )
+
+#define WX_DECLARE_FLAT_VOIDPTR_HASH_MAP( VALUE_T, CLASSNAME ) \
+    WX_DECLARE_FLAT_HASH_MAP( void*, VALUE_T, wxPointerHash, wxPointerEqual, \
+                              CLASSNAME )
+
+#define WX_DECLARE_FLAT_HASH_SET( KEY_T, HASH_T, KEY_EQ_T, CLASSNAME ) \
+    class CLASSNAME : public wxFlatHashSet< KEY_T, HASH_T, KEY_EQ_T > \
+    { \
+    public: \
+        using wxFlatHashSet< KEY_T, HASH_T, KEY_EQ_T >::wxFlatHashSet; \
+    }
+
+#endif // _WX_FLATHASHMAP_H_
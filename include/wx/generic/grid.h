@@ -120,6 +120,7 @@ class wxGridOperations;
 class wxGridRowOperations;
 class wxGridColumnOperations;
 class wxGridDirectionOperations;
+class wxGridDrawnCellBackgrounds;
 
 #if wxUSE_ACCESSIBILITY
 class WXDLLIMPEXP_FWD_CORE wxGridAccessible;
@@ -1505,6 +1506,104 @@ private:
 };
 
 
+// ------ wxGridTypedTable
+//
+// Table storing the values of each column in a contiguous vector of the type
+// of this column, which is much more compact than wxGridStringTable for the
+// big tables of numbers and avoids converting the numbers to and from strings
+//
+
+class WXDLLIMPEXP_CORE wxGridTypedTable : public wxGridTableBase
+{
+public:
+    wxGridTypedTable();
+    wxGridTypedTable( int numRows, int numCols );
+    virtual ~wxGridTypedTable();
+
+    // change the type of the given column, converting its existing values to
+    // it, the type must be one of wxGRID_VALUE_{STRING,NUMBER,FLOAT,BOOL}
+    bool SetColType( int col, const wxString& typeName );
+    wxString GetColType( int col ) const;
+
+    // bulk access to all values of a column of the corresponding type, the
+    // number of values must be equal to the number of rows
+    bool SetColValues( int col, const std::vector<wxString>& values );
+    bool SetColValues( int col, const std::vector<wxLongLong_t>& values );
+    bool SetColValues( int col, const std::vector<double>& values );
+    bool SetColValues( int col, const std::vector<bool>& values );
+
+    bool GetColValues( int col, std::vector<wxString>& values ) const;
+    bool GetColValues( int col, std::vector<wxLongLong_t>& values ) const;
+    bool GetColValues( int col, std::vector<double>& values ) const;
+    bool GetColValues( int col, std::vector<bool>& values ) const;
+
+    // reorder all rows of the table by the values in the given column, the
+    // order of the rows with equal values is preserved
+    void SortByCol( int col, bool ascending = true );
+
+    // these are pure virtual in wxGridTableBase
+    //
+    virtual int GetNumberRows() override { return m_numRows; }
+    virtual int GetNumberCols() override { return wxSsize(m_cols); }
+    virtual wxString GetValue( int row, int col ) override;
+    virtual void SetValue( int row, int col, const wxString& s ) override;
+
+    // overridden functions from wxGridTableBase
+    //
+    virtual bool IsEmptyCell( int row, int col ) override;
+
+    virtual wxString GetTypeName( int row, int col ) override;
+    virtual bool CanGetValueAs( int row, int col, const wxString& typeName ) override;
+
+    virtual long GetValueAsLong( int row, int col ) override;
+    virtual double GetValueAsDouble( int row, int col ) override;
+    virtual bool GetValueAsBool( int row, int col ) override;
+
+    virtual void SetValueAsLong( int row, int col, long value ) override;
+    virtual void SetValueAsDouble( int row, int col, double value ) override;
+    virtual void SetValueAsBool( int row, int col, bool value ) override;
+
+    void Clear() override;
+    bool InsertRows( size_t pos = 0, size_t numRows = 1 ) override;
+    bool AppendRows( size_t numRows = 1 ) override;
+    bool DeleteRows( size_t pos = 0, size_t numRows = 1 ) override;
+    bool InsertCols( size_t pos = 0, size_t numCols = 1 ) override;
+    bool AppendCols( size_t numCols = 1 ) override;
+    bool DeleteCols( size_t pos = 0, size_t numCols = 1 ) override;
+
+    void SetRowLabelValue( int row, const wxString& ) override;
+    void SetColLabelValue( int col, const wxString& ) override;
+    void SetCornerLabelValue( const wxString& ) override;
+    wxString GetRowLabelValue( int row ) override;
+    wxString GetColLabelValue( int col ) override;
+    wxString GetCornerLabelValue() const override;
+
+private:
+    // the values of a single column, defined in the implementation file
+    class Column;
+
+    // return the column with the given index or nullptr if it's invalid
+    Column* GetColumn( int col ) const;
+
+    // return the column containing the given cell or nullptr if the cell
+    // coordinates are invalid
+    Column* GetCellColumn( int row, int col ) const;
+
+    // replace the column with a new one of the given type
+    Column* ResetColumn( int col, const wxString& typeName );
+
+    std::vector<std::unique_ptr<Column>> m_cols;
+    int m_numRows;
+
+    // only used if custom labels are set, as in wxGridStringTable
+    wxArrayString m_rowLabels;
+    wxArrayString m_colLabels;
+    wxString m_cornerLabel;
+
+    wxDECLARE_DYNAMIC_CLASS_NO_COPY(wxGridTypedTable);
+};
+
+
 
 // ============================================================================
 //  Grid view classes
@@ -2522,6 +2621,13 @@ public:
     // implementation only
     void CancelMouseCapture();
 
+    // Returns true if the background of the given cell has already been
+    // filled with the given colour while drawing the grid cell area, so that
+    // the renderer doesn't need to do it again.
+    bool UseDrawnCellBackground(int row, int col,
+                                const wxRect& rect,
+                                const wxColour& colour);
+
 #if wxUSE_ACCESSIBILITY
     virtual wxAccessible* CreateAccessible() override;
     virtual bool Show(bool show) override;
@@ -2664,6 +2770,9 @@ protected:
     wxColour   m_gridFrozenBorderColour;
     int        m_gridFrozenBorderPenWidth;
 
+    // Only non-null while DrawGridCellArea() is executing.
+    wxGridDrawnCellBackgrounds *m_drawnCellBackgrounds;
+
     // common part of AutoSizeColumn/Row()
     void AutoSizeColOrRow(int n, bool setAsMin, wxGridDirection direction);
 
@@ -2916,6 +3025,20 @@ private:
     // implement wxScrolledCanvas method to return m_gridWin size
     virtual wxSize GetSizeAvailableForScrollTarget(const wxSize& size) override;
 
+    // Implementation of DrawGridCellArea(): if fillLineGaps is true, the grid
+    // lines are going to be drawn after the cells and the gaps left for them
+    // between the cells may be filled together with the cells backgrounds.
+    void DoDrawGridCellArea(wxDC& dc,
+                            const wxGridCellCoordsVector& cells,
+                            bool fillLineGaps);
+
+    // Implementation of DrawCell() for a cell with already known attributes.
+    void DoDrawCell(wxDC& dc,
+                    const wxGridCellCoords& coords,
+                    wxGridCellAttr& attr,
+                    const wxRect& rect,
+                    bool isSelected);
+
     // depending on the values of m_numFrozenRows and m_numFrozenCols, it will
     // create and initialize or delete the frozen windows
     void InitializeFrozenWindows();
@@ -28,6 +28,8 @@
 #include <iterator>
 #include <set>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 // ----------------------------------------------------------------------------
 // array classes
@@ -446,6 +448,62 @@ private:
 // the internal data representation used by wxGridCellAttrProvider
 // ----------------------------------------------------------------------------
 
+// this class maps row or column positions to the indices used as keys for the
+// cell attributes: as these indices don't change when rows or columns are
+// inserted or deleted, only this map needs to be updated when it happens
+class WXDLLIMPEXP_ADV wxGridPosToIndexMap
+{
+public:
+    wxGridPosToIndexMap() { Reset(); }
+
+    // Make all positions correspond to the indices with the same value again.
+    void Reset();
+
+    int GetIndex(int pos) const;
+
+    // Returns wxNOT_FOUND if the index doesn't correspond to any position.
+    int GetPos(int index) const;
+
+    // Allocates new indices for the inserted positions.
+    void Insert(int pos, int count);
+
+    // Returns the ranges of the indices of the deleted positions as
+    // (first, count) pairs.
+    std::vector<std::pair<int, int>> Delete(int pos, int count);
+
+    size_t GetSegmentCount() const { return m_segments.size(); }
+
+private:
+    // Returns the segment containing the given position.
+    size_t FindSegment(int pos) const;
+
+    // Returns the segment starting at the given position, creating it if
+    // necessary.
+    size_t SplitAt(int pos);
+
+    // Merges the segment with the previous one if their indices are
+    // contiguous.
+    void MergeWithPrevious(size_t n);
+
+    // Each segment maps the positions from its start to the start of the next
+    // one (or to infinity for the last one) to contiguous indices.
+    struct Segment
+    {
+        int pos;
+        int index;
+    };
+
+    std::vector<Segment> m_segments;
+
+    // Segments sorted by their indices, used by GetPos() and rebuilt on
+    // demand after the segments change.
+    mutable std::vector<size_t> m_byIndex;
+
+    // The next index to allocate: these indices are negative, so they don't
+    // clash with the initial ones.
+    int m_nextIndex;
+};
+
 // this class stores attributes set for cells
 class WXDLLIMPEXP_ADV wxGridCellAttrData
 {
@@ -458,10 +516,43 @@ public:
     void UpdateAttrCols( size_t pos, int numCols );
 
 private:
+    typedef wxGridCoordsToAttrMap::key_type KeyType;
+
     // Tries to search for the attr for given cell.
     wxGridCoordsToAttrMap::iterator FindIndex(int row, int col) const;
 
+    void AddAttr(KeyType key, wxGridCellAttr *attr);
+    void RemoveAttr(wxGridCoordsToAttrMap::iterator it);
+
+    // Removes the attributes of all cells in the given range of row (or
+    // column) indices.
+    void RemoveAttrs(int first, int count, bool rows);
+
+    // Inserts (positive count) or deletes (negative count) rows or columns.
+    void UpdateAttrRowsOrCols(int editPos, int editCount, bool isEditingRows);
+
+    // Makes the indices equal to the positions again.
+    void Compact();
+
+    // The attributes indexed by the row and column indices from m_rows and
+    // m_cols, which are not affected by inserting or deleting rows or columns.
     mutable wxGridCoordsToAttrMap m_attrs;
+
+    // The keys of m_attrs sorted by rows and by columns (with the row and
+    // column indices swapped in the latter), to find the deleted cells.
+    std::set<KeyType> m_rowsKeys,
+                      m_colsKeys;
+
+    wxGridPosToIndexMap m_rows,
+                        m_cols;
+
+    // The keys of the cells which are parts of multicells: these cells need
+    // to be updated when inserting or deleting rows or columns, as their size
+    // depends on the positions. This is valid only if m_multicellsValid is
+    // true and no cell sizes changed since m_multicellsChanges value.
+    std::vector<KeyType> m_multicells;
+    unsigned m_multicellsChanges = 0;
+    bool m_multicellsValid = false;
 };
 
 // this class stores attributes set for rows or columns
@@ -1262,6 +1353,59 @@ private:
     wxGridDataTypeInfoArray m_typeinfo;
 };
 
+// ----------------------------------------------------------------------------
+// wxGridDrawnCellBackgrounds
+// ----------------------------------------------------------------------------
+
+// This class is used by wxGrid::DrawGridCellArea() to remember the backgrounds
+// of the cells that it has already filled itself, merging adjacent cells of
+// the same colour, so that wxGridCellRenderer::Draw() doesn't need to fill
+// them again when the cells are drawn.
+class wxGridDrawnCellBackgrounds
+{
+public:
+    wxGridDrawnCellBackgrounds() = default;
+
+    void Add(int row, int col, const wxRect& rect, const wxColour& colour)
+    {
+        m_backgrounds[MakeKey(row, col)] = Background{rect, colour};
+    }
+
+    // Returns true if the background of this cell was already drawn using the
+    // given rectangle and colour. As the cell may be drawn more than once,
+    // e.g. when overflowing text needs to be erased, this only returns true
+    // the first time it's called for each cell.
+    bool Use(int row, int col, const wxRect& rect, const wxColour& colour)
+    {
+        const auto it = m_backgrounds.find(MakeKey(row, col));
+        if ( it == m_backgrounds.end() )
+            return false;
+
+        const bool same = it->second.rect == rect &&
+                            it->second.colour == colour;
+        m_backgrounds.erase(it);
+
+        return same;
+    }
+
+private:
+    static wxLongLong_t MakeKey(int row, int col)
+    {
+        return (static_cast<wxLongLong_t>(row) << 32) |
+                    static_cast<wxUint32>(col);
+    }
+
+    struct Background
+    {
+        wxRect rect;
+        wxColour colour;
+    };
+
+    std::unordered_map<wxLongLong_t, Background> m_backgrounds;
+
+    wxDECLARE_NO_COPY_CLASS(wxGridDrawnCellBackgrounds);
+};
+
 // Returns the rectangle for showing something of the given size in a cell with
 // the given alignment.
 //
@@ -1326,6 +1470,14 @@ TryGetValueAsDate(wxDateTime& result,
 
 #endif // wxUSE_DATETIME
 
+// Returns the colour used for the background of a cell with the given
+// attributes by the default renderer, taking into account whether the cell is
+// selected and whether the grid is enabled.
+wxColour
+GetCellBackgroundColour(const wxGrid& grid,
+                        const wxGridCellAttr& attr,
+                        bool isSelected);
+
 //=============================================================================
 // SelectionShape class
 //=============================================================================
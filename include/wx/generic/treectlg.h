@@ -16,6 +16,9 @@
 #include "wx/pen.h"
 #include "wx/scrolwin.h"
 
+#include <list>
+#include <unordered_map>
+
 // -----------------------------------------------------------------------------
 // forward declaration
 // -----------------------------------------------------------------------------
@@ -224,6 +227,12 @@ public:
     static wxVisualAttributes
     GetClassDefaultAttributes(wxWindowVariant variant = wxWINDOW_VARIANT_NORMAL);
 
+    // virtual mode support
+    // --------------------
+
+    // return true if the control uses wxTR_VIRTUAL style
+    bool IsVirtual() const { return HasFlag(wxTR_VIRTUAL); }
+
     // implementation helpers
     void AdjustMyScrollbars();
 
@@ -326,9 +335,11 @@ protected:
     void CalculateLineHeight();
     int  GetLineHeight(wxGenericTreeItem *item) const;
     void PaintLevel( wxGenericTreeItem *item, wxDC& dc, int level, int &y );
+    int  PaintChildren( wxGenericTreeItem *item, wxDC& dc, int level, int &y );
     void PaintItem( wxGenericTreeItem *item, wxDC& dc);
 
     void CalculateLevel( wxGenericTreeItem *item, wxReadOnlyDC &dc, int level, int &y );
+    void CalculateChildrenPositions( wxGenericTreeItem *item );
     void CalculatePositions();
 
     void RefreshSubtree( wxGenericTreeItem *item );
@@ -355,6 +366,10 @@ protected:
 
     virtual wxSize DoGetBestSize() const override;
 
+    // this function is only used for the controls with wxTR_VIRTUAL style and
+    // must be overridden in this case to return the label of the given item
+    virtual wxString OnGetItemText(const wxTreeItemId& item) const;
+
 private:
     void OnSysColourChanged(wxSysColourChangedEvent& WXUNUSED(event))
     {
@@ -369,6 +384,26 @@ private:
     // operation.
     void ResetFindState();
 
+    // Return the label of the item, retrieving it from OnGetItemText() if
+    // necessary in virtual mode.
+    const wxString& GetItemLabel(wxGenericTreeItem *item) const;
+
+    // Add the item, whose text must have been already set, to the labels
+    // cache used in virtual mode, discarding the least recently used label if
+    // the cache is full.
+    void CacheItemLabel(wxGenericTreeItem *item) const;
+
+    // Remove the item from the labels cache, if it's there.
+    void UncacheItemLabel(wxGenericTreeItem *item) const;
+
+    // In virtual mode, the labels are only kept for a limited number of the
+    // items, with the most recently used ones at the front of this list, and
+    // the map allows to find the position of an item in it.
+    using LabelsCache = std::list<wxGenericTreeItem*>;
+    mutable LabelsCache m_labelsCache;
+    mutable std::unordered_map<wxGenericTreeItem*,
+                               LabelsCache::iterator> m_labelsCacheIndex;
+
     // Find the next item, either looking inside the collapsed items or not.
     enum
     {
@@ -377,6 +412,32 @@ private:
     };
     wxTreeItemId DoGetNext(const wxTreeItemId& item, int flags = 0) const;
 
+    // Return true if all rows have the same height, which allows to compute
+    // the item positions from their rows instead of storing them.
+    bool HasUniformRows() const { return !HasFlag(wxTR_HAS_VARIABLE_ROW_HEIGHT); }
+
+    // Return the total number of the rows, i.e. of the items not hidden by
+    // their collapsed parents.
+    size_t GetRowCount() const;
+
+    // Return the row of the given item, which must not be hidden.
+    size_t GetItemRow(wxGenericTreeItem *item) const;
+
+    // Return the item shown in the given row, which must be valid.
+    wxGenericTreeItem *GetItemAtRow(size_t row) const;
+
+    // Update the position of the given item from its row if HasUniformRows(),
+    // do nothing otherwise as the positions are computed by CalculatePositions()
+    // then.
+    void UpdateItemPosition(wxGenericTreeItem *item) const;
+
+    // Return the item at the given point in logical coordinates, if any.
+    wxGenericTreeItem *HitTestItems(const wxPoint& point, int& flags) const;
+
+    // The maximal right edge of all the items laid out so far, used for the
+    // horizontal scrollbar range if HasUniformRows().
+    int m_itemsWidth;
+
     // True if we're using custom colours/font, respectively, or false if we're
     // using the default colours and should update them whenever system colours
     // change.
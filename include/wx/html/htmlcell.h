@@ -450,6 +450,8 @@ class WXDLLIMPEXP_HTML wxHtmlWordCell : public wxHtmlCell
 {
 public:
     wxHtmlWordCell(const wxString& word, const wxDC& dc);
+    wxHtmlWordCell(const wxString& word,
+                   wxCoord width, wxCoord height, wxCoord descent);
     void Draw(wxDC& dc, int x, int y, int view_y1, int view_y2,
               wxHtmlRenderingInfo& info) override;
     virtual wxCursor GetMouseCursor(wxHtmlWindowInterface *window) const override;
@@ -625,7 +627,7 @@ protected:
             // borders color of this container
     int m_LastLayout = -1;
             // if != -1 then call to Layout may be no-op
-            // if previous call to Layout has same argument
+            // if it results in the same width as the previous one
     int m_MaxTotalWidth = 0;
             // Maximum possible length if ignoring line wrap
 
@@ -161,9 +161,17 @@ protected:
 private:
     void AddWord(wxHtmlWordCell *word);
     void AddWord(const wxString& word)
-        { AddWord(new wxHtmlWordCell(word, *(GetDC()))); }
+        { AddWord(CreateWordCell(word)); }
     void AddPreBlock(const wxString& text);
 
+    // Creates a new word cell using the current font, reusing the extent of
+    // the same word if it had been already measured with this font before.
+    wxHtmlWordCell *CreateWordCell(const wxString& word);
+
+    // Forgets all the cached word extents for the given font (which is about
+    // to be deleted) or for all fonts if it is null.
+    void ClearWordExtents(const wxFont *font = nullptr);
+
     bool m_tmpLastWasSpace;
     wxString m_tmpStrBuf;
         // temporary variables used by AddText
@@ -216,6 +224,27 @@ private:
 
     wxHtmlWordCell *m_lastWordCell;
 
+    // Extents of the words already measured, per font from m_FontsTable: as
+    // the same words occur many times in any document, this allows to avoid
+    // measuring most of them. The cache remains valid for as long as the DC
+    // characteristics which may affect the extents don't change, so it is
+    // reused when parsing several pages in the same window.
+    struct WordExtent
+    {
+        wxCoord width, height, descent;
+    };
+    using WordExtentsMap = std::unordered_map<wxString, WordExtent>;
+    std::unordered_map<const wxFont*, WordExtentsMap> m_wordExtents;
+
+    // Font currently selected into the DC by CreateCurrentFont() and the
+    // extents cache for it (null if none).
+    const wxFont *m_wordExtentsFont;
+    WordExtentsMap *m_wordExtentsCurrent;
+
+    // DC parameters for which the extents in m_wordExtents were computed.
+    wxSize m_wordExtentsPPI;
+    double m_wordExtentsScaleX, m_wordExtentsScaleY;
+
     // current position on line, in num. of characters; used to properly
     // expand TABs; only updated while inside <pre>
     int m_posColumn;
@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/parallelsort.h
+// Purpose:     wxParallelSort() helper using several threads for big ranges.
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_PARALLELSORT_H_
+#define _WX_PRIVATE_PARALLELSORT_H_
+
+#include "wx/defs.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+// std::thread is not available with libstdc++ configured without threads
+// support, which used to be the case for MinGW using Win32 threads.
+#if wxUSE_THREADS && \
+    (!defined(__GLIBCXX__) || defined(_GLIBCXX_HAS_GTHREADS))
+    #define wxHAS_PARALLEL_SORT
+#endif
+
+#ifdef wxHAS_PARALLEL_SORT
+    #include <thread>
+    #include <vector>
+#endif
+
+// Ranges smaller than this are always sorted in the current thread, as the
+// overhead of creating the threads would outweigh any gain.
+constexpr size_t wxPARALLEL_SORT_MIN_COUNT = 20000;
+
+#ifdef wxHAS_PARALLEL_SORT
+
+namespace wxPrivate
+{
+
+// Call the given function for all chunks from 0 to bounds.size() - 1 with the
+// given step, using a separate thread for all of them but the first one.
+template <typename RandomIt, typename Func>
+void ForEachSortChunk(const std::vector<RandomIt>& bounds, size_t step, Func func)
+{
+    std::vector<std::thread> threads;
+    for ( size_t n = step; n < bounds.size() - 1; n += step )
+    {
+        try
+        {
+            threads.emplace_back(func, n);
+        }
+        catch ( ... )
+        {
+            // Creating the thread may fail if we're out of resources, still
+            // produce the correct result in this case.
+            func(n);
+        }
+    }
+
+    func(0);
+
+    for ( auto& thread : threads )
+        thread.join();
+}
+
+} // namespace wxPrivate
+
+#endif // wxHAS_PARALLEL_SORT
+
+// Sort the given range, using several threads if the range is big enough and
+// there are several CPUs available.
+//
+// Unlike with std::sort(), the comparator is called from several threads
+// concurrently and so must be thread-safe. It also must not throw.
+template <typename RandomIt, typename Compare>
+void wxParallelSort(RandomIt first, RandomIt last, Compare comp)
+{
+#ifdef wxHAS_PARALLEL_SORT
+    const size_t count = std::distance(first, last);
+
+    // Use a power of 2 number of chunks to be able to merge them pairwise and
+    // make each of them big enough to be worth sorting in its own thread.
+    size_t numChunks = 1;
+    for ( size_t numCPUs = std::thread::hardware_concurrency();
+          numChunks*2 <= numCPUs &&
+            count/(numChunks*2) >= wxPARALLEL_SORT_MIN_COUNT/2;
+          numChunks *= 2 )
+        ;
+
+    if ( numChunks > 1 )
+    {
+        std::vector<RandomIt> bounds;
+        bounds.reserve(numChunks + 1);
+        for ( size_t n = 0; n < numChunks; n++ )
+            bounds.push_back(first + (count*n)/numChunks);
+        bounds.push_back(last);
+
+        wxPrivate::ForEachSortChunk(bounds, 1, [&bounds, comp](size_t n)
+            {
+                std::sort(bounds[n], bounds[n + 1], comp);
+            });
+
+        for ( size_t step = 2; step <= numChunks; step *= 2 )
+        {
+            wxPrivate::ForEachSortChunk(bounds, step,
+                [&bounds, comp, step](size_t n)
+                {
+                    std::inplace_merge(bounds[n],
+                                       bounds[n + step/2],
+                                       bounds[n + step],
+                                       comp);
+                });
+        }
+
+        return;
+    }
+#endif // wxHAS_PARALLEL_SORT
+
+    std::sort(first, last, comp);
+}
+
+template <typename RandomIt>
+inline void wxParallelSort(RandomIt first, RandomIt last)
+{
+    wxParallelSort(first, last,
+                   std::less<typename std::iterator_traits<RandomIt>::value_type>());
+}
+
+#endif // _WX_PRIVATE_PARALLELSORT_H_
@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/sortkey.h
+// Purpose:     Helpers for building the binary string sort keys.
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_SORTKEY_H_
+#define _WX_PRIVATE_SORTKEY_H_
+
+#include "wx/string.h"
+#include "wx/wxcrt.h"
+
+#include <string>
+
+namespace wxPrivate
+{
+
+// Append the encoding of a non-zero value to the sort key.
+//
+// The encoding uses fewer bytes for the smaller values, preserves their order
+// when the keys are compared byte by byte and never starts with a NUL byte.
+// This allows to use NUL as terminator of a sequence of values, which sorts
+// before any other value, and to concatenate several such sequences.
+inline void AppendSortKeyValue(std::string& key, wxUint32 value)
+{
+    if ( value < 0x80 )
+    {
+        key += static_cast<char>(value);
+    }
+    else if ( value < 0x4000 )
+    {
+        key += static_cast<char>(0x80 | (value >> 8));
+        key += static_cast<char>(value & 0xff);
+    }
+    else if ( value < 0x200000 )
+    {
+        key += static_cast<char>(0xc0 | (value >> 16));
+        key += static_cast<char>((value >> 8) & 0xff);
+        key += static_cast<char>(value & 0xff);
+    }
+    else
+    {
+        key += static_cast<char>(0xe0);
+        key += static_cast<char>(value >> 24);
+        key += static_cast<char>((value >> 16) & 0xff);
+        key += static_cast<char>((value >> 8) & 0xff);
+        key += static_cast<char>(value & 0xff);
+    }
+}
+
+// Append the characters of the string, which may contain NULs, to the key,
+// so that the keys sort in the same order as the strings compared using
+// wxString::Cmp() or, if ignoreCase is true, wxString::CmpNoCase().
+inline void AppendSortKeyChars(std::string& key, const wxString& s,
+                               bool ignoreCase)
+{
+    key.reserve(key.length() + s.length());
+    for ( wxString::const_iterator it = s.begin(); it != s.end(); ++it )
+    {
+        const wxUniChar ch = ignoreCase ? wxUniChar(wxTolower(*it))
+                                        : wxUniChar(*it);
+
+        // Offset the value to make NUL characters representable too.
+        AppendSortKeyValue(key, ch.GetValue() + 1);
+    }
+}
+
+// Append the output of wcsxfrm() to the key.
+inline void AppendSortKeyXfrm(std::string& key, const wchar_t* xfrm)
+{
+    for ( ; *xfrm; ++xfrm )
+        AppendSortKeyValue(key, static_cast<wxUint32>(*xfrm));
+}
+
+} // namespace wxPrivate
+
+#endif // _WX_PRIVATE_SORTKEY_H_
@@ -109,6 +109,17 @@ public:
     virtual int CompareStrings(const wxString& lhs, const wxString& rhs,
                                int flags) const = 0;
 
+    // The default implementation returns GetDefaultSortKey(), it must be
+    // overridden if CompareStrings() uses a different order.
+    virtual std::string GetSortKey(const wxString& str, int flags) const
+    {
+        return GetDefaultSortKey(str, flags);
+    }
+
+    // Returns the key ordering the strings in the same way as wxString::Cmp()
+    // or, if wxCompare_CaseInsensitive is specified, CmpNoCase() do.
+    static std::string GetDefaultSortKey(const wxString& str, int flags);
+
     virtual ~wxUILocaleImpl() = default;
 
     // These two methods are for internal use only. First one creates the
@@ -2278,6 +2278,10 @@ protected:
     // compatibility, we'll stick it here.
     int                         m_maxLen;
 
+    // Index of the row showing this property, only valid if the property is
+    // visible, see wxPropertyGridPageState::GetVisibleRow().
+    unsigned int                m_visibleRow;
+
     // Root has 0, categories etc. at that level 1, etc.
     unsigned char               m_depth;
 
@@ -594,6 +594,7 @@ public:
     void VirtualHeightChanged()
     {
         m_vhCalcPending = true;
+        VisibleRowsChanged();
     }
 
 protected:
@@ -601,6 +602,16 @@ protected:
 
     wxPGProperty* DoGetItemAtY(int y) const;
 
+    // Called when visible properties or their order change.
+    void VisibleRowsChanged()
+    {
+        m_visibleRowsValid = false;
+    }
+
+    // Returns index of the given property among the visible rows or
+    // wxNOT_FOUND if it's not currently visible.
+    int GetVisibleRow(const wxPGProperty* p) const;
+
     void DoSetSelection(wxPGProperty* prop)
     {
         m_selection.clear();
@@ -810,8 +821,25 @@ protected:
     // Used to (temporarily) disable splitter centering.
     bool                        m_dontCenterSplitter;
 
+    // All visible properties in display order, i.e. the property shown in
+    // the row N is m_visibleRows[N]. Rebuilt on demand when invalid.
+    mutable std::vector<wxPGProperty*> m_visibleRows;
+
+    // False if m_visibleRows must be rebuilt before being used.
+    mutable bool                m_visibleRowsValid;
+
 private:
     void InitNonCatMode();
+
+    // Rebuilds m_visibleRows if necessary.
+    void EnsureVisibleRows() const;
+
+    // Appends visible descendants of the given property to m_visibleRows.
+    void AddVisibleRows(const wxPGProperty* parent) const;
+
+    // Returns the increase of the virtual height due to adding the given
+    // property, which must be already inserted, in categorized mode.
+    unsigned int GetAddedPropertyHeight(const wxPGProperty* property) const;
 };
 
 // -----------------------------------------------------------------------
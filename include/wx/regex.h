@@ -16,6 +16,7 @@
 #if wxUSE_REGEX
 
 #include "wx/string.h"
+#include "wx/vector.h"
 #include "wx/versioninfo.h"
 
 // ----------------------------------------------------------------------------
@@ -45,6 +46,10 @@ enum
     // after/before it regardless of the setting of wxRE_NOT[BE]OL
     wxRE_NEWLINE  = 16,
 
+    // use JIT compilation, if available, to make matching faster at the price
+    // of making the compilation itself slower
+    wxRE_JIT      = 256,
+
     // default flags
     wxRE_DEFAULT  = wxRE_EXTENDED
 };
@@ -70,6 +75,41 @@ enum
 // ----------------------------------------------------------------------------
 
 class WXDLLIMPEXP_FWD_BASE wxRegExImpl;
+class WXDLLIMPEXP_FWD_BASE wxRegExMatchImpl;
+
+// ----------------------------------------------------------------------------
+// wxRegExMatch: results of matching wxRegEx against some text
+// ----------------------------------------------------------------------------
+
+// Unlike wxRegEx itself, which stores the results of the last match, objects
+// of this class can be used to match the same wxRegEx from multiple threads
+// concurrently, by using a separate wxRegExMatch object in each of them. They
+// can (and should) also be reused for several matches to avoid allocating the
+// memory for the results every time.
+class WXDLLIMPEXP_BASE wxRegExMatch
+{
+public:
+    wxRegExMatch() { m_impl = nullptr; }
+    ~wxRegExMatch();
+
+    // return the number of captures, including the whole match, or 0 if the
+    // last match didn't succeed
+    size_t GetCount() const;
+
+    // get the start index and the length of the entire match (index 0) or
+    // a subexpression match (index != 0), the start index is relative to the
+    // start of the matched text
+    //
+    // return false if no match or if this subexpression didn't match
+    bool Get(size_t *start, size_t *len, size_t index = 0) const;
+
+private:
+    wxRegExMatchImpl *m_impl;
+
+    friend class wxRegExImpl;
+
+    wxDECLARE_NO_COPY_CLASS(wxRegExMatch);
+};
 
 class WXDLLIMPEXP_BASE wxRegEx
 {
@@ -102,6 +142,19 @@ public:
     bool Matches(const wxChar *text, int flags, size_t len) const
         { return Matches(wxString(text, len), flags); }
 
+    // matches the regular expression against the text in [start, end) range
+    // without copying it and store the results in the provided match object
+    // instead of this one
+    //
+    // unlike all the other functions, this one can be called concurrently
+    // from different threads, as long as each of them uses its own match
+    bool Matches(const wxStringCharType *start,
+                 const wxStringCharType *end,
+                 wxRegExMatch& match,
+                 int flags = 0) const;
+
+    bool Matches(const wxString& text, wxRegExMatch& match, int flags = 0) const;
+
     // get the start index and the length of the match of the expression
     // (index 0) or a bracketed subexpression (index != 0)
     //
@@ -168,6 +221,88 @@ private:
     wxRegEx &operator=(const wxRegEx&);
 };
 
+// ----------------------------------------------------------------------------
+// wxRegExSet: several regular expressions matched in a single pass
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxRegExSet
+{
+public:
+    // a single match found by FindAll()
+    struct Match
+    {
+        size_t pattern;     // index of the pattern which matched
+        size_t start;       // offset of the match in the text
+        size_t len;         // length of the match
+    };
+
+    wxRegExSet() { m_impl = nullptr; m_nGroups = 0; }
+
+    // add a pattern to the set and return its index or wxNOT_FOUND if the
+    // pattern is invalid or uses back references, which are not supported
+    //
+    // flags may be a combination of wxRE_BASIC, wxRE_ICASE and wxRE_NEWLINE
+    //
+    // Compile() must be called (again) after adding the patterns
+    int Add(const wxString& pattern, int flags = wxRE_DEFAULT);
+
+    // return the number of patterns in the set
+    size_t GetCount() const { return m_groups.size(); }
+
+    // compile all patterns into a single expression, flags may be wxRE_JIT
+    bool Compile(int flags = 0);
+
+    // return true if Compile() was called successfully after the last Add()
+    bool IsValid() const { return m_impl != nullptr; }
+
+    // find the first match of any pattern in the given text and return the
+    // index of the matching pattern or wxNOT_FOUND
+    //
+    // if more than one pattern matches at the same position, the one added
+    // first is used
+    //
+    // like the similar wxRegEx overloads, these functions can be called from
+    // multiple threads concurrently if each of them uses its own match
+    int Matches(const wxStringCharType *start,
+                const wxStringCharType *end,
+                wxRegExMatch& match,
+                int flags = 0) const;
+    int Matches(const wxString& text, wxRegExMatch& match, int flags = 0) const;
+
+    // get the match of the pattern with the given index (0 for the entire
+    // match or a subexpression of this pattern otherwise) after a successful
+    // call to Matches() which returned this pattern
+    bool GetMatch(const wxRegExMatch& match,
+                  size_t pattern,
+                  size_t *start,
+                  size_t *len,
+                  size_t index = 0) const;
+
+    // find all non-empty, non-overlapping matches of all patterns in the text
+    // and append them to the provided vector, return their number
+    size_t FindAll(const wxString& text, wxVector<Match>& matches) const;
+
+    ~wxRegExSet();
+
+private:
+    // return the index of the pattern which matched
+    int FindPattern(const wxRegExMatch& match) const;
+
+    // the combined expression containing all patterns as alternatives
+    wxString m_expr;
+
+    // the index of the group containing each pattern in m_expr
+    wxVector<size_t> m_groups;
+
+    // the total number of groups in m_expr
+    size_t m_nGroups;
+
+    // the compiled m_expr, if any
+    wxRegExImpl *m_impl;
+
+    wxDECLARE_NO_COPY_CLASS(wxRegExSet);
+};
+
 #endif // wxUSE_REGEX
 
 #endif // _WX_REGEX_H_
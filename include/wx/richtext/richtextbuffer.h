@@ -3783,6 +3783,20 @@ public:
     */
     virtual bool UpdateFloatingObjects(const wxRect& availableRect, wxRichTextObject* untilObj = nullptr);
 
+    /**
+        Lays out only the paragraphs in the given range, starting below the
+        preceding paragraph, and moves the following paragraphs up or down
+        without laying them out again.
+
+        This is used by wxRichTextCtrl for incremental layout and returns
+        @false, without doing anything, if the box can't be partially laid out,
+        e.g. because it has floating objects, a fixed height or vertical
+        alignment, or because it hasn't been entirely laid out yet. In this
+        case Layout() must be used instead.
+
+    */
+    virtual bool LayoutParagraphs(wxReadOnlyDC& dc, wxRichTextDrawingContext& context, const wxRect& rect, const wxRichTextRange& range, int style);
+
     /**
         Get invalid range, rounding to entire paragraphs if argument is true.
     */
@@ -4754,7 +4768,7 @@ public:
     /**
         Sets the text.
     */
-    void SetText(const wxString& text) { m_text = text; }
+    void SetText(const wxString& text) { m_text = text; m_cachedExtents.Clear(); }
 
 // Operations
 
@@ -4767,8 +4781,24 @@ public:
 private:
     void DrawTabbedString(wxDC& dc, const wxRichTextAttr& attr, const wxRect& rect, wxString& str, wxCoord& x, wxCoord& y, ssize_t selStart, ssize_t selEnd);
 
+    // Returns the partial extents of the entire text measured using the font
+    // currently selected into the DC, measuring it only if create is true and
+    // the cached extents are not valid any more. Returns null if the cached
+    // extents can't be used for this text.
+    const wxArrayInt* GetCachedExtents(wxReadOnlyDC& dc, wxRichTextDrawingContext& context, const wxRichTextAttr& attr, bool create) const;
+
 protected:
     wxString    m_text;
+
+    // Partial extents of the entire text: they're reset when the text changes
+    // and are only valid for the font, resolution, scale and capitalization
+    // they were measured with.
+    mutable wxArrayInt  m_cachedExtents;
+    mutable wxFont      m_cachedExtentsFont;
+    mutable wxSize      m_cachedExtentsPPI;
+    mutable double      m_cachedExtentsScale;
+    mutable int         m_cachedExtentsDescent;
+    mutable bool        m_cachedExtentsCaps;
 };
 
 /**
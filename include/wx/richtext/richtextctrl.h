@@ -78,6 +78,8 @@ class WXDLLIMPEXP_FWD_RICHTEXT wxRichTextStyleDefinition;
 #define wxRICHTEXT_DEFAULT_DELAYED_LAYOUT_THRESHOLD 20000
 // Milliseconds before layout occurs after resize
 #define wxRICHTEXT_DEFAULT_LAYOUT_INTERVAL 50
+// Milliseconds spent on each step of incremental delayed layout
+#define wxRICHTEXT_DEFAULT_INCREMENTAL_LAYOUT_TIME 20
 // Milliseconds before delayed image processing occurs
 #define wxRICHTEXT_DEFAULT_DELAYED_IMAGE_PROCESSING_INTERVAL 200
 
@@ -390,6 +392,21 @@ public:
     */
     void ForceDelayedLayout();
 
+    /**
+        Enables or disables incremental delayed layout.
+
+        If enabled, the layout of the parts of a large buffer which are not
+        visible after resizing the control is done in small steps in idle time
+        instead of all at once, keeping the first visible line at the same
+        position, so that the control remains responsive. Loading a file still lays out the whole buffer.
+    */
+    void EnableIncrementalLayout(bool b) { m_enableIncrementalLayout = b; }
+
+    /**
+        Returns @true if incremental delayed layout is enabled.
+    */
+    bool GetIncrementalLayout() const { return m_enableIncrementalLayout; }
+
     /**
         Sets the text (normal) cursor.
     */
@@ -2278,6 +2295,12 @@ public:
     */
     void RequestDelayedImageProcessing();
 
+    /**
+        Lays out the next part of the buffer when doing incremental delayed
+        layout. Returns @true if the whole buffer has been laid out.
+    */
+    bool ContinueDelayedLayout();
+
     /**
         Respond to timer events.
     */
@@ -2387,6 +2410,12 @@ protected:
     wxLongLong              m_fullLayoutTime;
     long                    m_fullLayoutSavedPosition;
 
+    /// Incremental delayed layout: is it enabled, the position from which it
+    /// continues and the buffer end when it was last done.
+    bool                    m_enableIncrementalLayout;
+    long                    m_incrementalLayoutPosition;
+    long                    m_incrementalLayoutEnd;
+
     /// Threshold for doing delayed layout
     long                    m_delayedLayoutThreshold;
 
@@ -774,6 +774,20 @@ private:
     // Get the child item with the given index and assert if there is none.
     wxSizerItemList::compatibility_iterator GetChildNode(size_t index) const;
 
+    // wxSizerItem::SetDimension() sets m_layingOutFromParent and
+    // InformFirstDirection() resets m_hasCalcMinSize.
+    friend class wxSizerItem;
+
+    // The value returned by CalcMin() during the last GetMinSize() call and
+    // whether it can still be reused by Layout(), which is only the case when
+    // this sizer is laid out by its parent sizer right after the parent has
+    // computed its own minimal size, see wxSizer::Layout().
+    wxSize m_calcMinSize;
+    bool m_hasCalcMinSize = false;
+
+    // True while Layout() is called by the parent sizer layout.
+    bool m_layingOutFromParent = false;
+
     wxDECLARE_CLASS(wxSizer);
 };
 
@@ -71,17 +71,24 @@ class wxTextCompleterFixed : public wxTextCompleterSimple
 public:
     void SetCompletions(const wxArrayString& strings)
     {
-        m_strings = strings;
+        // Native controls match the prefix case-insensitively, so do the same
+        // to avoid excluding any strings they would accept.
+        m_index.Set(strings, false /* not case-sensitive */);
     }
 
-    virtual void GetCompletions(const wxString& WXUNUSED(prefix),
+    virtual void GetCompletions(const wxString& prefix,
                                 wxArrayString& res) override
     {
-        res = m_strings;
+        res.clear();
+
+        const std::vector<size_t> indices = m_index.FindPrefix(prefix);
+        res.reserve(indices.size());
+        for ( size_t n : indices )
+            res.push_back(m_index.GetString(n));
     }
 
 private:
-    wxArrayString m_strings;
+    wxStringSearchIndex m_index;
 };
 
 
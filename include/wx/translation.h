@@ -59,6 +59,17 @@ using wxTranslationsHashMap = std::unordered_map<wxString, wxString>;
 #define wxGETTEXT_IN_CONTEXT_PLURAL(c, sing, plur, n) \
     wxGettextInContextPluralWrapper((c), (sing), (plur), (n))
 
+// same as _() but caches the translation in the calling thread and only looks
+// it up again when the translations change, which makes it much faster, e.g.
+// for use in the code executed very often: the argument must be a literal and
+// --keyword="wxGETTEXT_CACHED" must be added to xgettext options to use it
+#define wxGETTEXT_CACHED(s) \
+    ([]() -> const wxString& \
+     { \
+        static thread_local wxCachedTranslation s_cachedTranslation; \
+        return s_cachedTranslation.Get(s); \
+     }())
+
 // another one which just marks the strings for extraction, but doesn't
 // perform the translation (use -kwxTRANSLATE with xgettext!)
 #define wxTRANSLATE(str) str
@@ -79,6 +90,8 @@ class WXDLLIMPEXP_FWD_BASE wxLocale;
 class wxPluralFormsCalculator;
 using wxPluralFormsCalculatorPtr = std::unique_ptr<wxPluralFormsCalculator>;
 
+class wxMsgCatalogFile;
+
 // ----------------------------------------------------------------------------
 // wxMsgCatalog corresponds to one loaded message catalog.
 // ----------------------------------------------------------------------------
@@ -108,6 +121,9 @@ protected:
     wxMsgCatalog(const wxString& domain);
 
 private:
+    // use the loaded catalog file, taking its ownership if necessary
+    bool Init(std::unique_ptr<wxMsgCatalogFile>& file);
+
     // variable pointing to the next element in a linked list (or nullptr)
     wxMsgCatalog *m_pNext;
     friend class wxTranslations;
@@ -115,6 +131,10 @@ private:
     wxTranslationsHashMap   m_messages; // all messages in the catalog
     wxString                m_domain;   // name of the domain
 
+    // the catalog file used for looking up the messages on demand if it has
+    // a hash table, m_messages is not used at all then
+    std::unique_ptr<wxMsgCatalogFile> m_file;
+
     wxPluralFormsCalculatorPtr m_pluralFormsCalculator;
 };
 
@@ -184,7 +204,14 @@ public:
     // string, it needs to have a copy of it somewhere
     static const wxString& GetUntranslatedString(const wxString& str);
 
+    // return the number incremented whenever the strings returned by
+    // wxGetTranslation() may change, used by wxGETTEXT_CACHED()
+    static unsigned GetGeneration();
+
 private:
+    // invalidate all the translations cached by wxGETTEXT_CACHED()
+    static void TranslationsChanged();
+
     enum class Translations
     {
       NotNeeded = -1,
@@ -478,6 +505,31 @@ inline const wxString& wxGettextInContextPluralWrapper(const char *ctx,
 
 #endif // wxNO_REQUIRE_LITERAL_MSGIDS
 
+// Helper class used by wxGETTEXT_CACHED(): it keeps the pointer to the result
+// of wxGetTranslation(), which remains valid until the translations change.
+class wxCachedTranslation
+{
+public:
+    template<size_t N, typename T>
+    const wxString& Get(const T (&msg)[N])
+    {
+        const unsigned generation = wxTranslations::GetGeneration();
+        if ( generation != m_generation )
+        {
+            m_translation = &wxGetTranslation(wxTRANS_INPUT_STR(msg));
+            m_generation = generation;
+        }
+
+        return *m_translation;
+    }
+
+private:
+    // 0 is never used as generation, so the translation is retrieved on the
+    // first call to Get().
+    unsigned m_generation = 0;
+    const wxString* m_translation = nullptr;
+};
+
 #else // !wxUSE_INTL
 
 // the macros should still be defined - otherwise compilation would fail
@@ -493,6 +545,7 @@ inline const wxString& wxGettextInContextPluralWrapper(const char *ctx,
     #define wxPLURAL(sing, plur, n)  ((n) == 1 ? (sing) : (plur))
     #define wxGETTEXT_IN_CONTEXT(c, s)                     (s)
     #define wxGETTEXT_IN_CONTEXT_PLURAL(c, sing, plur, n)  wxPLURAL(sing, plur, n)
+    #define wxGETTEXT_CACHED(s)                            _(s)
 #endif
 
 #define wxTRANSLATE(str) str
@@ -130,6 +130,8 @@ static const int wxTREE_ITEMSTATE_PREV  = -3;   // cycle to the previous state
 
 #define wxTR_FULL_ROW_HIGHLIGHT      0x2000     // highlight full horz space
 
+#define wxTR_VIRTUAL                 0x4000     // labels provided on demand
+
 // make the default control appearance look more native-like depending on the
 // platform
 #if defined(__WXGTK__)
@@ -214,6 +214,11 @@ public:
     int CompareStrings(const wxString& lhs, const wxString& rhs,
                        int flags = wxCompare_CaseSensitive) const;
 
+    // Returns the key which can be compared byte by byte with the keys of the
+    // other strings to order them in the same way as CompareStrings() does.
+    std::string GetSortKey(const wxString& str,
+                           int flags = wxCompare_CaseSensitive) const;
+
     // Note that this class is not supposed to be used polymorphically, hence
     // its dtor is not virtual.
     ~wxUILocale();
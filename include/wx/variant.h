@@ -27,6 +27,8 @@
 
 #include "wx/iosfwrap.h"
 
+#include <atomic>
+
 class wxAny;
 
 /*
@@ -105,6 +107,7 @@ public:
     wxVariant();
 
     wxVariant(const wxVariant& variant);
+    wxVariant(wxVariant&& variant) noexcept;
     wxVariant(wxVariantData* data, const wxString& name = wxEmptyString);
 #if wxUSE_ANY
     wxVariant(const wxAny& any);
@@ -113,6 +116,7 @@ public:
 
     // generic assignment
     void operator= (const wxVariant& variant);
+    void operator= (wxVariant&& variant) noexcept;
 
     // Assignment using data, e.g.
     // myVariant = new wxStringVariantData("hello");
@@ -130,14 +134,35 @@ public:
 
     // For compatibility with wxWidgets <= 2.6, this doesn't increase
     // reference count.
+    //
+    // Notice that if the data is stored inline, the returned pointer must
+    // still be usable, after incrementing its reference count, for longer
+    // than this variant exists, so the non-const overload moves the data to
+    // the heap while the const one returns its copy allocated on the heap,
+    // without modifying the variant itself.
+    wxVariantData* GetData()
+    {
+        if ( m_inlineKind != Kind_Other )
+            MoveDataToHeap();
+
+        return (wxVariantData*) m_refData;
+    }
+
     wxVariantData* GetData() const
     {
+        if ( m_inlineKind != Kind_Other )
+            return GetHeapCopy();
+
         return (wxVariantData*) m_refData;
     }
     void SetData(wxVariantData* data) ;
 
     // make a 'clone' of the object
-    void Ref(const wxVariant& clone) { wxObject::Ref(clone); }
+    void Ref(const wxVariant& clone);
+
+    // release the data: this hides wxObject::UnRef() which must not be used
+    // with wxVariant as its data may be stored inline
+    void UnRef();
 
     // ensure that the data is exclusive to this variant, and not shared
     bool Unshare();
@@ -384,6 +409,73 @@ protected:
     wxString        m_name;
 
 private:
+    // The kinds of the data of the built-in types: the data of these types
+    // is stored directly in wxVariant itself, without allocating it on the
+    // heap, if it fits into m_inlineData.
+    enum DataKind : unsigned char
+    {
+        Kind_Other,
+        Kind_Long,
+        Kind_Double,
+        Kind_Bool,
+        Kind_Char,
+        Kind_String,
+        Kind_VoidPtr,
+        Kind_DateTime,
+        Kind_LongLong,
+        Kind_ULongLong
+    };
+
+    // Return the kind of our data, whether it's stored inline or not.
+    DataKind GetDataKind() const;
+
+    // Return the data without moving it to the heap, unlike GetData().
+    wxVariantData* DoGetData() const { return (wxVariantData*) m_refData; }
+
+    // Return the data for changing it in place.
+    wxVariantData* DoGetMutableData()
+    {
+        ReleaseHeapCopy();
+
+        return DoGetData();
+    }
+
+    // Replace the inline data with its copy allocated on the heap.
+    void MoveDataToHeap();
+
+    // Return the copy of the inline data returned by GetData() const,
+    // creating it if necessary, and release it when the data changes.
+    wxVariantData* GetHeapCopy() const;
+    void ReleaseHeapCopy();
+
+    // Construct the data of the given type inline, the existing data must
+    // have been already released.
+    template <typename T, typename V>
+    void DoSetInline(DataKind kind, const V& value);
+
+    // Copy the inline data of another variant.
+    void DoCopyInline(const wxVariant& variant);
+
+    // Buffer used for the inline data: it is big enough to store
+    // wxVariantData for all the built-in scalar types and short strings.
+    union InlineData
+    {
+        void* m_ptr;
+        double m_double;
+        wxLongLong_t m_longlong;
+        unsigned char m_buffer[sizeof(wxObjectRefData) + sizeof(wxString)];
+    };
+
+    InlineData      m_inlineData;
+
+    // Kind of the data stored in m_inlineData or Kind_Other if m_refData is
+    // allocated on the heap (or null).
+    DataKind        m_inlineKind = Kind_Other;
+
+    // Copy of the inline data allocated on the heap by GetData() const, if
+    // any: it is atomic as this can be done by several threads at once.
+    mutable std::atomic<wxVariantData*> m_heapCopy{nullptr};
+
     wxDECLARE_DYNAMIC_CLASS(wxVariant);
 };
 
@@ -275,6 +275,11 @@ public:
     /**
         Sorts the array in alphabetical order or in reverse alphabetical order if
         @a reverseOrder is @true. The sort is case-sensitive.
+
+        Since wxWidgets 3.3.3, big arrays are sorted using several threads if
+        multiple CPUs are available and wxUSE_THREADS is on. Notice that this
+        is not the case for the overload taking a comparison function, as it
+        is not required to be thread-safe.
     */
     void Sort(bool reverseOrder = false);
 
@@ -305,6 +310,11 @@ public:
 
         array.Sort(CompareStringLen);
         @endcode
+
+        Notice that sorting using wxCmpNaturalGeneric(), or wxCmpNatural() if
+        @c wxHAS_GENERIC_CMP_NATURAL is defined, is optimized to compute the
+        sort key of each string only once, see wxGetNaturalSortKey(), and is
+        much faster than sorting using a custom function calling it.
     */
     void Sort(CompareFunction compareFunction);
 
@@ -379,6 +389,9 @@ public:
 
         Constructs a sorted array with the same contents as the (possibly
         unsorted) @a array argument.
+
+        This is much more efficient than adding the elements of @a array one
+        by one when it is big.
     */
     wxSortedArrayString(const wxArrayString& array);
 
@@ -561,6 +574,122 @@ int wxCmpNatural(const wxString& s1, const wxString& s2);
 */
 int wxCmpNaturalGeneric(const wxString& s1, const wxString& s2);
 
+/**
+    Returns the key which can be used to sort strings in natural order.
+
+    The keys returned by this function can be compared with each other using
+    simple byte comparison, e.g. @c std::string::compare() or @c memcmp(),
+    and the result of this comparison is the same as the result of calling
+    wxCmpNaturalGeneric() for the original strings. As computing the key is
+    more expensive than comparing the strings once, but comparing the keys is
+    much cheaper, this is useful when the same strings are compared many
+    times, e.g. when sorting a big number of them. For example, the keys of
+    all items can be computed before calling wxListCtrl::SortItems() and
+    compared in the sort callback, instead of calling wxCmpNatural() there.
+
+    If @c wxHAS_GENERIC_CMP_NATURAL is defined, wxCmpNatural() is the same
+    as wxCmpNaturalGeneric() and so the keys can also be used instead of it.
+    Otherwise, i.e. under MSW and macOS, wxCmpNatural() uses the OS native
+    function whose results may differ from the order of the keys.
+
+    Notice that the keys depend on the current C locale, used by
+    wxCmpNaturalGeneric() for comparing strings, and so should not be stored
+    or compared with the keys computed using a different locale.
+
+    @see wxUILocale::GetSortKey()
+
+    @since 3.3.3
+*/
+std::string wxGetNaturalSortKey(const wxString& s);
+
+/**
+    @class wxStringSearchIndex
+
+    Index allowing to quickly find all strings in a fixed array starting with
+    the given prefix or containing the given substring.
+
+    This class is useful for implementing auto-completion or filtering of big
+    lists of strings. Building the index takes O(N log N) time, after which
+    FindPrefix() takes only O(log N) time, plus the time needed to return the
+    results. FindSubstring() still has to check all the strings, but skips
+    most of them without comparing them with the substring.
+
+    Example:
+    @code
+        // Create case-insensitive index.
+        wxStringSearchIndex index(fileNames, false);
+
+        for ( size_t n : index.FindPrefix(userInput) )
+            AddMatch(index.GetString(n));
+    @endcode
+
+    @library{wxbase}
+    @category{containers}
+
+    @see wxArrayString, wxTextEntry::AutoComplete()
+
+    @since 3.3.3
+*/
+class wxStringSearchIndex
+{
+public:
+    /**
+        Default constructor creates an empty index.
+
+        Use Set() to fill it later.
+     */
+    wxStringSearchIndex();
+
+    /**
+        Constructor creating the index for the given strings.
+
+        Calls Set() with the same parameters.
+     */
+    explicit wxStringSearchIndex(const wxArrayString& strings,
+                                 bool caseSensitive = true);
+
+    /**
+        Builds the index for the given strings.
+
+        The index stores a copy of the strings, so @a strings may be changed
+        or destroyed after calling this function.
+
+        @param strings The strings to search in.
+        @param caseSensitive If @false, the strings are compared with the
+            prefix or substring after converting all of them to lower case.
+     */
+    void Set(const wxArrayString& strings, bool caseSensitive = true);
+
+    /// Returns the number of strings in the index.
+    size_t GetCount() const;
+
+    /**
+        Returns the string with the given index.
+
+        The indices are the same as in the array passed to Set().
+     */
+    const wxString& GetString(size_t n) const;
+
+    /// Returns all the strings in the index in their original order.
+    const wxArrayString& GetStrings() const;
+
+    /**
+        Returns the indices of all strings starting with the given prefix.
+
+        The indices are returned in increasing order. If @a prefix is empty,
+        the indices of all strings are returned.
+     */
+    std::vector<size_t> FindPrefix(const wxString& prefix) const;
+
+    /**
+        Returns the indices of all strings containing the given substring.
+
+        The indices are returned in increasing order. If @a substring is
+        empty, the indices of all strings are returned.
+     */
+    std::vector<size_t> FindSubstring(const wxString& substring) const;
+};
+
 
 // ============================================================================
 // Global functions/macros
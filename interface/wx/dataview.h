@@ -295,6 +295,37 @@ public:
     */
     virtual bool HasDefaultCompare() const;
 
+    /**
+        Override this to indicate that the model uses the default Compare()
+        implementation.
+
+        If this function returns @true, the generic wxDataViewCtrl
+        implementation retrieves the values used for sorting only once for
+        each item and compares them using CompareValues() instead of calling
+        Compare() for each pair of items, which is significantly faster when
+        sorting many items.
+
+        The base class version returns @false, as the control can't know
+        whether Compare() is overridden in the derived class. Don't override
+        this function to return @true if Compare() is overridden, but
+        overriding DoCompareValues() is fine. Notice that wxDataViewListStore,
+        used by wxDataViewListCtrl, does override it to return @true.
+
+        @since 3.3.3
+    */
+    virtual bool UsesDefaultCompare() const;
+
+    /**
+        Compare two values as the default Compare() implementation does.
+
+        This function compares the values of all standard types and calls
+        DoCompareValues() for the values of other types. Unlike Compare(), it
+        returns 0 if the values are equal and only handles the ascending order.
+
+        @since 3.3.3
+    */
+    int CompareValues(const wxVariant& value1, const wxVariant& value2) const;
+
     /**
         Return true if there is a value in the given column of this item.
 
@@ -3572,6 +3603,17 @@ public:
     */
     virtual bool SetValueByRow( const wxVariant &value,
                            unsigned int row, unsigned int col );
+
+    /**
+        Overridden from wxDataViewModel to return @true, as this class uses
+        the default Compare() implementation.
+
+        Notice that if a class deriving from this one overrides Compare(), it
+        must also override this function to return @false.
+
+        @since 3.3.3
+    */
+    virtual bool UsesDefaultCompare() const;
 };
 
 
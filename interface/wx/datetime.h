@@ -1676,6 +1676,142 @@ const wxDateTime wxDefaultDateTime;
 #define wxInvalidDateTime wxDefaultDateTime
 
 
+/**
+    @class wxDateTimeFormatter
+
+    Helper class for formatting many dates using the same format string.
+
+    wxDateTime::Format() has to parse the format string each time it is
+    called, which is wasteful when formatting many dates, e.g. when filling a
+    list control with them. This class parses the format once, when it is
+    constructed, and also caches the week day and month names and the AM/PM
+    strings used by it, so that formatting a date can be done without any
+    memory allocations at all when using the overload taking a buffer.
+
+    The results are always the same as those of wxDateTime::Format() called
+    with the same format: in fact, the format specifications which depend on
+    the current locale in a more complicated way, such as @c %c or @c %x, or
+    which use explicit width or flags, are simply formatted using it.
+
+    Notice that the cached names are those of the locale current when the
+    formatter is created, so it should be recreated if the locale changes.
+
+    Example of using this class:
+    @code
+    const wxDateTimeFormatter formatter("%Y-%m-%d %H:%M");
+
+    wxString s;
+    for ( const wxDateTime& dt : dates )
+    {
+        s.clear();
+        formatter.FormatTo(s, dt);
+        ...
+    }
+    @endcode
+
+    @library{wxbase}
+    @category{data}
+
+    @since 3.3.3
+*/
+class wxDateTimeFormatter
+{
+public:
+    /**
+        Constructor taking the format to use.
+
+        The format has the same meaning as for wxDateTime::Format() and must
+        not be empty.
+    */
+    explicit wxDateTimeFormatter(const wxString& format = wxDefaultDateTimeFormat);
+
+    /**
+        Format the date into the provided buffer.
+
+        The buffer is always NUL-terminated, unless @a size is 0, and the
+        output is truncated if it doesn't fit into it.
+
+        @return The length of the full output, not counting the trailing NUL.
+            If it is greater or equal to @a size, the output was truncated.
+    */
+    size_t Format(const wxDateTime& dt,
+                  wxChar *buf,
+                  size_t size,
+                  const wxDateTime::TimeZone& tz = wxDateTime::Local) const;
+
+    /**
+        Append the formatted date to the given string.
+
+        Reusing the same string for formatting many dates avoids allocating
+        memory for each of them.
+    */
+    void FormatTo(wxString& str,
+                  const wxDateTime& dt,
+                  const wxDateTime::TimeZone& tz = wxDateTime::Local) const;
+
+    /**
+        Return the formatted date.
+
+        This is equivalent to wxDateTime::Format() with the format specified
+        in the constructor.
+    */
+    wxString Format(const wxDateTime& dt,
+                    const wxDateTime::TimeZone& tz = wxDateTime::Local) const;
+};
+
+/**
+    @class wxDateTimeParser
+
+    Helper class for parsing many dates using the same format string.
+
+    This class is similar to wxDateTimeFormatter, but is used for parsing
+    instead of formatting: it parses the format once, when it is constructed,
+    and caches the localized names used by it, and can then be used to parse
+    many dates in exactly the same way as wxDateTime::ParseFormat() does.
+
+    If the format contains the specifications depending on the locale in a
+    more complicated way, such as @c %c or @c %x, or the time zone ones, this
+    class simply uses wxDateTime::ParseFormat() for parsing.
+
+    @library{wxbase}
+    @category{data}
+
+    @since 3.3.3
+*/
+class wxDateTimeParser
+{
+public:
+    /**
+        Constructor taking the format to use.
+
+        The format has the same meaning as for wxDateTime::ParseFormat() and
+        must not be empty.
+    */
+    explicit wxDateTimeParser(const wxString& format = wxDefaultDateTimeFormat);
+
+    /**
+        Parse the date using the format specified in the constructor.
+
+        @param date
+            The string to parse.
+        @param dt
+            The object to set to the parsed date.
+        @param dateDef
+            Used to fill in the date components not specified in the format,
+            see wxDateTime::ParseFormat().
+        @param end
+            If non-null, filled with the position of the first character not
+            parsed. If it is null, the entire string must be parsed for this
+            function to succeed.
+        @return @true if the date was parsed successfully, @false otherwise.
+    */
+    bool Parse(const wxString& date,
+               wxDateTime& dt,
+               const wxDateTime& dateDef = wxDefaultDateTime,
+               wxString::const_iterator *end = nullptr) const;
+};
+
+
 /**
     @class wxDateTimeWorkDays
 
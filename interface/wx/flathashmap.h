@@ -0,0 +1,229 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        flathashmap.h
+// Purpose:     interface of wxFlatHashMap and wxFlatHashSet
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    Hash map using open addressing.
+
+    This class provides a subset of std::unordered_map API, but stores all the
+    elements in a single contiguous array instead of allocating a separate
+    node for each of them. This makes inserting elements much cheaper and
+    lookups faster, especially for small keys and values, at the price of
+    weaker iterator and reference validity guarantees: inserting or erasing
+    an element invalidates all iterators, pointers and references to the
+    other elements of the map (except for the iterator returned by erase()).
+
+    Notice that, unlike with std::unordered_map, value_type of this class is
+    @c std::pair<Key,T> and not @c std::pair<const Key,T>, because the
+    elements need to be movable. The key of an element must still never be
+    modified.
+
+    The elements must be move-constructible and move-assignable.
+
+    Example:
+    @code
+        WX_DECLARE_FLAT_HASH_MAP(int, wxString, wxIntegerHash, wxIntegerEqual,
+                                 MyFlatHashMap);
+
+        MyFlatHashMap map;
+        map[17] = "seventeen";
+        map.insert(std::make_pair(42, wxString("forty two")));
+
+        for ( auto it = map.begin(); it != map.end(); )
+        {
+            if ( it->first % 2 )
+                it = map.erase(it); // This is safe.
+            else
+                ++it;
+        }
+    @endcode
+
+    @section flathashmap_declaring Declaring new flat hash map types
+
+    The following macros can be used instead of the corresponding
+    WX_DECLARE_XXX_HASH_MAP() ones (see wxHashMap) to declare a class using
+    open addressing. They take the same parameters:
+
+    @code
+        WX_DECLARE_FLAT_HASH_MAP(KEY_T, VALUE_T, HASH_T, KEY_EQ_T, CLASSNAME);
+        WX_DECLARE_FLAT_STRING_HASH_MAP(VALUE_T, CLASSNAME);
+        WX_DECLARE_FLAT_VOIDPTR_HASH_MAP(VALUE_T, CLASSNAME);
+        WX_DECLARE_FLAT_HASH_SET(KEY_T, HASH_T, KEY_EQ_T, CLASSNAME);
+    @endcode
+
+    As usual, the existing code can switch to using them only if it doesn't
+    rely on the elements never being moved in memory.
+
+    @library{wxbase}
+    @category{containers}
+
+    @see wxFlatHashSet, wxHashMap
+
+    @since 3.3.3
+*/
+template <typename Key, typename T,
+          typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class wxFlatHashMap
+{
+public:
+    typedef Key key_type;
+    typedef T mapped_type;
+    typedef std::pair<Key, T> value_type;
+    typedef Hash hasher;
+    typedef KeyEqual key_equal;
+    typedef size_t size_type;
+
+    /// Forward iterator.
+    class iterator;
+
+    /// Forward iterator which can't be used to modify the elements.
+    class const_iterator;
+
+    /**
+        Creates an empty map, optionally reserving space for at least @a n
+        elements.
+
+        Unlike with the other containers, no memory is allocated if @a n is 0.
+     */
+    explicit wxFlatHashMap(size_type n = 0,
+                           const hasher& hf = hasher(),
+                           const key_equal& eq = key_equal());
+
+    /// Copy constructor.
+    wxFlatHashMap(const wxFlatHashMap& other);
+
+    /// Move constructor.
+    wxFlatHashMap(wxFlatHashMap&& other) noexcept;
+
+    /// Assignment operator.
+    wxFlatHashMap& operator=(const wxFlatHashMap& other);
+
+    /// Move assignment operator.
+    wxFlatHashMap& operator=(wxFlatHashMap&& other) noexcept;
+
+    /// Swaps the contents of this map with another one.
+    void swap(wxFlatHashMap& other) noexcept;
+
+    /// Returns the number of elements in the map.
+    size_type size() const;
+
+    /// Returns true if the map is empty.
+    bool empty() const;
+
+    /// Returns the number of the slots which can be used by the elements.
+    size_type bucket_count() const;
+
+    //@{
+    /// Iterators over all elements, in unspecified order.
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    //@}
+
+    /**
+        Removes all elements from the map.
+
+        Note that this doesn't free the memory used by the map.
+     */
+    void clear();
+
+    /**
+        Ensures that at least @a n elements can be stored in the map without
+        reallocating it.
+     */
+    void reserve(size_type n);
+
+    //@{
+    /// Returns the iterator to the element with the given key or end().
+    iterator find(const key_type& key);
+    const_iterator find(const key_type& key) const;
+    //@}
+
+    /// Returns 1 if the element with the given key is present or 0 otherwise.
+    size_type count(const key_type& key) const;
+
+    /// Returns true if the element with the given key is present.
+    bool contains(const key_type& key) const;
+
+    /**
+        Returns the reference to the value with the given key, inserting a
+        default-constructed value if there is none yet.
+     */
+    mapped_type& operator[](const key_type& key);
+
+    //@{
+    /**
+        Returns the reference to the existing value with the given key.
+
+        Throws @c std::out_of_range if the key is not present, just as
+        @c std::unordered_map::at() does. If exceptions are disabled, the
+        program is aborted instead.
+     */
+    mapped_type& at(const key_type& key);
+    const mapped_type& at(const key_type& key) const;
+    //@}
+
+    //@{
+    /**
+        Inserts the value if there is no element with the same key yet.
+
+        Returns the pair of the iterator to the element with the given key and
+        the flag which is true if it was inserted or false if it already
+        existed.
+     */
+    std::pair<iterator, bool> insert(const value_type& value);
+    std::pair<iterator, bool> insert(value_type&& value);
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args);
+    //@}
+
+    /// Inserts all values in the given range.
+    template <typename InputIterator>
+    void insert(InputIterator first, InputIterator last);
+
+    //@{
+    /**
+        Erases the element at the given position.
+
+        Returns the iterator to the next element, which makes it possible to
+        erase elements while iterating over the map.
+     */
+    iterator erase(const_iterator it);
+    iterator erase(iterator it);
+    //@}
+
+    /// Erases the element with the given key and returns 1 or returns 0 if
+    /// there was no such element.
+    size_type erase(const key_type& key);
+};
+
+/**
+    Hash set using open addressing.
+
+    This class is similar to wxFlatHashMap, but stores only the keys. It
+    provides the same member functions except for operator[]() and at().
+
+    @library{wxbase}
+    @category{containers}
+
+    @see wxFlatHashMap, wxHashSet
+
+    @since 3.3.3
+*/
+template <typename Key,
+          typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class wxFlatHashSet
+{
+public:
+    typedef Key key_type;
+    typedef Key value_type;
+    typedef Hash hasher;
+    typedef KeyEqual key_equal;
+    typedef size_t size_type;
+};
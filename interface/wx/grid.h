@@ -1943,6 +1943,158 @@ public:
     wxString GetCornerLabelValue() const;
 };
 
+/**
+    Data table storing the values of each column in a vector of the column type.
+
+    Unlike wxGridStringTable, which stores all the values as strings, this
+    table stores the values of the columns of @c wxGRID_VALUE_NUMBER,
+    @c wxGRID_VALUE_FLOAT and @c wxGRID_VALUE_BOOL types directly as 64-bit
+    integers, doubles and bits respectively, which is much more compact for
+    the big tables of numbers and allows wxGridCellNumberRenderer,
+    wxGridCellFloatRenderer and wxGridCellBoolRenderer, which are used by
+    default for the columns of these types, to avoid any conversions from
+    string. The values of @c wxGRID_VALUE_STRING columns, which is the type of
+    all columns by default, are stored as indices into a per-column dictionary
+    containing a single copy of each distinct string.
+
+    Empty cells are supported in string, integer and floating point columns,
+    but not in the boolean ones. CanGetValueAs() returns @false for the empty
+    cells for all types other than @c wxGRID_VALUE_STRING, so that they're
+    shown as empty by the renderers.
+
+    @since 3.3.3
+ */
+class wxGridTypedTable : public wxGridTableBase
+{
+public:
+    /**
+        Default constructor creates an empty table.
+     */
+    wxGridTypedTable();
+
+    /**
+        Constructor taking number of rows and columns.
+
+        All columns are initially of @c wxGRID_VALUE_STRING type.
+
+        Notice that the cells of the string, integer and floating point
+        columns can be empty, which is the case for all cells of the newly
+        created or inserted columns and rows and for the cells set to an empty
+        or invalid string using SetValue(). The empty cells are returned as
+        empty strings by GetValue() and as 0 by GetValueAsLong() and
+        GetValueAsDouble().
+     */
+    wxGridTypedTable( int numRows, int numCols );
+
+    /**
+        Changes the type of the given column.
+
+        The existing values are converted to the new type.
+
+        @param col
+            The index of the column.
+        @param typeName
+            One of @c wxGRID_VALUE_STRING, @c wxGRID_VALUE_NUMBER,
+            @c wxGRID_VALUE_FLOAT or @c wxGRID_VALUE_BOOL.
+        @return @true if the type was changed or @false if the arguments
+            were invalid.
+     */
+    bool SetColType( int col, const wxString& typeName );
+
+    /**
+        Returns the type of the given column.
+     */
+    wxString GetColType( int col ) const;
+
+    /**
+        Sets all the values of the given column at once.
+
+        The type of the column is changed to the type corresponding to the
+        values: @c wxGRID_VALUE_STRING, @c wxGRID_VALUE_NUMBER,
+        @c wxGRID_VALUE_FLOAT or @c wxGRID_VALUE_BOOL respectively.
+
+        The number of values must be equal to the number of rows.
+     */
+    //@{
+    bool SetColValues( int col, const std::vector<wxString>& values );
+    bool SetColValues( int col, const std::vector<wxLongLong_t>& values );
+    bool SetColValues( int col, const std::vector<double>& values );
+    bool SetColValues( int col, const std::vector<bool>& values );
+    //@}
+
+    /**
+        Retrieves all the values of the given column at once.
+
+        Returns @false if the column type doesn't correspond to the type of
+        the values, see SetColValues().
+
+        The empty cells of integer columns are returned as 0 and those of the
+        floating point columns as NaN.
+     */
+    //@{
+    bool GetColValues( int col, std::vector<wxString>& values ) const;
+    bool GetColValues( int col, std::vector<wxLongLong_t>& values ) const;
+    bool GetColValues( int col, std::vector<double>& values ) const;
+    bool GetColValues( int col, std::vector<bool>& values ) const;
+    //@}
+
+    /**
+        Reorders all the rows of the table by the values in the given column.
+
+        The sort is stable, i.e. the rows with equal values in this column
+        keep their relative order. Empty values are considered greater than
+        all the other ones in integer and floating point columns.
+
+        Notice that the row labels and attributes are not reordered and that
+        the grid using the table is not refreshed, call wxGrid::ForceRefresh()
+        to do it.
+
+        This function can be called from wxEVT_GRID_COL_SORT handler.
+     */
+    void SortByCol( int col, bool ascending = true );
+
+    virtual int GetNumberRows();
+    virtual int GetNumberCols();
+    virtual wxString GetValue( int row, int col );
+    virtual void SetValue( int row, int col, const wxString& s );
+
+    virtual bool IsEmptyCell( int row, int col );
+
+    virtual wxString GetTypeName( int row, int col );
+    virtual bool CanGetValueAs( int row, int col, const wxString& typeName );
+
+    /**
+        Returns the value of the cell as long.
+
+        As the values in the integer columns are 64-bit, they are clamped to
+        the range of @c long if it is smaller. Use GetColValues() to retrieve
+        the full values.
+     */
+    virtual long GetValueAsLong( int row, int col );
+
+    virtual double GetValueAsDouble( int row, int col );
+    virtual bool GetValueAsBool( int row, int col );
+
+    virtual void SetValueAsLong( int row, int col, long value );
+    virtual void SetValueAsDouble( int row, int col, double value );
+    virtual void SetValueAsBool( int row, int col, bool value );
+
+    void Clear();
+    bool InsertRows( size_t pos = 0, size_t numRows = 1 );
+    bool AppendRows( size_t numRows = 1 );
+    bool DeleteRows( size_t pos = 0, size_t numRows = 1 );
+    bool InsertCols( size_t pos = 0, size_t numCols = 1 );
+    bool AppendCols( size_t numCols = 1 );
+    bool DeleteCols( size_t pos = 0, size_t numCols = 1 );
+
+    void SetRowLabelValue( int row, const wxString& );
+    void SetColLabelValue( int col, const wxString& );
+    void SetCornerLabelValue( const wxString& );
+    wxString GetRowLabelValue( int row );
+    wxString GetColLabelValue( int col );
+    wxString GetCornerLabelValue() const;
+};
+
 /**
     Represents coordinates of a grid cell.
 
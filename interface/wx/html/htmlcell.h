@@ -784,7 +784,22 @@ public:
 class wxHtmlWordCell : public wxHtmlCell
 {
 public:
+    /**
+        Constructor measuring the word using the font currently selected
+        into the given DC.
+    */
     wxHtmlWordCell(const wxString& word, const wxDC& dc);
+
+    /**
+        Constructor for a word whose extent is already known.
+
+        This is more efficient than the other constructor when the same word
+        is used many times with the same font, as it avoids measuring it again.
+
+        @since 3.3.3
+    */
+    wxHtmlWordCell(const wxString& word,
+                   wxCoord width, wxCoord height, wxCoord descent);
 };
 
 
@@ -109,6 +109,10 @@ public:
         - Does not automatically redraw the control, so you may need to call
           Refresh() when calling this function after control has been shown for
           the first time.
+        - When appending many properties to a control which is already shown,
+          call Freeze() before and Thaw() after doing it, so that sorting and
+          updating of the control layout happen only once and not after adding
+          every property.
         - This functions deselects selected property, if any. Validation
           failure option wxPGVFBFlags::StayInProperty is not respected, i.e.
           selection is cleared even if editor had invalid value.
@@ -54,6 +54,19 @@ enum
     */
     wxRE_NEWLINE  = 16,
 
+    /**
+        Use JIT compilation to make matching faster.
+
+        Compiling the regular expression takes longer when using this flag,
+        but matching it becomes significantly faster, so it should be used
+        for the expressions which are matched many times, or against long
+        texts. If JIT compilation is not supported by the PCRE library or on
+        the current platform, this flag is silently ignored.
+
+        @since 3.3.3
+     */
+    wxRE_JIT      = 256,
+
     /** Default flags.*/
     wxRE_DEFAULT  = wxRE_EXTENDED
 };
@@ -86,6 +99,89 @@ enum
     wxRE_NOTEMPTY = 128
 };
 
+/**
+    @class wxRegExMatch
+
+    Results of matching wxRegEx against some text.
+
+    Objects of this class are used with the wxRegEx::Matches() overloads
+    taking wxRegExMatch parameter. Unlike the other wxRegEx functions, which
+    store the results of the last match in wxRegEx object itself, these
+    overloads don't modify wxRegEx and so can be used to match the same
+    regular expression from multiple threads concurrently, provided each
+    thread uses its own wxRegExMatch.
+
+    The same wxRegExMatch object should be reused for multiple matches, as
+    this avoids allocating memory for the match results every time.
+
+    Example of finding all matches in the text without copying it:
+    @code
+    wxRegEx re("[[:digit:]]+", wxRE_JIT);
+    wxRegExMatch match;
+
+    const wxStringCharType* p = text.wx_str();
+    const wxStringCharType* const end = p + text.length();
+    while ( re.Matches(p, end, match) )
+    {
+        size_t start, len;
+        match.Get(&start, &len);
+
+        ... use the number at p + start ...
+
+        p += start + len;
+
+        // Advance by at least one character if the expression matched an
+        // empty string, as we would keep finding the same match otherwise.
+        if ( !len )
+        {
+            if ( p == end )
+                break;
+
+            ++p;
+        }
+    }
+    @endcode
+
+    @library{wxbase}
+    @category{data}
+
+    @since 3.3.3
+*/
+class wxRegExMatch
+{
+public:
+    /**
+        Default constructor creates an object not containing any matches.
+
+        Pass it to wxRegEx::Matches() to fill it.
+     */
+    wxRegExMatch();
+
+    /**
+        Returns the number of the available matches.
+
+        This is the number of the bracketed subexpressions plus one for the
+        expression itself if the last call to wxRegEx::Matches() succeeded
+        or 0 otherwise.
+     */
+    size_t GetCount() const;
+
+    /**
+        Get the start index and the length of the match of the expression
+        (if @a index is 0) or a bracketed subexpression (@a index different
+        from 0).
+
+        The start index is relative to the start of the text passed to
+        wxRegEx::Matches() and is expressed in the units of
+        wxStringCharType, i.e. it is a byte offset in UTF-8 build.
+
+        Unlike wxRegEx::GetMatch(), this function returns @false if the
+        subexpression with the given index didn't match anything, as well as
+        if @a index is out of range or the last match failed.
+     */
+    bool Get(size_t* start, size_t* len, size_t index = 0) const;
+};
+
 /**
     @class wxRegEx
 
@@ -308,6 +404,35 @@ public:
     */
     bool Matches(const wxString& text, int flags = 0) const;
 
+    ///@{
+    /**
+        Matches the precompiled regular expression against the text and
+        stores the results in the provided @a match object.
+
+        The first overload matches the text in @c [start, end) range, which
+        is not copied and doesn't need to be null-terminated. The second one
+        matches the given string, also without copying it.
+
+        Unlike the other Matches() overloads, these functions don't modify
+        this object and so may be called concurrently from multiple threads,
+        as long as each of them uses its own @a match object. Note that
+        GetMatch() can't be used after calling them, use wxRegExMatch::Get()
+        instead.
+
+        @e Flags may be combination of @c wxRE_NOTBOL, @c wxRE_NOTEOL and
+        @c wxRE_NOTEMPTY, see @ref wxRE_NOT_FLAGS.
+
+        May only be called after successful call to Compile().
+
+        @since 3.3.3
+    */
+    bool Matches(const wxStringCharType* start,
+                 const wxStringCharType* end,
+                 wxRegExMatch& match,
+                 int flags = 0) const;
+    bool Matches(const wxString& text, wxRegExMatch& match, int flags = 0) const;
+    ///@}
+
     /**
         Replaces the current regular expression in the string pointed to by
         @a text, with the text in @a replacement and return number of matches
@@ -387,3 +512,145 @@ public:
     static wxVersionInfo GetLibraryVersionInfo();
 };
 
+/**
+    @class wxRegExSet
+
+    wxRegExSet allows to match several regular expressions in a single pass.
+
+    This is more efficient than matching several wxRegEx objects against the
+    same text one after another, as the text is scanned only once. Use this
+    class when the text needs to be checked for many patterns, e.g. when
+    classifying or highlighting the lines of a log file:
+
+    @code
+    wxRegExSet set;
+    set.Add("error|fatal", wxRE_ICASE);     // pattern 0
+    set.Add("warn(ing)?", wxRE_ICASE);      // pattern 1
+    set.Add("[[:digit:]]{2}:[[:digit:]]{2}:[[:digit:]]{2}"); // pattern 2
+    if ( !set.Compile(wxRE_JIT) )
+        ... handle error ...
+
+    wxVector<wxRegExSet::Match> matches;
+    set.FindAll(line, matches);
+    for ( const auto& m : matches )
+    {
+        ... highlight [m.start, m.start + m.len) using m.pattern style ...
+    }
+    @endcode
+
+    Internally all patterns are combined into a single regular expression
+    using them as alternatives, so if more than one pattern matches at the
+    same position, only the match of the pattern added first is reported.
+
+    Patterns using back references can't be used in a set.
+
+    @library{wxbase}
+    @category{data}
+
+    @since 3.3.3
+*/
+class wxRegExSet
+{
+public:
+    /**
+        Describes a single match found by FindAll().
+     */
+    struct Match
+    {
+        size_t pattern;     ///< Index of the pattern which matched.
+        size_t start;       ///< Offset of the match in the text.
+        size_t len;         ///< Length of the match.
+    };
+
+    /**
+        Default constructor creates an empty set.
+
+        Use Add() to add patterns to it and then Compile() it.
+     */
+    wxRegExSet();
+
+    /**
+        Adds a pattern to the set.
+
+        The pattern is checked for validity, with an error being logged if it
+        is invalid, but the set must be compiled again using Compile() after
+        adding all the patterns to it before it can be used.
+
+        @param pattern The regular expression to add.
+        @param flags Combination of ::wxRE_BASIC, ::wxRE_ICASE and
+            ::wxRE_NEWLINE.
+        @return Index of the pattern in the set or @c wxNOT_FOUND if it is
+            invalid or uses back references.
+     */
+    int Add(const wxString& pattern, int flags = wxRE_DEFAULT);
+
+    /**
+        Returns the number of patterns in the set.
+     */
+    size_t GetCount() const;
+
+    /**
+        Compiles all patterns in the set into a single matcher.
+
+        @param flags May be ::wxRE_JIT to use JIT compilation.
+        @return @true if compiled successfully or @false otherwise, in which
+            case an error is logged.
+     */
+    bool Compile(int flags = 0);
+
+    /**
+        Returns @true if Compile() had been called successfully after the
+        last call to Add().
+     */
+    bool IsValid() const;
+
+    ///@{
+    /**
+        Finds the first match of any pattern in the text.
+
+        The text is the same as for the corresponding wxRegEx::Matches()
+        overloads and these functions can also be called concurrently from
+        multiple threads, as long as each of them uses its own @a match.
+
+        @return The index of the pattern which matched or @c wxNOT_FOUND.
+     */
+    int Matches(const wxStringCharType* start,
+                const wxStringCharType* end,
+                wxRegExMatch& match,
+                int flags = 0) const;
+    int Matches(const wxString& text, wxRegExMatch& match, int flags = 0) const;
+    ///@}
+
+    /**
+        Gets the start index and the length of the match of the given pattern
+        or one of its subexpressions.
+
+        This function may only be called after Matches() returned @a pattern.
+
+        @param match The object passed to Matches().
+        @param pattern The index of the pattern which matched.
+        @param start Receives the start of the match, relative to the start
+            of the text passed to Matches().
+        @param len Receives the length of the match.
+        @param index 0 for the entire match or the index of the bracketed
+            subexpression of this pattern.
+        @return @true if successful or @false if the subexpression didn't
+            match anything or @a index is invalid.
+     */
+    bool GetMatch(const wxRegExMatch& match,
+                  size_t pattern,
+                  size_t* start,
+                  size_t* len,
+                  size_t index = 0) const;
+
+    /**
+        Finds all matches of all patterns in the text.
+
+        The text is scanned only once and the matches found are appended to
+        the provided vector in the order of their positions in the text. The
+        matches never overlap and empty matches are skipped.
+
+        @return The number of matches appended to @a matches.
+     */
+    size_t FindAll(const wxString& text, wxVector<Match>& matches) const;
+};
@@ -3620,6 +3620,21 @@ public:
     */
     virtual bool UpdateFloatingObjects(const wxRect& availableRect, wxRichTextObject* untilObj = nullptr);
 
+    /**
+        Lays out only the paragraphs in the given range, starting below the
+        preceding paragraph, and moves the following paragraphs up or down
+        without laying them out again.
+
+        This is used by wxRichTextCtrl for incremental layout and returns
+        @false, without doing anything, if the box can't be partially laid out,
+        e.g. because it has floating objects, a fixed height or vertical
+        alignment, or because it hasn't been entirely laid out yet. In this
+        case Layout() must be used instead.
+
+        @since 3.3.3
+    */
+    virtual bool LayoutParagraphs(wxReadOnlyDC& dc, wxRichTextDrawingContext& context, const wxRect& rect, const wxRichTextRange& range, int style);
+
     /**
         Get invalid range, rounding to entire paragraphs if argument is true.
     */
@@ -356,6 +356,36 @@ public:
     */
     void ForceDelayedLayout();
 
+    /**
+        Enables or disables incremental delayed layout.
+
+        If enabled, the layout of the parts of a large buffer which are not
+        visible after resizing the control is done in small steps in idle time
+        instead of all at once, keeping the first visible line at the same
+        position, so that the control remains responsive. The paragraphs which
+        haven't been laid out yet keep their previous layout in the meanwhile.
+
+        Notice that this only applies to the layout done after resizing the
+        control: loading a file or setting the value still lays out the whole
+        buffer at once.
+
+        Incremental layout is disabled by default.
+
+        @see SetDelayedLayoutThreshold()
+
+        @since 3.3.3
+    */
+    void EnableIncrementalLayout(bool b);
+
+    /**
+        Returns @true if incremental delayed layout is enabled.
+
+        @see EnableIncrementalLayout()
+
+        @since 3.3.3
+    */
+    bool GetIncrementalLayout() const;
+
     /**
         Sets the text (normal) cursor.
     */
@@ -461,6 +461,9 @@ public:
     /**
         Creates catalog from MO file data in memory buffer.
 
+        If the buffer doesn't own its data, the data is copied, so it doesn't
+        need to remain valid after this function returns.
+
         @param data      Data in MO file format.
         @param domain    Catalog's domain. This typically matches
                          the @a filename.
@@ -517,6 +520,29 @@ public:
  */
 #define wxGETTEXT_IN_CONTEXT_PLURAL(context, string, plural, n)
 
+/**
+    Same as _() but caches the translation of the string.
+
+    The translation is looked up only the first time this macro is executed
+    in the given thread and then again only after the translations change,
+    i.e. after a call to wxTranslations::Set(), wxTranslations::SetLanguage()
+    or after loading a new catalog. This makes it much faster than _() and
+    it can be useful in code executed very often, e.g. in event handlers or
+    when drawing.
+
+    The argument must be a @em string @em literal and, as for the other
+    macros, @c --keyword=wxGETTEXT_CACHED option must be passed to
+    @c xgettext to extract the strings used with it.
+
+    @return A const wxString reference which remains valid until the
+        translations change.
+
+    @header{wx/intl.h}
+
+    @since 3.3.3
+ */
+#define wxGETTEXT_CACHED(string)
+
 /**
     This macro doesn't do anything in the program code -- it simply expands to
     the value of its argument.
@@ -42,6 +42,22 @@
     collapse its branches. These methods are not available in the native wxMSW
     and wxQt implementations.
 
+    The generic version also supports the virtual mode, enabled by
+    @c wxTR_VIRTUAL style, which is useful for the trees with a huge number of
+    items, e.g. when browsing a file system or a database. Note that only the
+    item labels are virtual in this mode: the items themselves are still
+    created as usual and the control doesn't query the number of children of
+    an item, so it's still necessary to call SetItemHasChildren() for the
+    items which may have children and to add them when the item is expanded,
+    typically in wxEVT_TREE_ITEM_EXPANDING handler. But the items are created
+    without any labels: instead, the labels of the items are requested from
+    OnGetItemText(), which must be overridden, only when they are needed and
+    only a limited number of them is kept in memory. The items are also
+    measured only when they are shown, so the horizontal scrollbar only takes
+    into account the items which had been already shown and, unless
+    @c wxTR_HAS_VARIABLE_ROW_HEIGHT is used, all the rows are enlarged when
+    showing an item taller than all the previously shown ones.
+
     @section treectrl_events Events
 
     To intercept events from a tree control, use the event table macros
@@ -85,6 +101,12 @@
         Use this style to cause row heights to be just big enough to fit the
         content. If not set, all rows use the largest row height. The default is
         that this flag is unset. Generic only.
+    @style{wxTR_VIRTUAL}
+        Use this style to retrieve the item labels from OnGetItemText() only
+        when they are needed, see the description of the virtual mode above.
+        Notice that the items themselves must still be created.
+        This style can't be changed after creating the control. Generic only,
+        available since wxWidgets 3.3.3.
     @style{wxTR_SINGLE}
         For convenience to document that only one item may be selected at a
         time. Selecting another item causes the current selection, if any, to be
@@ -1074,6 +1096,35 @@ public:
         @since 2.9.1
     */
     virtual void SelectChildren(const wxTreeItemId& parent);
+
+    /**
+        Returns @true if the control uses @c wxTR_VIRTUAL style.
+
+        @note This function is only available in the generic version.
+
+        @since 3.3.3
+    */
+    bool IsVirtual() const;
+
+protected:
+    /**
+        This function must be overridden in the derived class for a control
+        with @c wxTR_VIRTUAL style to return the label of the given item.
+
+        It is called whenever the label is needed, e.g. to draw or measure the
+        item or from GetItemText(), and is not already available. The returned
+        value must stay the same as long as the item is not modified, use
+        SetItemText() to notify the control about the label changes.
+
+        The labels given to the functions inserting the items or to
+        SetItemText() are used as if they were returned by this function, but
+        they are not kept in memory permanently either.
+
+        @note This function is only available in the generic version.
+
+        @since 3.3.3
+    */
+    virtual wxString OnGetItemText(const wxTreeItemId& item) const;
 };
 
 
@@ -210,6 +210,43 @@ public:
     int CompareStrings(const wxString& lhs, const wxString& rhs,
                        int flags = wxCompare_CaseSensitive) const;
 
+    /**
+        Returns the key which can be used to sort strings using this locale.
+
+        The keys can be compared using simple byte comparison, e.g.
+        @c std::string::compare() or @c memcmp(), which is much faster than
+        calling CompareStrings() and so is useful when the same strings are
+        compared many times, e.g. when sorting them. Under MSW and the
+        systems using POSIX locales, the result of comparing the keys is the
+        same as that of CompareStrings() for the original strings.
+
+        Notice that under macOS there is no way to get the sort key from the
+        system, so this function returns the key ordering the strings by their
+        Unicode code points there, which is not the same as the order used by
+        CompareStrings().
+
+        The keys are only meaningful when compared with the other keys
+        returned by this function for the same locale and using the same
+        flags and should not be stored, as they may change when the system is
+        updated.
+
+        @param str
+            The string to compute the key for.
+        @param flags
+            Can be used to specify whether the key should be case-sensitive
+            (default) or not, by specifying ::wxCompare_CaseInsensitive. As
+            with CompareStrings(), this flag is ignored under the systems
+            using POSIX locales.
+        @return
+            The sort key which may contain NUL bytes.
+
+        @see wxGetNaturalSortKey()
+
+        @since 3.3.3
+     */
+    std::string GetSortKey(const wxString& str,
+                           int flags = wxCompare_CaseSensitive) const;
+
     /**
         Get the platform-dependent name of the current locale.
 
@@ -44,6 +44,14 @@
     Note that as of wxWidgets 2.7.1, wxVariant is
     @ref overview_refcount "reference counted".
 
+    Since wxWidgets 3.3.3, the data of the built-in scalar types, i.e. bool,
+    wxUniChar, double, long, void pointer, wxDateTime, wxLongLong and
+    wxULongLong, as well as of short strings, is stored directly inside
+    wxVariant object instead of being allocated on the heap. Such data is
+    copied instead of being shared when copying the variant, which is
+    cheaper than allocating it, and is transparently copied to the heap if
+    GetData() is called.
+
     Convenience macros wxDECLARE_VARIANT_OBJECT() and wxIMPLEMENT_VARIANT_OBJECT()
     allow easily adding support for conversion to and from wxVariant to custom
     classes. The first of these macros must be used inside the class declaration
@@ -187,6 +195,15 @@ public:
     */
     wxVariant(const wxVariant& variant);
 
+    /**
+        Move constructor.
+
+        The @a variant is left null after the move.
+
+        @since 3.3.3
+    */
+    wxVariant(wxVariant&& variant) noexcept;
+
     /**
         Constructs a variant by converting it from wxAny.
     */
@@ -370,9 +387,30 @@ public:
         Returns a pointer to the internal variant data. To take ownership of
         this data, you must call its wxVariantData::IncRef() method. When you
         stop using it, wxVariantData::DecRef() must be called as well.
+
+        Note that if the data is stored inline, this function allocates its
+        copy on the heap, so it is more efficient to use the type-specific
+        accessors, such as GetLong(), to get the value. The non-const overload
+        of this function then uses this copy as the variant data, while the
+        const one doesn't modify the variant at all and returns a copy which
+        is kept until the variant value changes, so that it is safe to call
+        it from several threads at once. Notice that this means that modifying
+        the object returned by the const overload doesn't change the value of
+        the variant.
     */
     wxVariantData* GetData() const;
 
+    /**
+        Returns a pointer to the internal variant data.
+
+        This overload is the same as the const one, except that if the data is
+        stored inline, it is moved to the heap and the variant uses the
+        returned object, so that modifying it changes the variant value.
+
+        @since 3.3.3
+    */
+    wxVariantData* GetData();
+
     /**
         Returns the date value.
     */
@@ -515,6 +553,7 @@ public:
         if possible.
     */
     void operator =(const wxVariant& value);
+    void operator =(wxVariant&& value) noexcept;
     void operator =(wxVariantData* value);
     void operator =(const wxString& value);
     void operator =(const wxChar* value);
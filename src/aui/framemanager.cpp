@@ -67,6 +67,7 @@ wxDEFINE_EVENT( wxEVT_AUI_FIND_MANAGER, wxAuiManagerEvent );
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 wxIMPLEMENT_DYNAMIC_CLASS(wxAuiManagerEvent, wxEvent);
 wxIMPLEMENT_CLASS(wxAuiManager, wxEvtHandler);
@@ -350,6 +351,44 @@ void RenumberDockRows(wxAuiDockInfoPtrArray& docks)
 }
 */
 
+// Returns all the values affecting the layout computed by LayoutAll() for the
+// given panes and docks, allowing to check whether it's going to be the same
+// as a previously computed one without computing it.
+std::vector<int> GetLayoutKey(const wxAuiPaneInfoArray& panes,
+                              const wxAuiDockInfoArray& docks)
+{
+    std::vector<int> key;
+    key.reserve(panes.GetCount()*12 + docks.GetCount()*6);
+
+    for ( const auto& p : panes )
+    {
+        key.push_back(static_cast<int>(p.state));
+        key.push_back(p.dock_direction);
+        key.push_back(p.dock_layer);
+        key.push_back(p.dock_row);
+        key.push_back(p.dock_pos);
+        key.push_back(p.dock_proportion);
+        key.push_back(p.best_size.x);
+        key.push_back(p.best_size.y);
+        key.push_back(p.min_size.x);
+        key.push_back(p.min_size.y);
+        key.push_back(p.max_size.x);
+        key.push_back(p.max_size.y);
+    }
+
+    for ( const auto& d : docks )
+    {
+        key.push_back(d.dock_direction);
+        key.push_back(d.dock_layer);
+        key.push_back(d.dock_row);
+        key.push_back(d.size);
+        key.push_back(d.min_size);
+        key.push_back(d.fixed);
+    }
+
+    return key;
+}
+
 } // anonymous namespace
 
 
@@ -2339,6 +2378,29 @@ void wxAuiManager::GetPanePositionsAndSizes(wxAuiDockInfo& dock,
 }
 
 
+namespace
+{
+
+// Returns the proportion used for the pane in its dock sizer.
+int GetPaneProportion(const wxAuiPaneInfo& pane)
+{
+    // Fixed panes without the minimum size use their best size as minimum one
+    // and don't stretch.
+    if (pane.IsFixed() && pane.min_size == wxDefaultSize)
+    {
+        // Toolbars may be fixed, i.e. non-resizable, but still need to
+        // stretch if they contain stretchable spacers, so we should avoid
+        // setting their proportion to 0 in this case.
+        auto* const toolbar = wxDynamicCast(pane.window, wxAuiToolBar);
+        if (!toolbar || !toolbar->CanStretch())
+            return 0;
+    }
+
+    return pane.dock_proportion;
+}
+
+} // anonymous namespace
+
 void wxAuiManager::LayoutAddPane(wxSizer* cont,
                                  wxAuiDockInfo& dock,
                                  wxAuiPaneInfo& pane,
@@ -2363,7 +2425,7 @@ void wxAuiManager::LayoutAddPane(wxSizer* cont,
 
     // this variable will store the proportion
     // value that the pane will receive
-    int pane_proportion = pane.dock_proportion;
+    const int pane_proportion = GetPaneProportion(pane);
 
     wxBoxSizer* horz_pane_sizer = new wxBoxSizer(wxHORIZONTAL);
     wxBoxSizer* vert_pane_sizer = new wxBoxSizer(wxVERTICAL);
@@ -2479,16 +2541,7 @@ void wxAuiManager::LayoutAddPane(wxSizer* cont,
     if (pane.IsFixed())
     {
         if (min_size == wxDefaultSize)
-        {
             min_size = pane.best_size;
-
-            // Toolbars may be fixed, i.e. non-resizable, but still need to
-            // stretch if they contain stretchable spacers, so we should avoid
-            // setting their proportion to 0 in this case.
-            auto* const toolbar = wxDynamicCast(pane.window, wxAuiToolBar);
-            if (!toolbar || !toolbar->CanStretch())
-                pane_proportion = 0;
-        }
     }
 
     // We need to reset any previous set min size to allow decreasing the pane
@@ -3102,6 +3155,9 @@ void wxAuiManager::Update()
     m_hoverButton = nullptr;
     m_actionPart = nullptr;
 
+    // The layout is going to change, so the hint must be computed again.
+    m_hintLayoutKey.clear();
+
     for ( auto* minDock : m_minDocks )
     {
         if ( minDock && minDock->RealizeIfNeeded() )
@@ -3228,13 +3284,17 @@ void wxAuiManager::Update()
                 */
                 }
 
-                // update whether the pane is resizable or not
-                long style = p.frame->GetWindowStyleFlag();
+                // update whether the pane is resizable or not, but avoid
+                // doing it if nothing changes, as changing the style can be
+                // relatively expensive
+                const long oldStyle = p.frame->GetWindowStyleFlag();
+                long style = oldStyle;
                 if (p.IsFixed())
                     style &= ~wxRESIZE_BORDER;
                 else
                     style |= wxRESIZE_BORDER;
-                p.frame->SetWindowStyleFlag(style);
+                if (style != oldStyle)
+                    p.frame->SetWindowStyleFlag(style);
 
                 if (p.frame->GetLabel() != p.caption)
                     p.frame->SetLabel(p.caption);
@@ -4099,23 +4159,41 @@ wxRect wxAuiManager::CalculateHintRect(wxWindow* pane_window,
 
     panes.Add(hint);
 
-    wxSizer* sizer = LayoutAll(panes, docks, uiparts, true);
+    // Moving the mouse while dragging a pane typically results in dropping it
+    // at the same position as before, so reuse the previously computed hint
+    // rectangle if the layout doesn't change instead of recomputing it.
     wxSize client_size = m_frame->GetClientSize();
-    sizer->SetDimension(0, 0, client_size.x, client_size.y);
-    sizer->Layout();
+    std::vector<int> layoutKey = GetLayoutKey(panes, docks);
+    layoutKey.push_back(client_size.x);
+    layoutKey.push_back(client_size.y);
+    layoutKey.push_back(static_cast<int>(m_flags));
 
-    for ( auto& part : uiparts )
+    if ( layoutKey == m_hintLayoutKey )
     {
-        if (part.type == wxAuiDockUIPart::typePaneBorder &&
-            part.pane && part.pane->name == wxT("__HINT__"))
+        rect = m_hintLayoutRect;
+    }
+    else
+    {
+        wxSizer* sizer = LayoutAll(panes, docks, uiparts, true);
+        sizer->SetDimension(0, 0, client_size.x, client_size.y);
+        sizer->Layout();
+
+        for ( auto& part : uiparts )
         {
-            rect = wxRect(part.sizer_item->GetPosition(),
-                          part.sizer_item->GetSize());
-            break;
+            if (part.type == wxAuiDockUIPart::typePaneBorder &&
+                part.pane && part.pane->name == wxT("__HINT__"))
+            {
+                rect = wxRect(part.sizer_item->GetPosition(),
+                              part.sizer_item->GetSize());
+                break;
+            }
         }
-    }
 
-    delete sizer;
+        delete sizer;
+
+        m_hintLayoutKey = std::move(layoutKey);
+        m_hintLayoutRect = rect;
+    }
 
     if ( rect.IsEmpty() )
         return rect;
@@ -4777,6 +4855,92 @@ void wxAuiManager::OnLeftDown(wxMouseEvent& event)
 }
 
 /// Ends a resize action, or for live update, resizes the sash
+// Dragging a sash only changes the size of the dock or the proportions of its
+// panes, so instead of recreating all the sizers in Update(), which is too
+// slow to do on every mouse move when using live resizing, just update the
+// corresponding sizer items and lay out the existing sizers again.
+void wxAuiManager::UpdateDockLayout(wxAuiDockInfo& dock)
+{
+    wxAuiDockUIPart* dock_part = nullptr;
+    for ( auto& part : m_uiParts )
+    {
+        if (part.type == wxAuiDockUIPart::typeDock && part.dock == &dock)
+        {
+            dock_part = &part;
+            break;
+        }
+    }
+
+    wxSizer* const dock_sizer = dock_part ? dock_part->sizer_item->GetSizer()
+                                          : nullptr;
+    if (!dock_sizer || m_frame->GetSizer() == nullptr)
+    {
+        Update();
+        return;
+    }
+
+    // Pane sizers are the only sizers in the dock sizer, the other items are
+    // the sashes or spacers, so check that they still correspond to the panes
+    // before changing them.
+    std::vector<wxSizerItem*> pane_items;
+    for ( auto* item : dock_sizer->GetChildren() )
+    {
+        if (item->IsSizer())
+            pane_items.push_back(item);
+    }
+
+    if (pane_items.size() != dock.panes.GetCount())
+    {
+        Update();
+        return;
+    }
+
+    // This is done by LayoutAll() too.
+    if (dock.size < dock.min_size)
+        dock.size = dock.min_size;
+
+    if (dock.IsHorizontal())
+        dock_sizer->SetMinSize(0, dock.size);
+    else
+        dock_sizer->SetMinSize(dock.size, 0);
+
+    if (!dock.fixed)
+    {
+        for ( size_t n = 0; n < pane_items.size(); ++n )
+            pane_items[n]->SetProportion(GetPaneProportion(*dock.panes.Item(n)));
+    }
+
+    // The layout is going to change, so the hint must be computed again.
+    m_hintLayoutKey.clear();
+
+#ifdef __WXMSW__
+    wxWindowUpdateLocker noUpdates;
+    if (!HasLiveResize())
+        noUpdates.Lock(m_frame);
+#endif // __WXMSW__
+
+    // As in Update(), refresh the panes whose rectangle changes.
+    std::vector<wxRect> old_pane_rects;
+    for ( const auto& p : m_panes )
+        old_pane_rects.push_back(p.rect);
+
+    DoFrameLayout();
+
+    const int pane_count = m_panes.GetCount();
+    for ( int i = 0; i < pane_count; ++i )
+    {
+        wxAuiPaneInfo& p = m_panes.Item(i);
+        if (p.window && p.window->IsShown() && p.IsDocked() &&
+                p.rect != old_pane_rects[i])
+        {
+            p.window->Refresh();
+            p.window->Update();
+        }
+    }
+
+    Repaint();
+}
+
 bool wxAuiManager::DoEndResizeAction(wxMouseEvent& event)
 {
     // resize the dock or the pane
@@ -4845,7 +5009,7 @@ bool wxAuiManager::DoEndResizeAction(wxMouseEvent& event)
             break;
         }
 
-        Update();
+        UpdateDockLayout(*m_actionPart->dock);
     }
     else if (m_actionPart &&
         m_actionPart->type == wxAuiDockUIPart::typePaneSizer)
@@ -5013,7 +5177,7 @@ bool wxAuiManager::DoEndResizeAction(wxMouseEvent& event)
         dock.panes.Item(borrow_pane)->dock_proportion = prop_borrow;
         pane.dock_proportion = new_proportion;
 
-        Update();
+        UpdateDockLayout(dock);
     }
 
     return true;
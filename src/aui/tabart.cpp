@@ -313,6 +313,36 @@ void wxAuiTabArtBase::SetMeasuringFont(const wxFont& font)
     m_measuringFont = font;
 }
 
+wxSize
+wxAuiTabArtBase::GetMeasuringTextExtent(wxReadOnlyDC& dc,
+                                        wxWindow* wnd,
+                                        const wxString& text)
+{
+    // Don't let the cache grow indefinitely if the captions keep changing.
+    static const size_t MAX_CACHED_EXTENTS = 4096;
+
+    const wxSize dpi = wnd->GetDPI();
+    if ( m_textExtentsFont != m_measuringFont ||
+            m_textExtentsDPI != dpi ||
+                m_textExtents.size() >= MAX_CACHED_EXTENTS )
+    {
+        m_textExtents.clear();
+        m_textExtentsFont = m_measuringFont;
+        m_textExtentsDPI = dpi;
+    }
+
+    const auto it = m_textExtents.find(text);
+    if ( it != m_textExtents.end() )
+        return it->second;
+
+    dc.SetFont(m_measuringFont);
+    const wxSize extent = dc.GetTextExtent(text);
+
+    m_textExtents.emplace(text, extent);
+
+    return extent;
+}
+
 wxFont wxAuiTabArtBase::GetNormalFont() const
 {
     return m_normalFont;
@@ -800,10 +830,8 @@ wxAuiFlatTabArt::GetPageTabSize(wxReadOnlyDC& dc,
                                 const wxAuiNotebookPage& page,
                                 int* xExtent)
 {
-    dc.SetFont(m_measuringFont);
-
     // Start with the text size.
-    wxSize size = dc.GetTextExtent(page.caption);
+    wxSize size = GetMeasuringTextExtent(dc, wnd, page.caption);
 
     // Add space for the buttons, if any.
     bool firstButton = true;
@@ -1316,12 +1344,8 @@ wxSize wxAuiGenericTabArt::GetPageTabSize(
                                       const wxAuiNotebookPage& page,
                                       int* x_extent)
 {
-    wxCoord measured_textx, measured_texty;
-
-    dc.SetFont(m_measuringFont);
-    dc.GetTextExtent(page.caption, &measured_textx, nullptr);
-
-    dc.GetTextExtent(wxT("ABCDEFXj"), nullptr, &measured_texty);
+    const wxCoord measured_textx = GetMeasuringTextExtent(dc, wnd, page.caption).x;
+    const wxCoord measured_texty = GetMeasuringTextExtent(dc, wnd, wxT("ABCDEFXj")).y;
 
     // add padding around the text
     wxCoord tab_width = measured_textx;
@@ -1652,10 +1676,9 @@ wxSize wxAuiSimpleTabArt::GetTabSize(wxReadOnlyDC& dc,
                                      int close_button_state,
                                      int* x_extent)
 {
-    wxCoord measured_textx, measured_texty;
-
-    dc.SetFont(m_measuringFont);
-    dc.GetTextExtent(caption, &measured_textx, &measured_texty);
+    const wxSize measured_text = GetMeasuringTextExtent(dc, wnd, caption);
+    const wxCoord measured_textx = measured_text.x;
+    const wxCoord measured_texty = measured_text.y;
 
     wxCoord tab_height = measured_texty + wnd->FromDIP(4);
     wxCoord tab_width = measured_textx + tab_height + wnd->FromDIP(5);
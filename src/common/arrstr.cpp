@@ -19,11 +19,68 @@
 #include "wx/scopedarray.h"
 #include "wx/wxcrt.h"
 
+#include "wx/private/parallelsort.h"
+#include "wx/private/sortkey.h"
+
 #include "wx/beforestd.h"
 #include <algorithm>
 #include <functional>
 #include "wx/afterstd.h"
 
+// ============================================================================
+// helpers
+// ============================================================================
+
+namespace
+{
+
+// Sort the strings using their natural sort keys and return true if the
+// comparison function is known to be equivalent to comparing these keys or
+// just return false otherwise.
+//
+// This is much faster than calling the comparison function O(N log N) times,
+// as it splits the strings into fragments and transforms them on each call.
+template <typename Iterator>
+bool SortByNaturalKeys(Iterator first, Iterator last,
+                       wxArrayString::CompareFunction function)
+{
+    if ( function != wxCmpNaturalGeneric
+#ifdef wxHAS_GENERIC_CMP_NATURAL
+            && function != wxCmpNatural
+#endif // wxHAS_GENERIC_CMP_NATURAL
+       )
+        return false;
+
+    const size_t count = last - first;
+
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for ( Iterator it = first; it != last; ++it )
+        keys.push_back(wxGetNaturalSortKey(*it));
+
+    std::vector<size_t> order(count);
+    for ( size_t n = 0; n < count; n++ )
+        order[n] = n;
+
+    wxParallelSort(order.begin(), order.end(),
+                   [&keys](size_t n1, size_t n2)
+                   {
+                       const int rc = keys[n1].compare(keys[n2]);
+                       return rc ? rc < 0 : n1 < n2;
+                   });
+
+    std::vector<wxString> sorted;
+    sorted.reserve(count);
+    for ( size_t n = 0; n < count; n++ )
+        sorted.push_back(std::move(first[order[n]]));
+
+    std::move(sorted.begin(), sorted.end(), first);
+
+    return true;
+}
+
+} // anonymous namespace
+
 // ============================================================================
 // ArrayString
 // ============================================================================
@@ -72,6 +129,9 @@ int wxArrayString::Index(const wxString& str, bool bCase, bool bFromEnd) const
 
 void wxArrayString::Sort(CompareFunction function)
 {
+    if ( SortByNaturalKeys(begin(), end(), function) )
+        return;
+
     std::sort(begin(), end(),
               [function](const wxString& s1, const wxString& s2)
               {
@@ -84,14 +144,23 @@ void wxArrayString::Sort(bool reverseOrder)
 {
     if (reverseOrder)
     {
-        std::sort(begin(), end(), std::greater<wxString>());
+        wxParallelSort(begin(), end(), std::greater<wxString>());
     }
     else
     {
-        std::sort(begin(), end());
+        wxParallelSort(begin(), end());
     }
 }
 
+wxSortedArrayString::wxSortedArrayString(const wxArrayString& src)
+    : wxSortedArrayStringBase(wxStringSortAscending)
+{
+    // Sorting all strings at once is much faster than inserting them one by
+    // one, which is O(N^2) for big arrays.
+    assign(src.begin(), src.end());
+    wxParallelSort(begin(), end());
+}
+
 int wxSortedArrayString::Index(const wxString& str,
                                bool WXUNUSED_UNLESS_DEBUG(bCase),
                                bool WXUNUSED_UNLESS_DEBUG(bFromEnd)) const
@@ -162,6 +231,31 @@ void wxArrayString::Copy(const wxArrayString& src)
   if ( src.m_nCount > ARRAY_DEFAULT_INITIAL_SIZE )
     Alloc(src.m_nCount);
 
+  if ( m_autoSort && !m_nCount && src.m_nCount )
+  {
+    // inserting the strings one by one into a sorted array is O(N^2), so
+    // copy all of them and sort them at once instead
+    wxScopedArray<wxString> oldStrings(Grow(src.m_nCount));
+
+    for ( size_t n = 0; n < src.m_nCount; n++ )
+      m_pItems[n] = src[n];
+    m_nCount = src.m_nCount;
+
+    if ( m_compareFunction )
+    {
+      const CompareFunction compareFunction = m_compareFunction;
+      std::sort(m_pItems, m_pItems + m_nCount,
+                [compareFunction](const wxString& s1, const wxString& s2)
+                {
+                    return compareFunction(s1, s2) < 0;
+                });
+    }
+    else
+      wxParallelSort(m_pItems, m_pItems + m_nCount);
+
+    return;
+  }
+
   for ( size_t n = 0; n < src.m_nCount; n++ )
     Add(src[n]);
 }
@@ -467,6 +561,9 @@ void wxArrayString::Sort(CompareFunction compareFunction)
 {
     wxCHECK_RET( !m_autoSort, wxT("can't use this method with sorted arrays") );
 
+    if ( SortByNaturalKeys(m_pItems, m_pItems + m_nCount, compareFunction) )
+        return;
+
     std::sort(m_pItems, m_pItems + m_nCount,
                 wxSortPredicateAdaptor(compareFunction));
 }
@@ -496,9 +593,9 @@ void wxArrayString::Sort(CompareFunction2 compareFunction)
 void wxArrayString::Sort(bool reverseOrder)
 {
     if ( reverseOrder )
-        std::sort(m_pItems, m_pItems + m_nCount, std::greater<wxString>());
+        wxParallelSort(m_pItems, m_pItems + m_nCount, std::greater<wxString>());
     else // normal sort
-        std::sort(m_pItems, m_pItems + m_nCount);
+        wxParallelSort(m_pItems, m_pItems + m_nCount);
 }
 
 bool wxArrayString::operator==(const wxArrayString& a) const
@@ -638,6 +735,106 @@ wxArrayString wxSplit(const wxString& str, const wxChar sep, const wxChar escape
     return ret;
 }
 
+// ----------------------------------------------------------------------------
+// wxStringSearchIndex
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Return the mask with a bit set for each character present in the string.
+//
+// Only the low bits of the characters are used, which is enough to put the
+// ASCII letters and digits into distinct bits.
+wxUint64 GetCharMask(const wxString& s)
+{
+    wxUint64 mask = 0;
+    for ( wxString::const_iterator it = s.begin(); it != s.end(); ++it )
+        mask |= wxUint64(1) << ((*it).GetValue() & 63);
+
+    return mask;
+}
+
+} // anonymous namespace
+
+void wxStringSearchIndex::Set(const wxArrayString& strings, bool caseSensitive)
+{
+    m_strings = strings;
+    m_caseSensitive = caseSensitive;
+
+    const size_t count = m_strings.size();
+
+    m_keys.clear();
+    if ( !m_caseSensitive )
+    {
+        m_keys.reserve(count);
+        for ( size_t n = 0; n < count; n++ )
+            m_keys.push_back(m_strings[n].Lower());
+    }
+
+    m_charMasks.clear();
+    m_charMasks.reserve(count);
+    for ( size_t n = 0; n < count; n++ )
+        m_charMasks.push_back(GetCharMask(GetKey(n)));
+
+    m_sorted.resize(count);
+    for ( size_t n = 0; n < count; n++ )
+        m_sorted[n] = n;
+
+    wxParallelSort(m_sorted.begin(), m_sorted.end(),
+                   [this](size_t n1, size_t n2)
+                   {
+                       const int rc = GetKey(n1).compare(GetKey(n2));
+                       return rc ? rc < 0 : n1 < n2;
+                   });
+}
+
+std::vector<size_t> wxStringSearchIndex::FindPrefix(const wxString& prefix) const
+{
+    const wxString key = MakeKey(prefix);
+    const size_t len = key.length();
+
+    // As the keys are sorted, all keys starting with the prefix are found in
+    // a contiguous range, which can be found using binary search.
+    const std::vector<size_t>::const_iterator
+        first = std::partition_point(m_sorted.begin(), m_sorted.end(),
+                    [this, &key, len](size_t n)
+                    {
+                        return GetKey(n).compare(0, len, key) < 0;
+                    }),
+        last = std::partition_point(first, m_sorted.end(),
+                    [this, &key, len](size_t n)
+                    {
+                        return GetKey(n).compare(0, len, key) == 0;
+                    });
+
+    std::vector<size_t> indices(first, last);
+    std::sort(indices.begin(), indices.end());
+
+    return indices;
+}
+
+std::vector<size_t>
+wxStringSearchIndex::FindSubstring(const wxString& substring) const
+{
+    const wxString key = MakeKey(substring);
+    const wxUint64 mask = GetCharMask(key);
+
+    std::vector<size_t> indices;
+
+    const size_t count = m_strings.size();
+    for ( size_t n = 0; n < count; n++ )
+    {
+        if ( (m_charMasks[n] & mask) != mask )
+            continue;
+
+        if ( GetKey(n).find(key) != wxString::npos )
+            indices.push_back(n);
+    }
+
+    return indices;
+}
+
 namespace // helpers needed by wxCmpNaturalGeneric()
 {
 // Used for comparison of string parts
@@ -810,11 +1007,87 @@ int wxCMPFUNC_CONV wxCmpNaturalGeneric(const wxString& s1, const wxString& s2)
 // ----------------------------------------------------------------------------
 
 // If native natural sort function isn't available, use the generic version.
-#if !(defined(__WINDOWS__) || defined(__DARWIN__))
+#ifdef wxHAS_GENERIC_CMP_NATURAL
 
 int wxCMPFUNC_CONV wxCmpNatural(const wxString& s1, const wxString& s2)
 {
     return wxCmpNaturalGeneric(s1, s2);
 }
 
-#endif // not a platform with native implementation
+#endif // wxHAS_GENERIC_CMP_NATURAL
+
+// ----------------------------------------------------------------------------
+// wxGetNaturalSortKey
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Append the key corresponding to comparing the text using wxStrcoll(), i.e.
+// the result of wcsxfrm(), followed by NUL terminator.
+void AppendCollationKey(std::string& key, const wxString& text)
+{
+    const wxWX2WCbuf buf = text.wc_str();
+
+    const size_t len = wxStrxfrm(nullptr, buf, 0);
+    wxWCharBuffer xfrm(len);
+    wxStrxfrm(xfrm.data(), buf, len + 1);
+
+    wxPrivate::AppendSortKeyXfrm(key, xfrm.data());
+    key += '\0';
+}
+
+// Append the key for comparing the numbers: as the number of bytes needed to
+// represent a number increases with its value, just put the number of bytes
+// before the bytes themselves.
+void AppendNumberKey(std::string& key, wxUint64 value)
+{
+    int numBytes = 0;
+    for ( wxUint64 n = value; n; n >>= 8 )
+        numBytes++;
+
+    key += static_cast<char>(numBytes);
+    while ( numBytes-- )
+        key += static_cast<char>((value >> (8*numBytes)) & 0xff);
+}
+
+} // anonymous namespace
+
+std::string wxGetNaturalSortKey(const wxString& s)
+{
+    // Represent each fragment by its type, which determines the order of the
+    // fragments of different types, followed by a self-delimiting key
+    // ordering the fragments of the same type as CompareFragmentNatural()
+    // does, so that comparing the concatenation of these keys is the same as
+    // comparing the fragments one by one as wxCmpNaturalGeneric() does.
+    //
+    // Note that Empty fragment, which sorts before all the others, is just
+    // the end of the key.
+    std::string key;
+
+    wxString text(s);
+    for ( ;; )
+    {
+        const wxStringFragment fragment = GetFragment(text);
+        switch ( fragment.type )
+        {
+            case wxStringFragment::Empty:
+                return key;
+
+            case wxStringFragment::SpaceOrPunct:
+                key += '\1';
+                AppendCollationKey(key, fragment.text);
+                break;
+
+            case wxStringFragment::Digit:
+                key += '\2';
+                AppendNumberKey(key, fragment.value);
+                break;
+
+            case wxStringFragment::LetterOrSymbol:
+                key += '\3';
+                AppendCollationKey(key, fragment.text.Lower());
+                break;
+        }
+    }
+}
@@ -349,13 +349,25 @@ int wxDataViewModel::Compare( const wxDataViewItem &item1, const wxDataViewItem
     if ( HasValue(item2, column) )
         GetValue( value2, item2, column );
 
-    if (!ascending)
-    {
-        wxVariant temp = value1;
-        value1 = value2;
-        value2 = temp;
-    }
+    const int res = ascending ? CompareValues(value1, value2)
+                              : CompareValues(value2, value1);
+    if ( res )
+        return res;
+
+    // items must be different, notice that we can't just return the
+    // difference between their IDs as it could be truncated to int
+    wxUIntPtr id1 = wxPtrToUInt(item1.GetID()),
+              id2 = wxPtrToUInt(item2.GetID());
+
+    if ( id1 == id2 )
+        return 0;
 
+    return (id1 < id2) == ascending ? -1 : 1;
+}
+
+int wxDataViewModel::CompareValues(const wxVariant& value1,
+                                   const wxVariant& value2) const
+{
     if (value1.GetType() == wxT("string"))
     {
         wxString str1 = value1.GetString();
@@ -419,12 +431,7 @@ int wxDataViewModel::Compare( const wxDataViewItem &item1, const wxDataViewItem
             return res;
     }
 
-
-    // items must be different
-    wxUIntPtr id1 = wxPtrToUInt(item1.GetID()),
-              id2 = wxPtrToUInt(item2.GetID());
-
-    return ascending ? id1 - id2 : id2 - id1;
+    return 0;
 }
 
 // ---------------------------------------------------------
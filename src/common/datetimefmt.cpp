@@ -306,6 +306,136 @@ ParseFormatAt(wxString::const_iterator& p,
     return dt;
 }
 
+// the fields found by wxDateTime::ParseFormat() or wxDateTimeParser
+struct ParsedDateTime
+{
+    // construct the date from the parsed fields, using the other fields of
+    // dateDef, if valid, or dt itself, if valid, or today otherwise
+    bool SetTo(wxDateTime& dt, const wxDateTime& dateDef) const;
+
+    // what fields have we found?
+    bool haveWDay = false,
+         haveYDay = false,
+         haveDay = false,
+         haveMon = false,
+         haveYear = false,
+         haveHour = false,
+         haveMin = false,
+         haveSec = false,
+         haveMsec = false;
+
+    bool hourIsIn12hFormat = false, // or in 24h one?
+         isPM = false;              // AM by default
+
+    bool haveTimeZone = false;
+
+    // and the value of the items we have (init them to get rid of warnings)
+    wxDateTime::wxDateTime_t msec = 0,
+                             sec = 0,
+                             min = 0,
+                             hour = 0;
+    wxDateTime::WeekDay wday = wxDateTime::Inv_WeekDay;
+    wxDateTime::wxDateTime_t yday = 0,
+                             mday = 0;
+    wxDateTime::Month mon = wxDateTime::Inv_Month;
+    int year = 0;
+    long timeZone = 0;  // time zone in seconds as expected in Tm structure
+};
+
+bool ParsedDateTime::SetTo(wxDateTime& dt, const wxDateTime& dateDef) const
+{
+    wxDateTime::Tm tmDef;
+    if ( dateDef.IsValid() )
+    {
+        // take this date as default
+        tmDef = dateDef.GetTm();
+    }
+    else if ( dt.IsValid() )
+    {
+        // if this date is valid, don't change it
+        tmDef = dt.GetTm();
+    }
+    else
+    {
+        // no default and this date is invalid - fall back to Today()
+        tmDef = wxDateTime::Today().GetTm();
+    }
+
+    wxDateTime::Tm tm = tmDef;
+
+    // set the date
+    if ( haveMon )
+    {
+        tm.mon = mon;
+    }
+
+    if ( haveYear )
+    {
+        tm.year = year;
+    }
+
+    // TODO we don't check here that the values are consistent, if both year
+    //      day and month/day were found, we just ignore the year day and we
+    //      also always ignore the week day
+    if ( haveDay )
+    {
+        if ( mday > wxDateTime::GetNumberOfDays(tm.mon, tm.year) )
+            return false;
+
+        tm.mday = mday;
+    }
+    else if ( haveYDay )
+    {
+        if ( yday > wxDateTime::GetNumberOfDays(tm.year) )
+            return false;
+
+        wxDateTime::Tm tm2 = wxDateTime(1, wxDateTime::Jan, tm.year).
+                                SetToYearDay(yday).GetTm();
+
+        tm.mon = tm2.mon;
+        tm.mday = tm2.mday;
+    }
+
+    // deal with AM/PM
+    wxDateTime::wxDateTime_t hour24 = hour;
+    if ( haveHour && hourIsIn12hFormat && isPM )
+    {
+        // translate to 24hour format
+        hour24 += 12;
+    }
+    //else: either already in 24h format or no translation needed
+
+    // set the time
+    if ( haveHour )
+    {
+        tm.hour = hour24;
+    }
+
+    if ( haveMin )
+    {
+        tm.min = min;
+    }
+
+    if ( haveSec )
+    {
+        tm.sec = sec;
+    }
+
+    if ( haveMsec )
+        tm.msec = msec;
+
+    dt.Set(tm);
+
+    if ( haveTimeZone )
+        dt.MakeFromTimezone(timeZone);
+
+    // finally check that the week day is consistent -- if we had it
+    if ( haveWDay && dt.GetWeekDay() != wday )
+        return false;
+
+    return true;
+}
+
 } // anonymous namespace
 
 // ----------------------------------------------------------------------------
@@ -1059,33 +1189,8 @@ wxDateTime::ParseFormat(const wxString& date,
 
     unsigned long num;
 
-    // what fields have we found?
-    bool haveWDay = false,
-         haveYDay = false,
-         haveDay = false,
-         haveMon = false,
-         haveYear = false,
-         haveHour = false,
-         haveMin = false,
-         haveSec = false,
-         haveMsec = false;
-
-    bool hourIsIn12hFormat = false, // or in 24h one?
-         isPM = false;              // AM by default
-
-    bool haveTimeZone = false;
-
-    // and the value of the items we have (init them to get rid of warnings)
-    wxDateTime_t msec = 0,
-                 sec = 0,
-                 min = 0,
-                 hour = 0;
-    WeekDay wday = Inv_WeekDay;
-    wxDateTime_t yday = 0,
-                 mday = 0;
-    wxDateTime::Month mon = Inv_Month;
-    int year = 0;
-    long timeZone = 0;  // time zone in seconds as expected in Tm structure
+    // the fields we've found
+    ParsedDateTime parsed;
 
     wxString::const_iterator input = date.begin();
     const wxString::const_iterator end = date.end();
@@ -1164,37 +1269,37 @@ wxDateTime::ParseFormat(const wxString& date,
             case wxT('a'):       // a weekday name
             case wxT('A'):
                 {
-                    wday = GetWeekDayFromName
+                    parsed.wday = GetWeekDayFromName
                            (
                             input, end,
                             *fmt == 'a' ? Name_Abbr : Name_Full,
                             DateLang_Local
                            );
-                    if ( wday == Inv_WeekDay )
+                    if ( parsed.wday == Inv_WeekDay )
                     {
                         // no match
                         return false;
                     }
                 }
-                haveWDay = true;
+                parsed.haveWDay = true;
                 break;
 
             case wxT('b'):       // a month name
             case wxT('B'):
                 {
-                    mon = GetMonthFromName
+                    parsed.mon = GetMonthFromName
                           (
                             input, end,
                             *fmt == 'b' ? Name_Abbr : Name_Full,
                             DateLang_Local
                           );
-                    if ( mon == Inv_Month )
+                    if ( parsed.mon == Inv_Month )
                     {
                         // no match
                         return false;
                     }
                 }
-                haveMon = true;
+                parsed.haveMon = true;
                 break;
 
             case wxT('c'):       // locale default date and time  representation
@@ -1225,16 +1330,16 @@ wxDateTime::ParseFormat(const wxString& date,
 
                     const Tm tm = dt.GetTm();
 
-                    hour = tm.hour;
-                    min = tm.min;
-                    sec = tm.sec;
+                    parsed.hour = tm.hour;
+                    parsed.min = tm.min;
+                    parsed.sec = tm.sec;
 
-                    year = tm.year;
-                    mon = tm.mon;
-                    mday = tm.mday;
+                    parsed.year = tm.year;
+                    parsed.mon = tm.mon;
+                    parsed.mday = tm.mday;
 
-                    haveDay = haveMon = haveYear =
-                    haveHour = haveMin = haveSec = true;
+                    parsed.haveDay = parsed.haveMon = parsed.haveYear =
+                    parsed.haveHour = parsed.haveMin = parsed.haveSec = true;
                 }
                 break;
 
@@ -1249,8 +1354,8 @@ wxDateTime::ParseFormat(const wxString& date,
 
                 // we can't check whether the day range is correct yet, will
                 // do it later - assume ok for now
-                haveDay = true;
-                mday = (wxDateTime_t)num;
+                parsed.haveDay = true;
+                parsed.mday = (wxDateTime_t)num;
                 break;
 
             case wxT('F'):       // ISO 8601 date
@@ -1261,11 +1366,11 @@ wxDateTime::ParseFormat(const wxString& date,
 
                     const Tm tm = dt.GetTm();
 
-                    year = tm.year;
-                    mon = tm.mon;
-                    mday = tm.mday;
+                    parsed.year = tm.year;
+                    parsed.mon = tm.mon;
+                    parsed.mday = tm.mday;
 
-                    haveDay = haveMon = haveYear = true;
+                    parsed.haveDay = parsed.haveMon = parsed.haveYear = true;
                 }
                 break;
 
@@ -1276,8 +1381,8 @@ wxDateTime::ParseFormat(const wxString& date,
                     return false;
                 }
 
-                haveHour = true;
-                hour = (wxDateTime_t)num;
+                parsed.haveHour = true;
+                parsed.hour = (wxDateTime_t)num;
                 break;
 
             case wxT('I'):       // hour in 12h format (01-12)
@@ -1288,9 +1393,9 @@ wxDateTime::ParseFormat(const wxString& date,
                     return false;
                 }
 
-                haveHour = true;
-                hourIsIn12hFormat = true;
-                hour = (wxDateTime_t)(num % 12);        // 12 should be 0
+                parsed.haveHour = true;
+                parsed.hourIsIn12hFormat = true;
+                parsed.hour = (wxDateTime_t)(num % 12);        // 12 should be 0
                 break;
 
             case wxT('j'):       // day of the year
@@ -1301,16 +1406,16 @@ wxDateTime::ParseFormat(const wxString& date,
                     return false;
                 }
 
-                haveYDay = true;
-                yday = (wxDateTime_t)num;
+                parsed.haveYDay = true;
+                parsed.yday = (wxDateTime_t)num;
                 break;
 
             case wxT('l'):       // milliseconds (0-999)
                 if ( !GetNumericToken(width, input, end, &num) )
                     return false;
 
-                haveMsec = true;
-                msec = (wxDateTime_t)num;
+                parsed.haveMsec = true;
+                parsed.msec = (wxDateTime_t)num;
                 break;
 
             case wxT('m'):       // month as a number (01-12)
@@ -1321,8 +1426,8 @@ wxDateTime::ParseFormat(const wxString& date,
                     return false;
                 }
 
-                haveMon = true;
-                mon = (Month)(num - 1);
+                parsed.haveMon = true;
+                parsed.mon = (Month)(num - 1);
                 break;
 
             case wxT('M'):       // minute as a decimal number (00-59)
@@ -1333,8 +1438,8 @@ wxDateTime::ParseFormat(const wxString& date,
                     return false;
                 }
 
-                haveMin = true;
-                min = (wxDateTime_t)num;
+                parsed.haveMin = true;
+                parsed.min = (wxDateTime_t)num;
                 break;
 
             case wxT('p'):       // AM or PM string
@@ -1349,7 +1454,7 @@ wxDateTime::ParseFormat(const wxString& date,
                     const size_t pos = input - date.begin();
                     if ( date.compare(pos, pm.length(), pm) == 0 )
                     {
-                        isPM = true;
+                        parsed.isPM = true;
                         input += pm.length();
                     }
                     else if ( date.compare(pos, am.length(), am) == 0 )
@@ -1370,12 +1475,12 @@ wxDateTime::ParseFormat(const wxString& date,
                                          wxS("%I:%M:%S %p"), &input) )
                         return false;
 
-                    haveHour = haveMin = haveSec = true;
+                    parsed.haveHour = parsed.haveMin = parsed.haveSec = true;
 
                     const Tm tm = dt.GetTm();
-                    hour = tm.hour;
-                    min = tm.min;
-                    sec = tm.sec;
+                    parsed.hour = tm.hour;
+                    parsed.min = tm.min;
+                    parsed.sec = tm.sec;
                 }
                 break;
 
@@ -1386,12 +1491,12 @@ wxDateTime::ParseFormat(const wxString& date,
                     if ( !dt.IsValid() )
                         return false;
 
-                    haveHour =
-                    haveMin = true;
+                    parsed.haveHour =
+                    parsed.haveMin = true;
 
                     const Tm tm = dt.GetTm();
-                    hour = tm.hour;
-                    min = tm.min;
+                    parsed.hour = tm.hour;
+                    parsed.min = tm.min;
                 }
                 break;
 
@@ -1403,8 +1508,8 @@ wxDateTime::ParseFormat(const wxString& date,
                     return false;
                 }
 
-                haveSec = true;
-                sec = (wxDateTime_t)num;
+                parsed.haveSec = true;
+                parsed.sec = (wxDateTime_t)num;
                 break;
 
             case wxT('T'):       // time as %H:%M:%S
@@ -1414,27 +1519,27 @@ wxDateTime::ParseFormat(const wxString& date,
                     if ( !dt.IsValid() )
                         return false;
 
-                    haveHour =
-                    haveMin =
-                    haveSec = true;
+                    parsed.haveHour =
+                    parsed.haveMin =
+                    parsed.haveSec = true;
 
                     const Tm tm = dt.GetTm();
-                    hour = tm.hour;
-                    min = tm.min;
-                    sec = tm.sec;
+                    parsed.hour = tm.hour;
+                    parsed.min = tm.min;
+                    parsed.sec = tm.sec;
                 }
                 break;
 
             case wxT('w'):       // weekday as a number (0-6), Sunday = 0
                 if ( !GetNumericToken(width, input, end, &num) ||
-                        (wday > 6) )
+                        (parsed.wday > 6) )
                 {
                     // no match
                     return false;
                 }
 
-                haveWDay = true;
-                wday = (WeekDay)num;
+                parsed.haveWDay = true;
+                parsed.wday = (WeekDay)num;
                 break;
 
             case wxT('x'):       // locale default date representation
@@ -1477,13 +1582,13 @@ wxDateTime::ParseFormat(const wxString& date,
 
                     const Tm tm = dt.GetTm();
 
-                    haveDay =
-                    haveMon =
-                    haveYear = true;
+                    parsed.haveDay =
+                    parsed.haveMon =
+                    parsed.haveYear = true;
 
-                    year = tm.year;
-                    mon = tm.mon;
-                    mday = tm.mday;
+                    parsed.year = tm.year;
+                    parsed.mon = tm.mon;
+                    parsed.mday = tm.mday;
                 }
 
                 break;
@@ -1510,14 +1615,14 @@ wxDateTime::ParseFormat(const wxString& date,
                     if ( !dt.IsValid() )
                         return false;
 
-                    haveHour =
-                    haveMin =
-                    haveSec = true;
+                    parsed.haveHour =
+                    parsed.haveMin =
+                    parsed.haveSec = true;
 
                     const Tm tm = dt.GetTm();
-                    hour = tm.hour;
-                    min = tm.min;
-                    sec = tm.sec;
+                    parsed.hour = tm.hour;
+                    parsed.min = tm.min;
+                    parsed.sec = tm.sec;
                 }
                 break;
 
@@ -1529,11 +1634,11 @@ wxDateTime::ParseFormat(const wxString& date,
                     return false;
                 }
 
-                haveYear = true;
+                parsed.haveYear = true;
 
                 // TODO should have an option for roll over date instead of
                 //      hard coding it here
-                year = (num > 30 ? 1900 : 2000) + (wxDateTime_t)num;
+                parsed.year = (num > 30 ? 1900 : 2000) + (wxDateTime_t)num;
                 break;
 
             case wxT('Y'):       // year with century
@@ -1543,8 +1648,8 @@ wxDateTime::ParseFormat(const wxString& date,
                     return false;
                 }
 
-                haveYear = true;
-                year = (wxDateTime_t)num;
+                parsed.haveYear = true;
+                parsed.year = (wxDateTime_t)num;
                 break;
 
             case wxT('z'):
@@ -1557,7 +1662,7 @@ wxDateTime::ParseFormat(const wxString& date,
                     {
                         // Time is in UTC.
                         ++input;
-                        haveTimeZone = true;
+                        parsed.haveTimeZone = true;
                         break;
                     }
 
@@ -1621,11 +1726,11 @@ wxDateTime::ParseFormat(const wxString& date,
                     if ( hours > 15 || minutes > 59 )
                         return false;   // bad format
 
-                    timeZone = 3600*hours + 60*minutes;
+                    parsed.timeZone = 3600*hours + 60*minutes;
                     if ( minusFound )
-                        timeZone = -timeZone;
+                        parsed.timeZone = -parsed.timeZone;
 
-                    haveTimeZone = true;
+                    parsed.haveTimeZone = true;
                 }
                 break;
 
@@ -1654,91 +1759,7 @@ wxDateTime::ParseFormat(const wxString& date,
     }
 
     // format matched, try to construct a date from what we have now
-    Tm tmDef;
-    if ( dateDef.IsValid() )
-    {
-        // take this date as default
-        tmDef = dateDef.GetTm();
-    }
-    else if ( IsValid() )
-    {
-        // if this date is valid, don't change it
-        tmDef = GetTm();
-    }
-    else
-    {
-        // no default and this date is invalid - fall back to Today()
-        tmDef = Today().GetTm();
-    }
-
-    Tm tm = tmDef;
-
-    // set the date
-    if ( haveMon )
-    {
-        tm.mon = mon;
-    }
-
-    if ( haveYear )
-    {
-        tm.year = year;
-    }
-
-    // TODO we don't check here that the values are consistent, if both year
-    //      day and month/day were found, we just ignore the year day and we
-    //      also always ignore the week day
-    if ( haveDay )
-    {
-        if ( mday > GetNumberOfDays(tm.mon, tm.year) )
-            return false;
-
-        tm.mday = mday;
-    }
-    else if ( haveYDay )
-    {
-        if ( yday > GetNumberOfDays(tm.year) )
-            return false;
-
-        Tm tm2 = wxDateTime(1, Jan, tm.year).SetToYearDay(yday).GetTm();
-
-        tm.mon = tm2.mon;
-        tm.mday = tm2.mday;
-    }
-
-    // deal with AM/PM
-    if ( haveHour && hourIsIn12hFormat && isPM )
-    {
-        // translate to 24hour format
-        hour += 12;
-    }
-    //else: either already in 24h format or no translation needed
-
-    // set the time
-    if ( haveHour )
-    {
-        tm.hour = hour;
-    }
-
-    if ( haveMin )
-    {
-        tm.min = min;
-    }
-
-    if ( haveSec )
-    {
-        tm.sec = sec;
-    }
-
-    if ( haveMsec )
-        tm.msec = msec;
-
-    Set(tm);
-
-    if ( haveTimeZone )
-        MakeFromTimezone(timeZone);
-
-    // finally check that the week day is consistent -- if we had it
-    if ( haveWDay && GetWeekDay() != wday )
+    if ( !parsed.SetTo(*this, dateDef) )
         return false;
 
     *endParse = input;
@@ -2322,6 +2343,793 @@ const wchar_t* wxDateTime::ParseTime(const wchar_t* date)
     return date + (end - dateStr.begin());
 }
 
+// ----------------------------------------------------------------------------
+// wxDateTimeFormatter
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Output used by wxDateTimeFormatter writing into a fixed size buffer.
+class DateTimeBufferOutput
+{
+public:
+    DateTimeBufferOutput(wxChar *buf, size_t size)
+        : m_buf(buf), m_size(size), m_len(0)
+    {
+    }
+
+    void Add(wxChar ch)
+    {
+        // always leave space for the trailing NUL, but continue counting the
+        // characters even when the buffer is full to return the full length
+        if ( m_len + 1 < m_size )
+            m_buf[m_len] = ch;
+
+        ++m_len;
+    }
+
+    void Add(const wxString& str)
+    {
+        for ( wxString::const_iterator it = str.begin(); it != str.end(); ++it )
+            Add(static_cast<wxChar>(*it));
+    }
+
+    size_t Finish()
+    {
+        if ( m_size )
+            m_buf[m_len < m_size ? m_len : m_size - 1] = wxT('\0');
+
+        return m_len;
+    }
+
+private:
+    wxChar* const m_buf;
+    const size_t m_size;
+    size_t m_len;
+};
+
+// Output used by wxDateTimeFormatter appending to a string.
+class DateTimeStringOutput
+{
+public:
+    explicit DateTimeStringOutput(wxString& str) : m_str(str) { }
+
+    void Add(wxChar ch) { m_str += ch; }
+    void Add(const wxString& str) { m_str += str; }
+
+private:
+    wxString& m_str;
+};
+
+// Output the number padded with zeroes to the given width, i.e. in the same
+// way as "%0<width>d" printf() format would do it.
+template <typename T>
+void AddPaddedNumber(T& out, int value, int width)
+{
+    unsigned long n = value;
+    if ( value < 0 )
+    {
+        out.Add(wxT('-'));
+        n = -n;
+        width--;
+    }
+
+    wxChar digits[16];
+    int numDigits = 0;
+    do
+    {
+        digits[numDigits++] = static_cast<wxChar>(wxT('0') + n % 10);
+        n /= 10;
+    } while ( n );
+
+    for ( ; width > numDigits; width-- )
+        out.Add(wxT('0'));
+
+    while ( numDigits )
+        out.Add(digits[--numDigits]);
+}
+
+} // anonymous namespace
+
+wxDateTimeFormatter::wxDateTimeFormatter(const wxString& format)
+{
+    wxASSERT_MSG( !format.empty(), wxT("null format in wxDateTimeFormatter") );
+
+    bool needWeekDays = false,
+         needMonths = false,
+         needAmPm = false;
+
+    wxString literal;
+    const auto addItem = [this, &literal](Item::Type type,
+                                          wxChar spec,
+                                          int width,
+                                          const wxString& text = wxString())
+    {
+        if ( !literal.empty() )
+        {
+            m_items.push_back({Item::Literal, 0, 0, literal});
+            literal.clear();
+        }
+
+        m_items.push_back({type, spec, width, text});
+    };
+
+    for ( wxString::const_iterator p = format.begin(); p != format.end(); ++p )
+    {
+        if ( *p != wxT('%') )
+        {
+            literal += *p;
+            continue;
+        }
+
+        // a trailing '%' is output verbatim, as wxDateTime::Format() does
+        if ( ++p == format.end() )
+        {
+            literal += wxT('%');
+            break;
+        }
+
+        const wxChar spec = static_cast<wxChar>(*p);
+        switch ( spec )
+        {
+            case wxT('%'):
+                literal += wxT('%');
+                break;
+
+            case wxT('a'):
+            case wxT('A'):
+                addItem(Item::WeekDay, spec, spec == wxT('a'));
+                needWeekDays = true;
+                break;
+
+            case wxT('b'):
+            case wxT('B'):
+                addItem(Item::Month, spec, spec == wxT('b'));
+                needMonths = true;
+                break;
+
+            case wxT('p'):
+                addItem(Item::AmPm, spec, 0);
+                needAmPm = true;
+                break;
+
+            case wxT('d'):
+            case wxT('H'):
+            case wxT('I'):
+            case wxT('m'):
+            case wxT('M'):
+            case wxT('S'):
+            case wxT('y'):
+                addItem(Item::Number, spec, 2);
+                break;
+
+            case wxT('j'):
+            case wxT('l'):
+                addItem(Item::Number, spec, 3);
+                break;
+
+            case wxT('w'):
+                addItem(Item::Number, spec, 1);
+                break;
+
+            case wxT('Y'):
+                addItem(Item::Number, spec, 4);
+                break;
+
+            case wxT('F'):
+                addItem(Item::Number, wxT('Y'), 4);
+                literal += wxT('-');
+                addItem(Item::Number, wxT('m'), 2);
+                literal += wxT('-');
+                addItem(Item::Number, wxT('d'), 2);
+                break;
+
+            case wxT('T'):
+                addItem(Item::Number, wxT('H'), 2);
+                literal += wxT(':');
+                addItem(Item::Number, wxT('M'), 2);
+                literal += wxT(':');
+                addItem(Item::Number, wxT('S'), 2);
+                break;
+
+            default:
+                // All the other specifiers, either depending on the locale
+                // or on the way strftime() handles them, as well as all
+                // specifiers with explicit width, are rare enough to just
+                // let wxDateTime::Format() handle them.
+                {
+                    wxString text(wxT('%'));
+                    for ( ; p != format.end(); ++p )
+                    {
+                        text += *p;
+
+                        if ( *p != wxT('-') && *p != wxT('+') &&
+                                *p != wxT(' ') && !wxIsdigit(*p) )
+                            break;
+                    }
+
+                    addItem(Item::Fallback, spec, 0, text);
+                }
+
+                if ( p == format.end() )
+                {
+                    // avoid incrementing past the end in the loop
+                    --p;
+                }
+                break;
+        }
+    }
+
+    if ( !literal.empty() )
+        m_items.push_back({Item::Literal, 0, 0, literal});
+
+    // Cache the names using wxDateTime::Format() itself to ensure that we get
+    // the same results as it.
+    if ( needWeekDays )
+    {
+        for ( int wd = 0; wd < 7; wd++ )
+        {
+            // 2000-01-02 was a Sunday
+            const wxDateTime dt(static_cast<wxDateTime::wxDateTime_t>(2 + wd),
+                                wxDateTime::Jan, 2000);
+            m_weekDayNames[0][wd] = dt.Format(wxS("%A"));
+            m_weekDayNames[1][wd] = dt.Format(wxS("%a"));
+        }
+    }
+
+    if ( needMonths )
+    {
+        for ( int mon = 0; mon < 12; mon++ )
+        {
+            const wxDateTime dt(1, static_cast<wxDateTime::Month>(mon), 2000);
+            m_monthNames[0][mon] = dt.Format(wxS("%B"));
+            m_monthNames[1][mon] = dt.Format(wxS("%b"));
+        }
+    }
+
+    if ( needAmPm )
+    {
+        m_amPm[0] = wxDateTime(1, wxDateTime::Jan, 2000, 1).Format(wxS("%p"));
+        m_amPm[1] = wxDateTime(1, wxDateTime::Jan, 2000, 13).Format(wxS("%p"));
+    }
+}
+
+template <typename T>
+void wxDateTimeFormatter::DoFormat(T& out,
+                                   const wxDateTime& dt,
+                                   const wxDateTime::TimeZone& tz) const
+{
+    wxCHECK_RET( dt.IsValid(), wxT("invalid wxDateTime") );
+
+    wxDateTime::Tm tm = dt.GetTm(tz);
+
+    for ( const Item& item : m_items )
+    {
+        switch ( item.type )
+        {
+            case Item::Literal:
+                out.Add(item.text);
+                break;
+
+            case Item::Number:
+                {
+                    int value = 0;
+                    switch ( item.spec )
+                    {
+                        case wxT('d'):
+                            value = tm.mday;
+                            break;
+
+                        case wxT('H'):
+                            value = tm.hour;
+                            break;
+
+                        case wxT('I'):
+                            // 24h -> 12h, 0h -> 12h too
+                            value = tm.hour > 12 ? tm.hour - 12
+                                                 : tm.hour ? tm.hour : 12;
+                            break;
+
+                        case wxT('j'):
+                            value = dt.GetDayOfYear(tz);
+                            break;
+
+                        case wxT('l'):
+                            value = tm.msec;
+                            break;
+
+                        case wxT('m'):
+                            value = tm.mon + 1;
+                            break;
+
+                        case wxT('M'):
+                            value = tm.min;
+                            break;
+
+                        case wxT('S'):
+                            value = tm.sec;
+                            break;
+
+                        case wxT('w'):
+                            value = tm.GetWeekDay();
+                            break;
+
+                        case wxT('y'):
+                            value = tm.year % 100;
+                            break;
+
+                        case wxT('Y'):
+                            value = tm.year;
+                            break;
+
+                        default:
+                            wxFAIL_MSG( wxT("unexpected numeric field") );
+                    }
+
+                    AddPaddedNumber(out, value, item.width);
+                }
+                break;
+
+            case Item::WeekDay:
+                out.Add(m_weekDayNames[item.width][tm.GetWeekDay()]);
+                break;
+
+            case Item::Month:
+                out.Add(m_monthNames[item.width][tm.mon]);
+                break;
+
+            case Item::AmPm:
+                out.Add(m_amPm[tm.hour >= 12]);
+                break;
+
+            case Item::Fallback:
+                out.Add(dt.Format(item.text, tz));
+                break;
+        }
+    }
+}
+
+size_t wxDateTimeFormatter::Format(const wxDateTime& dt,
+                                   wxChar *buf,
+                                   size_t size,
+                                   const wxDateTime::TimeZone& tz) const
+{
+    DateTimeBufferOutput out(buf, size);
+    DoFormat(out, dt, tz);
+    return out.Finish();
+}
+
+void wxDateTimeFormatter::FormatTo(wxString& str,
+                                   const wxDateTime& dt,
+                                   const wxDateTime::TimeZone& tz) const
+{
+    DateTimeStringOutput out(str);
+    DoFormat(out, dt, tz);
+}
+
+// ----------------------------------------------------------------------------
+// wxDateTimeParser
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Same as GetNumericToken() but without any memory allocations.
+bool
+ScanNumber(wxString::const_iterator& p,
+           const wxString::const_iterator& end,
+           int len,
+           unsigned long *number)
+{
+    unsigned long n = 0;
+    int numDigits = 0;
+    for ( ; p != end && numDigits < len && wxIsdigit(*p); ++p, ++numDigits )
+    {
+        const unsigned digit = static_cast<unsigned>(*p - wxT('0'));
+        if ( n > (ULONG_MAX - digit) / 10 )
+            return false;
+
+        n = n*10 + digit;
+    }
+
+    *number = n;
+
+    return numDigits != 0;
+}
+
+// Same as GetMonthFromName() and GetWeekDayFromName() but using the names
+// cached in wxDateTimeParser: returns the index of the matching name or -1.
+int
+ScanName(wxString::const_iterator& p,
+         const wxString::const_iterator& end,
+         const wxString* names,
+         int count,
+         const bool* hasPeriod = nullptr)
+{
+    const wxString::const_iterator pOrig = p;
+    const wxString name = GetAlphaToken(p, end);
+    if ( !name.empty() )
+    {
+        for ( int n = 0; n < count; n++ )
+        {
+            if ( name.CmpNoCase(names[n]) != 0 )
+                continue;
+
+            if ( hasPeriod && hasPeriod[n] )
+            {
+                // skip trailing period if it was part of the match
+                if ( p == end || *p != '.' )
+                    continue;
+
+                ++p;
+            }
+
+            return n;
+        }
+    }
+
+    p = pOrig;
+
+    return -1;
+}
+
+} // anonymous namespace
+
+wxDateTimeParser::wxDateTimeParser(const wxString& format)
+    : m_format(format)
+{
+    wxASSERT_MSG( !format.empty(), wxT("format can't be empty") );
+
+    bool needWeekDays = false,
+         needMonths = false,
+         needAmPm = false;
+
+    const auto addItem = [this](Item::Type type, wxChar spec, int width = 0)
+    {
+        m_items.push_back({type, spec, width});
+    };
+
+    bool supported = true;
+    for ( wxString::const_iterator p = format.begin();
+          supported && p != format.end();
+          ++p )
+    {
+        if ( *p != wxT('%') )
+        {
+            if ( wxIsspace(*p) )
+                addItem(Item::Space, 0);
+            else
+                addItem(Item::Literal, static_cast<wxChar>(*p));
+
+            continue;
+        }
+
+        // skip the optional padding and parse the optional width exactly as
+        // wxDateTime::ParseFormat() does
+        if ( ++p != format.end() &&
+                (*p == '-' || *p == '_' || *p == '0') )
+            ++p;
+
+        int width = 0;
+        for ( ; p != format.end() && wxIsdigit(*p); ++p )
+        {
+            width *= 10;
+            width += *p - '0';
+        }
+
+        if ( p == format.end() )
+        {
+            // invalid format, let ParseFormat() deal with it
+            supported = false;
+            break;
+        }
+
+        const wxChar spec = static_cast<wxChar>(*p);
+        if ( !width )
+        {
+            switch ( spec )
+            {
+                case wxT('Y'):
+                    width = 4;
+                    break;
+
+                case wxT('j'):
+                case wxT('l'):
+                    width = 3;
+                    break;
+
+                default:
+                    width = 2;
+            }
+        }
+
+        switch ( spec )
+        {
+            case wxT('a'):
+            case wxT('A'):
+                addItem(Item::WeekDay, spec, spec == wxT('a'));
+                needWeekDays = true;
+                break;
+
+            case wxT('b'):
+            case wxT('B'):
+                addItem(Item::Month, spec, spec == wxT('b'));
+                needMonths = true;
+                break;
+
+            case wxT('p'):
+                addItem(Item::AmPm, spec);
+                needAmPm = true;
+                break;
+
+            case wxT('d'):
+            case wxT('e'):
+            case wxT('H'):
+            case wxT('I'):
+            case wxT('j'):
+            case wxT('l'):
+            case wxT('m'):
+            case wxT('M'):
+            case wxT('S'):
+            case wxT('y'):
+            case wxT('Y'):
+                addItem(Item::Number, spec, width);
+                break;
+
+            case wxT('F'):
+                addItem(Item::Number, wxT('Y'), 4);
+                addItem(Item::Literal, wxT('-'));
+                addItem(Item::Number, wxT('m'), 2);
+                addItem(Item::Literal, wxT('-'));
+                addItem(Item::Number, wxT('d'), 2);
+                break;
+
+            case wxT('T'):
+                addItem(Item::Number, wxT('H'), 2);
+                addItem(Item::Literal, wxT(':'));
+                addItem(Item::Number, wxT('M'), 2);
+                addItem(Item::Literal, wxT(':'));
+                addItem(Item::Number, wxT('S'), 2);
+                break;
+
+            case wxT('%'):
+                addItem(Item::Literal, spec);
+                break;
+
+            default:
+                // the locale-dependent formats and the time zones are
+                // parsed by ParseFormat() itself
+                supported = false;
+        }
+    }
+
+    if ( !supported )
+    {
+        m_items.clear();
+        return;
+    }
+
+    if ( needWeekDays )
+    {
+        for ( int wd = 0; wd < 7; wd++ )
+        {
+            const wxDateTime::WeekDay weekday = static_cast<wxDateTime::WeekDay>(wd);
+            m_weekDayNames[0][wd] = wxDateTime::GetWeekDayName(weekday,
+                                                               wxDateTime::Name_Full);
+            m_weekDayNames[1][wd] = wxDateTime::GetWeekDayName(weekday,
+                                                               wxDateTime::Name_Abbr);
+        }
+    }
+
+    if ( needMonths )
+    {
+        for ( int mon = 0; mon < 12; mon++ )
+        {
+            const wxDateTime::Month month = static_cast<wxDateTime::Month>(mon);
+            m_monthNames[0][mon] = wxDateTime::GetMonthName(month,
+                                                            wxDateTime::Name_Full);
+
+            // some locales (e.g. French one) use periods for the abbreviated
+            // month names but it's never part of name so compare it specially
+            wxString& nameAbbr = m_monthNames[1][mon];
+            nameAbbr = wxDateTime::GetMonthName(month, wxDateTime::Name_Abbr);
+            m_monthAbbrHasPeriod[mon] = !nameAbbr.empty() &&
+                                            *nameAbbr.rbegin() == '.';
+            if ( m_monthAbbrHasPeriod[mon] )
+                nameAbbr.erase(nameAbbr.end() - 1);
+        }
+    }
+
+    if ( needAmPm )
+        wxDateTime::GetAmPmStrings(&m_am, &m_pm);
+}
+
+bool wxDateTimeParser::Parse(const wxString& date,
+                             wxDateTime& dt,
+                             const wxDateTime& dateDef,
+                             wxString::const_iterator *end) const
+{
+    wxString::const_iterator input = date.begin();
+
+    if ( m_items.empty() )
+    {
+        if ( !dt.ParseFormat(date, m_format, dateDef, &input) )
+            return false;
+    }
+    else
+    {
+        const wxString::const_iterator dateEnd = date.end();
+
+        ParsedDateTime parsed;
+        for ( const Item& item : m_items )
+        {
+            switch ( item.type )
+            {
+                case Item::Literal:
+                    if ( input == dateEnd || *input != item.spec )
+                        return false;
+
+                    ++input;
+                    break;
+
+                case Item::Space:
+                    while ( input != dateEnd && wxIsspace(*input) )
+                        ++input;
+                    break;
+
+                case Item::Number:
+                    {
+                        unsigned long num;
+                        if ( !ScanNumber(input, dateEnd, item.width, &num) )
+                            return false;
+
+                        // check the values as wxDateTime::ParseFormat() does
+                        switch ( item.spec )
+                        {
+                            case wxT('d'):
+                            case wxT('e'):
+                                if ( num > 31 || num < 1 )
+                                    return false;
+
+                                parsed.haveDay = true;
+                                parsed.mday = (wxDateTime::wxDateTime_t)num;
+                                break;
+
+                            case wxT('H'):
+                                if ( num > 23 )
+                                    return false;
+
+                                parsed.haveHour = true;
+                                parsed.hour = (wxDateTime::wxDateTime_t)num;
+                                break;
+
+                            case wxT('I'):
+                                if ( !num || num > 12 )
+                                    return false;
+
+                                parsed.haveHour = true;
+                                parsed.hourIsIn12hFormat = true;
+                                parsed.hour = (wxDateTime::wxDateTime_t)(num % 12);
+                                break;
+
+                            case wxT('j'):
+                                if ( !num || num > 366 )
+                                    return false;
+
+                                parsed.haveYDay = true;
+                                parsed.yday = (wxDateTime::wxDateTime_t)num;
+                                break;
+
+                            case wxT('l'):
+                                parsed.haveMsec = true;
+                                parsed.msec = (wxDateTime::wxDateTime_t)num;
+                                break;
+
+                            case wxT('m'):
+                                if ( !num || num > 12 )
+                                    return false;
+
+                                parsed.haveMon = true;
+                                parsed.mon = (wxDateTime::Month)(num - 1);
+                                break;
+
+                            case wxT('M'):
+                                if ( num > 59 )
+                                    return false;
+
+                                parsed.haveMin = true;
+                                parsed.min = (wxDateTime::wxDateTime_t)num;
+                                break;
+
+                            case wxT('S'):
+                                if ( num > 61 )
+                                    return false;
+
+                                parsed.haveSec = true;
+                                parsed.sec = (wxDateTime::wxDateTime_t)num;
+                                break;
+
+                            case wxT('y'):
+                                if ( num > 99 )
+                                    return false;
+
+                                parsed.haveYear = true;
+                                parsed.year = (num > 30 ? 1900 : 2000) +
+                                                (wxDateTime::wxDateTime_t)num;
+                                break;
+
+                            case wxT('Y'):
+                                parsed.haveYear = true;
+                                parsed.year = (wxDateTime::wxDateTime_t)num;
+                                break;
+                        }
+                    }
+                    break;
+
+                case Item::WeekDay:
+                    {
+                        const int wd = ScanName(input, dateEnd,
+                                                m_weekDayNames[item.width], 7);
+                        if ( wd == -1 )
+                            return false;
+
+                        parsed.haveWDay = true;
+                        parsed.wday = static_cast<wxDateTime::WeekDay>(wd);
+                    }
+                    break;
+
+                case Item::Month:
+                    {
+                        const int mon = ScanName(input, dateEnd,
+                                                 m_monthNames[item.width], 12,
+                                                 item.width ? m_monthAbbrHasPeriod
+                                                            : nullptr);
+                        if ( mon == -1 )
+                            return false;
+
+                        parsed.haveMon = true;
+                        parsed.mon = static_cast<wxDateTime::Month>(mon);
+                    }
+                    break;
+
+                case Item::AmPm:
+                    {
+                        // we can never match %p in locales which don't use AM/PM
+                        if ( m_am.empty() || m_pm.empty() )
+                            return false;
+
+                        const size_t pos = input - date.begin();
+                        if ( date.compare(pos, m_pm.length(), m_pm) == 0 )
+                        {
+                            parsed.isPM = true;
+                            input += m_pm.length();
+                        }
+                        else if ( date.compare(pos, m_am.length(), m_am) == 0 )
+                        {
+                            input += m_am.length();
+                        }
+                        else // no match
+                        {
+                            return false;
+                        }
+                    }
+                    break;
+            }
+        }
+
+        if ( !parsed.SetTo(dt, dateDef) )
+            return false;
+    }
+
+    if ( end )
+        *end = input;
+    else if ( input != date.end() )
+        return false;
+
+    return true;
+}
+
 // ----------------------------------------------------------------------------
 // Workdays and holidays support
 // ----------------------------------------------------------------------------
@@ -89,6 +89,7 @@ namespace
 #define REG_NOTEOL    0x0008    // Same as PCRE2_NOTEOL.
 #define REG_NOSUB     0x0020    // Don't return matches.
 #define REG_NOTEMPTY  0x0100    // Same as PCRE2_NOTEMPTY.
+#define REG_JIT       0x0200    // Use pcre2_jit_compile().
 
 enum
 {
@@ -159,14 +160,24 @@ int wx_regcomp(regex_t* preg, const wxRegChar* pattern, int cflags)
         return REG_BADPAT;
     }
 
+    // JIT compilation may fail if it's not supported by the PCRE library we
+    // use or on the current platform, but this is not an error as
+    // pcre2_match() simply uses the interpreter in this case.
+    if ( cflags & REG_JIT )
+        pcre2_jit_compile(preg->code, PCRE2_JIT_COMPLETE);
+
     preg->match_data = pcre2_match_data_create_from_pattern(preg->code, nullptr);
 
     return REG_NOERROR;
 }
 
+// Non-standard function matching using the given match data instead of the
+// one stored in regex_t, this allows using the same regex_t concurrently.
+//
+// Returns the PCRE return code.
 int
-wx_regexec(const regex_t* preg, const wxRegChar* string, size_t len,
-           size_t nmatch, regmatch_t* pmatch, int eflags)
+wx_regmatch(const regex_t* preg, const wxRegChar* string, size_t len,
+            size_t offset, pcre2_match_data* match_data, int eflags)
 {
     int options = 0;
 
@@ -177,16 +188,23 @@ wx_regexec(const regex_t* preg, const wxRegChar* string, size_t len,
     if ( eflags & REG_NOTEMPTY )
         options |= PCRE2_NOTEMPTY;
 
-    const int rc = pcre2_match
-                   (
-                        preg->code,
-                        (PCRE2_SPTR)string,
-                        len,
-                        0,                      // start offset
-                        options,
-                        preg->match_data,
-                        nullptr                    // use default context
-                   );
+    return pcre2_match
+           (
+                preg->code,
+                (PCRE2_SPTR)string,
+                len,
+                offset,
+                options,
+                match_data,
+                nullptr                 // use default context
+           );
+}
+
+int
+wx_regexec(const regex_t* preg, const wxRegChar* string, size_t len,
+           size_t nmatch, regmatch_t* pmatch, int eflags)
+{
+    const int rc = wx_regmatch(preg, string, len, 0, preg->match_data, eflags);
 
     if ( rc == PCRE2_ERROR_NOMATCH )
         return REG_NOMATCH;
@@ -283,6 +301,35 @@ private:
     regmatch_t *m_matches;
 };
 
+// the match data used by wxRegExMatch
+class wxRegExMatchImpl
+{
+public:
+    wxRegExMatchImpl() = default;
+    ~wxRegExMatchImpl() { pcre2_match_data_free(m_data); }
+
+    // return the match data big enough to store the given number of captures,
+    // reusing the existing one if possible
+    pcre2_match_data* GetData(size_t count)
+    {
+        if ( !m_data || pcre2_get_ovector_count(m_data) < count )
+        {
+            pcre2_match_data_free(m_data);
+            m_data = pcre2_match_data_create(count, nullptr);
+        }
+
+        return m_data;
+    }
+
+    // the match data, allocated on demand
+    pcre2_match_data* m_data = nullptr;
+
+    // the number of valid entries in m_data: 0 if the last match failed
+    size_t m_count = 0;
+
+    wxDECLARE_NO_COPY_CLASS(wxRegExMatchImpl);
+};
+
 // the real implementation of wxRegEx
 class wxRegExImpl
 {
@@ -297,15 +344,26 @@ public:
     // RE operations
     bool Compile(wxString expr, int flags = 0);
     bool Matches(const wxRegChar *str, int flags, size_t len) const;
+    bool Matches(const wxRegChar *str, size_t len, int flags,
+                 wxRegExMatch& match, size_t offset = 0) const;
     bool GetMatch(size_t *start, size_t *len, size_t index = 0) const;
     size_t GetMatchCount() const;
     int Replace(wxString *pattern, const wxString& replacement,
                 size_t maxMatches = 0) const;
 
+    // compile the expression already converted to PCRE syntax
+    bool CompilePCRE(const wxString& expr, int flags);
+
+    // return true if the expression uses back references
+    bool HasBackReferences() const;
+
 private:
     // return the string containing the error message for the given err code
     wxString GetErrorMsg(int errorcode) const;
 
+    // translate wxRE_NOTXXX flags to REG_NOTXXX ones
+    static int ConvertMatchFlags(int flags);
+
     // init the members
     void Init()
     {
@@ -947,13 +1005,10 @@ static wxString ConvertWordBoundaries(const wxString& expr)
     return out;
 }
 
-bool wxRegExImpl::Compile(wxString expr, int flags)
+// Convert the expression in wxRegEx syntax to PCRE syntax, this can modify
+// the flags.
+static wxString ConvertToPCRE(wxString expr, int& flags)
 {
-    Reinit();
-
-    wxASSERT_MSG( !(flags & ~(wxRE_ADVANCED | wxRE_BASIC | wxRE_ICASE | wxRE_NOSUB | wxRE_NEWLINE)),
-                  wxT("unrecognized flags in wxRegEx::Compile") );
-
     // Deal with the directors and embedded options first (this can modify
     // flags).
     expr = ConvertMetasyntax(expr, flags);
@@ -969,6 +1024,24 @@ bool wxRegExImpl::Compile(wxString expr, int flags)
         expr = ConvertWordBoundaries(expr);
     }
 
+    return expr;
+}
+
+bool wxRegExImpl::Compile(wxString expr, int flags)
+{
+    wxASSERT_MSG( !(flags & ~(wxRE_ADVANCED | wxRE_BASIC | wxRE_ICASE |
+                              wxRE_NOSUB | wxRE_NEWLINE | wxRE_JIT)),
+                  wxT("unrecognized flags in wxRegEx::Compile") );
+
+    expr = ConvertToPCRE(expr, flags);
+
+    return CompilePCRE(expr, flags);
+}
+
+bool wxRegExImpl::CompilePCRE(const wxString& expr, int flags)
+{
+    Reinit();
+
     // translate our flags to regcomp() ones
     int flagsRE = 0;
     if ( !(flags & wxRE_BASIC) )
@@ -979,6 +1052,8 @@ bool wxRegExImpl::Compile(wxString expr, int flags)
         flagsRE |= REG_NOSUB;
     if ( flags & wxRE_NEWLINE )
         flagsRE |= REG_NEWLINE;
+    if ( flags & wxRE_JIT )
+        flagsRE |= REG_JIT;
 
 #ifndef WXREGEX_CONVERT_TO_MB
     const wxChar *exprstr = expr.c_str();
@@ -1018,13 +1093,9 @@ bool wxRegExImpl::Compile(wxString expr, int flags)
     return IsValid();
 }
 
-bool wxRegExImpl::Matches(const wxRegChar *str,
-                          int flags,
-                          size_t len) const
+/* static */
+int wxRegExImpl::ConvertMatchFlags(int flags)
 {
-    wxCHECK_MSG( IsValid(), false, wxT("must successfully Compile() first") );
-
-    // translate our flags to regexec() ones
     wxASSERT_MSG( !(flags & ~(wxRE_NOTBOL | wxRE_NOTEOL | wxRE_NOTEMPTY)),
                   wxT("unrecognized flags in wxRegEx::Matches") );
 
@@ -1036,6 +1107,18 @@ bool wxRegExImpl::Matches(const wxRegChar *str,
     if ( flags & wxRE_NOTEMPTY )
         flagsRE |= REG_NOTEMPTY;
 
+    return flagsRE;
+}
+
+bool wxRegExImpl::Matches(const wxRegChar *str,
+                          int flags,
+                          size_t len) const
+{
+    wxCHECK_MSG( IsValid(), false, wxT("must successfully Compile() first") );
+
+    // translate our flags to regexec() ones
+    const int flagsRE = ConvertMatchFlags(flags);
+
     // allocate matches array if needed
     wxRegExImpl *self = wxConstCast(this, wxRegExImpl);
     if ( !m_Matches && m_nMatches )
@@ -1066,6 +1149,47 @@ bool wxRegExImpl::Matches(const wxRegChar *str,
     }
 }
 
+bool wxRegExImpl::Matches(const wxRegChar *str,
+                          size_t len,
+                          int flags,
+                          wxRegExMatch& match,
+                          size_t offset) const
+{
+    wxCHECK_MSG( IsValid(), false, wxT("must successfully Compile() first") );
+
+    const int flagsRE = ConvertMatchFlags(flags);
+
+    if ( !match.m_impl )
+        match.m_impl = new wxRegExMatchImpl;
+
+    wxRegExMatchImpl& matchImpl = *match.m_impl;
+    matchImpl.m_count = 0;
+
+    // Note that we only modify the match data passed to us and not anything
+    // in this object, so this function can be safely called from multiple
+    // threads. Also notice that we always need at least the whole match
+    // offsets, even when using wxRE_NOSUB.
+    const size_t count = m_nMatches ? m_nMatches : 1;
+    pcre2_match_data* const data = matchImpl.GetData(count);
+    if ( !data )
+        return false;
+
+    const int rc = wx_regmatch(&m_RegEx, str, len, offset, data, flagsRE);
+    if ( rc == PCRE2_ERROR_NOMATCH )
+        return false;
+
+    if ( rc < 0 )
+    {
+        wxLogError(_("Failed to find match for regular expression: %s"),
+                   GetErrorMsg(REG_ESPACE));
+        return false;
+    }
+
+    matchImpl.m_count = count;
+
+    return true;
+}
+
 bool wxRegExImpl::GetMatch(size_t *start, size_t *len, size_t index) const
 {
     wxCHECK_MSG( IsValid(), false, wxT("must successfully Compile() first") );
@@ -1081,6 +1205,17 @@ bool wxRegExImpl::GetMatch(size_t *start, size_t *len, size_t index) const
     return true;
 }
 
+bool wxRegExImpl::HasBackReferences() const
+{
+    wxCHECK_MSG( IsValid(), false, wxT("must successfully Compile() first") );
+
+    uint32_t backrefMax = 0;
+    if ( pcre2_pattern_info(m_RegEx.code, PCRE2_INFO_BACKREFMAX, &backrefMax) != 0 )
+        return false;
+
+    return backrefMax != 0;
+}
+
 size_t wxRegExImpl::GetMatchCount() const
 {
     wxCHECK_MSG( IsValid(), 0, wxT("must successfully Compile() first") );
@@ -1130,12 +1265,17 @@ int wxRegExImpl::Replace(wxString *text,
     // (unless maxMatches is 0 which doesn't limit the number of replacements)
     size_t countRepl = 0;
 
+    // use the same match data for all matches instead of the one in this
+    // object, this avoids copying the offsets after each match
+    wxRegExMatch match;
+
     // note that "^" shouldn't match after the first call to Matches() so we
     // use wxRE_NOTBOL to prevent it from happening
     while ( (!maxMatches || countRepl < maxMatches) &&
              Matches(textstr + matchStart,
+                     textlen - matchStart,
                      countRepl ? wxRE_NOTBOL : 0,
-                     textlen - matchStart) )
+                     match) )
     {
         // the string possibly contains back references: we need to calculate
         // the replacement text anew after each match
@@ -1177,8 +1317,7 @@ int wxRegExImpl::Replace(wxString *text,
                 if ( index != (size_t)-1 )
                 {
                     // yes, get its text
-                    size_t start, len;
-                    if ( !GetMatch(&start, &len, index) )
+                    if ( index >= match.GetCount() )
                     {
                         wxFAIL_MSG( wxT("invalid back reference") );
 
@@ -1186,7 +1325,11 @@ int wxRegExImpl::Replace(wxString *text,
                     }
                     else
                     {
-                        textNew += wxString(textstr + matchStart + start, len);
+                        // the subexpression may not have matched anything,
+                        // in which case it's just replaced with nothing
+                        size_t start, len;
+                        if ( match.Get(&start, &len, index) )
+                            textNew.append(textstr + matchStart + start, len);
 
                         mayHaveBackrefs = true;
                     }
@@ -1199,7 +1342,7 @@ int wxRegExImpl::Replace(wxString *text,
         }
 
         size_t start, len;
-        if ( !GetMatch(&start, &len) )
+        if ( !match.Get(&start, &len) )
         {
             // we did have match as Matches() returned true above!
             wxFAIL_MSG( wxT("internal logic error in wxRegEx::Replace") );
@@ -1212,7 +1355,7 @@ int wxRegExImpl::Replace(wxString *text,
         if (result.capacity() < result.length() + start + textNew.length())
             result.reserve(2 * result.length());
 
-        result.append(wxString(textstr + matchStart, start));
+        result.append(textstr + matchStart, start);
         matchStart += start;
         result.append(textNew);
 
@@ -1221,12 +1364,45 @@ int wxRegExImpl::Replace(wxString *text,
         matchStart += len;
     }
 
-    result.append(wxString(textstr + matchStart));
+    result.append(textstr + matchStart, textlen - matchStart);
     *text = result;
 
     return countRepl;
 }
 
+// ----------------------------------------------------------------------------
+// wxRegExMatch
+// ----------------------------------------------------------------------------
+
+wxRegExMatch::~wxRegExMatch()
+{
+    delete m_impl;
+}
+
+size_t wxRegExMatch::GetCount() const
+{
+    return m_impl ? m_impl->m_count : 0;
+}
+
+bool wxRegExMatch::Get(size_t *start, size_t *len, size_t index) const
+{
+    if ( index >= GetCount() )
+        return false;
+
+    const PCRE2_SIZE* const
+        ovector = pcre2_get_ovector_pointer(m_impl->m_data);
+
+    if ( ovector[index*2] == PCRE2_UNSET )
+        return false;
+
+    if ( start )
+        *start = ovector[index*2];
+    if ( len )
+        *len = ovector[index*2+1] - ovector[index*2];
+
+    return true;
+}
+
 // ----------------------------------------------------------------------------
 // wxRegEx: all methods are mostly forwarded to wxRegExImpl
 // ----------------------------------------------------------------------------
@@ -1274,6 +1450,37 @@ bool wxRegEx::Matches(const wxString& str, int flags) const
     return m_impl->Matches(textstr, flags, textlen);
 }
 
+bool wxRegEx::Matches(const wxStringCharType *start,
+                      const wxStringCharType *end,
+                      wxRegExMatch& match,
+                      int flags) const
+{
+    wxCHECK_MSG( IsValid(), false, wxT("must successfully Compile() first") );
+    wxCHECK_MSG( start && end >= start, false, wxT("invalid text range") );
+
+    // We rely on PCRE code unit width being the same as the size of the
+    // characters in wxString internal representation, see the definition of
+    // PCRE2_CODE_UNIT_WIDTH at the top of this file.
+    static_assert( sizeof(wxRegChar) == sizeof(wxStringCharType),
+                   "wxRegChar must be the same as wxStringCharType" );
+
+    return m_impl->Matches(reinterpret_cast<const wxRegChar*>(start),
+                           end - start, flags, match);
+}
+
+bool wxRegEx::Matches(const wxString& text, wxRegExMatch& match, int flags) const
+{
+    const wxStringCharType* const start = text.wx_str();
+
+#if wxUSE_UNICODE_UTF8
+    const size_t len = text.utf8_length();
+#else
+    const size_t len = text.length();
+#endif
+
+    return Matches(start, start + len, match, flags);
+}
+
 bool wxRegEx::GetMatch(size_t *start, size_t *len, size_t index) const
 {
     wxCHECK_MSG( IsValid(), false, wxT("must successfully Compile() first") );
@@ -1335,6 +1542,189 @@ wxString wxRegEx::QuoteMeta(const wxString& str)
     return strEscaped;
 }
 
+// ----------------------------------------------------------------------------
+// wxRegExSet
+// ----------------------------------------------------------------------------
+
+// All patterns are combined into a single "(p1)|(p2)|..." expression, which
+// allows matching all of them in a single pass, and the capturing group
+// surrounding each of them is used to determine which one has matched.
+
+wxRegExSet::~wxRegExSet()
+{
+    delete m_impl;
+}
+
+int wxRegExSet::Add(const wxString& pattern, int flags)
+{
+    wxASSERT_MSG( !(flags & ~(wxRE_ADVANCED | wxRE_BASIC | wxRE_ICASE | wxRE_NEWLINE)),
+                  wxT("unrecognized flags in wxRegExSet::Add") );
+
+    // Compile the pattern on its own first: this checks that it is valid and
+    // gives us the number of subexpressions in it.
+    wxRegExImpl re;
+    if ( !re.Compile(pattern, flags) )
+    {
+        // error message already given in wxRegExImpl::Compile
+        return wxNOT_FOUND;
+    }
+
+    // Back references use absolute group numbers, which wouldn't be correct
+    // any more in the combined expression.
+    if ( re.HasBackReferences() )
+    {
+        wxLogError(_("Regular expression '%s' using back references can't be "
+                     "used in a set."), pattern);
+        return wxNOT_FOUND;
+    }
+
+    wxDELETE(m_impl);
+
+    int flagsPCRE = flags;
+    const wxString expr = ConvertToPCRE(pattern, flagsPCRE);
+
+    // Each pattern uses its own options, so set them explicitly for the group
+    // containing it. Note that options embedded in the pattern itself still
+    // override these ones, as they come later.
+    wxString options("(?");
+    if ( flags & wxRE_ICASE )
+        options += 'i';
+    options += (flags & wxRE_NEWLINE) ? "m-s" : "s-m";
+    if ( !(flags & wxRE_ICASE) )
+        options += 'i';
+    options += ')';
+
+    if ( !m_expr.empty() )
+        m_expr += '|';
+
+    // Also end any "\Q" quoting which could have been started by the pattern
+    // before closing the group, "\E" is just ignored otherwise.
+    m_expr << '(' << options << expr << "\\E)";
+
+    m_groups.push_back(m_nGroups + 1);
+
+    // Account for the group we've added as well as the pattern groups.
+    m_nGroups += re.GetMatchCount();
+
+    return static_cast<int>(m_groups.size() - 1);
+}
+
+bool wxRegExSet::Compile(int flags)
+{
+    wxASSERT_MSG( !(flags & ~wxRE_JIT),
+                  wxT("unrecognized flags in wxRegExSet::Compile") );
+    wxCHECK_MSG( !m_groups.empty(), false, wxT("no patterns to compile") );
+
+    wxDELETE(m_impl);
+
+    wxRegExImpl* const impl = new wxRegExImpl;
+    if ( !impl->CompilePCRE(m_expr, flags) )
+    {
+        // error message already given in wxRegExImpl::CompilePCRE
+        delete impl;
+
+        return false;
+    }
+
+    m_impl = impl;
+
+    return true;
+}
+
+int wxRegExSet::FindPattern(const wxRegExMatch& match) const
+{
+    // Only the group of the pattern which matched is set.
+    for ( size_t n = 0; n < m_groups.size(); ++n )
+    {
+        if ( match.Get(nullptr, nullptr, m_groups[n]) )
+            return static_cast<int>(n);
+    }
+
+    wxFAIL_MSG( wxT("no matching pattern in wxRegExSet") );
+
+    return wxNOT_FOUND;
+}
+
+int wxRegExSet::Matches(const wxStringCharType *start,
+                        const wxStringCharType *end,
+                        wxRegExMatch& match,
+                        int flags) const
+{
+    wxCHECK_MSG( IsValid(), wxNOT_FOUND, wxT("must successfully Compile() first") );
+    wxCHECK_MSG( start && end >= start, wxNOT_FOUND, wxT("invalid text range") );
+
+    if ( !m_impl->Matches(reinterpret_cast<const wxRegChar*>(start),
+                          end - start, flags, match) )
+        return wxNOT_FOUND;
+
+    return FindPattern(match);
+}
+
+int wxRegExSet::Matches(const wxString& text, wxRegExMatch& match, int flags) const
+{
+    const wxStringCharType* const start = text.wx_str();
+
+#if wxUSE_UNICODE_UTF8
+    const size_t len = text.utf8_length();
+#else
+    const size_t len = text.length();
+#endif
+
+    return Matches(start, start + len, match, flags);
+}
+
+bool wxRegExSet::GetMatch(const wxRegExMatch& match,
+                          size_t pattern,
+                          size_t *start,
+                          size_t *len,
+                          size_t index) const
+{
+    wxCHECK_MSG( pattern < m_groups.size(), false, wxT("invalid pattern index") );
+
+    const size_t group = m_groups[pattern] + index;
+    const size_t groupEnd = pattern + 1 < m_groups.size()
+                                ? m_groups[pattern + 1]
+                                : m_nGroups + 1;
+    wxCHECK_MSG( group < groupEnd, false, wxT("invalid match index") );
+
+    return match.Get(start, len, group);
+}
+
+size_t wxRegExSet::FindAll(const wxString& text, wxVector<Match>& matches) const
+{
+    wxCHECK_MSG( IsValid(), 0, wxT("must successfully Compile() first") );
+
+    const wxRegChar* const
+        textstr = reinterpret_cast<const wxRegChar*>(text.wx_str());
+
+#if wxUSE_UNICODE_UTF8
+    const size_t textlen = text.utf8_length();
+#else
+    const size_t textlen = text.length();
+#endif
+
+    wxRegExMatch match;
+
+    // Pass the entire text and just the offset to start matching at to PCRE,
+    // rather than a pointer to the remaining part of the text, to let it
+    // check the preceding characters for "^" and "\b" assertions. Also skip
+    // empty matches, as we wouldn't advance after finding them.
+    size_t count = 0;
+    for ( size_t offset = 0;
+          m_impl->Matches(textstr, textlen, wxRE_NOTEMPTY, match, offset);
+          ++count )
+    {
+        Match m;
+        m.pattern = FindPattern(match);
+        match.Get(&m.start, &m.len);
+        matches.push_back(m);
+
+        offset = m.start + m.len;
+    }
+
+    return count;
+}
+
 /* static */
 wxVersionInfo wxRegEx::GetLibraryVersionInfo()
 {
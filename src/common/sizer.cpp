@@ -628,6 +628,10 @@ bool wxSizerItem::InformFirstDirection(int direction, int size, int availableOth
             m_minSize = minSize;
             didUse = true;
         }
+
+        // The sizer min size computed before doesn't take the known
+        // direction into account, so it must not be reused by its Layout().
+        GetSizer()->m_hasCalcMinSize = false;
     }
     else if (IsWindow())
     {
@@ -791,7 +795,11 @@ void wxSizerItem::SetDimension( const wxPoint& pos_, const wxSize& size_ )
             break;
         }
         case Item_Sizer:
+            // This is normally called from the parent sizer layout, which
+            // allows the sizer to reuse its minimal size computed by it.
+            m_sizer->m_layingOutFromParent = true;
             m_sizer->SetDimension(pos, size);
+            m_sizer->m_layingOutFromParent = false;
             break;
 
         case Item_Spacer:
@@ -1288,14 +1296,48 @@ void wxSizer::RecalcSizes()
 
 void wxSizer::Layout()
 {
+    // The nested sizers may reuse the minimal sizes computed by our CalcMin()
+    // only while they're laid out by our RepositionChildren(), as the items
+    // may change at any moment outside of it, e.g. when the windows contents
+    // is updated in their wxEVT_SIZE handlers.
+    const auto forgetNestedMinSizes = [this]()
+    {
+        for ( wxSizerItem* item: m_children )
+        {
+            if ( wxSizer* const sizer = item->GetSizer() )
+                sizer->m_hasCalcMinSize = false;
+        }
+    };
+
     // (re)calculates minimums needed for each item and other preparations
-    // for layout
-    const wxSize minSize = CalcMin();
+    // for layout, unless we're being laid out by the parent sizer which has
+    // just done it for us while computing its own minimal size.
+    wxSize minSize;
+    if ( m_layingOutFromParent && m_hasCalcMinSize )
+    {
+        minSize = m_calcMinSize;
+    }
+    else
+    {
+        // Don't let the nested sizers reuse any values not computed by this
+        // CalcMin() call.
+        forgetNestedMinSizes();
+
+        minSize = CalcMin();
+    }
+
+    // The value can be used only once, anything happening after this can
+    // change it.
+    m_hasCalcMinSize = false;
 
     // Applies the layout and repositions/resizes the items
-    wxWindow::ChildrenRepositioningGuard repositionGuard(m_containingWindow);
+    {
+        wxWindow::ChildrenRepositioningGuard repositionGuard(m_containingWindow);
 
-    RepositionChildren(minSize);
+        RepositionChildren(minSize);
+    }
+
+    forgetNestedMinSizes();
 }
 
 void wxSizer::SetSizeHints( wxWindow *window )
@@ -1337,6 +1379,12 @@ wxSize wxSizer::VirtualFitSize( wxWindow *window )
 wxSize wxSizer::GetMinSize()
 {
     wxSize ret( CalcMin() );
+
+    // Remember the value to avoid recomputing it in Layout() if it's called
+    // by our parent sizer right after computing its own minimal size.
+    m_calcMinSize = ret;
+    m_hasCalcMinSize = true;
+
     if (ret.x < m_minSize.x) ret.x = m_minSize.x;
     if (ret.y < m_minSize.y) ret.y = m_minSize.y;
     return ret;
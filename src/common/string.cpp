@@ -1909,13 +1909,24 @@ wxString wxString::FormatV(const wxString& format, va_list argptr)
     return s;
 }
 
+#if wxUSE_UNICODE_WCHAR
+// Defined below.
+static int DoStringPrintfWchar(wxString& str,
+                               const wxChar* format, va_list argptr);
+#endif // wxUSE_UNICODE_WCHAR
+
 #if !wxUSE_UTF8_LOCALE_ONLY
 int wxString::DoPrintfWchar(const wxChar *format, ...)
 {
     va_list argptr;
     va_start(argptr, format);
 
+#if wxUSE_UNICODE_WCHAR
+    // Avoid creating a temporary wxString for the format.
+    int iLen = DoStringPrintfWchar(*this, format, argptr);
+#else
     int iLen = PrintfV(format, argptr);
+#endif
 
     va_end(argptr);
 
@@ -2073,20 +2084,62 @@ static int DoStringPrintfV(wxString& str,
     return str.length();
 }
 
+#if wxUSE_UNICODE_WCHAR
+
+// This is an optimized version of DoStringPrintfV() for the common case of
+// short output: it formats into a stack buffer first and only falls back to
+// the general version, allocating the buffer on the heap and growing it as
+// necessary, if the output doesn't fit into it.
+static int DoStringPrintfWchar(wxString& str,
+                               const wxChar* format, va_list argptr)
+{
+    // The size of the buffer is chosen to be big enough for almost all
+    // strings, while still being reasonably small to be allocated on stack.
+    wxChar buf[512];
+
+    {
+        PreserveErrno preserveErrno;
+
+        va_list argptrcopy;
+        wxVaCopy(argptrcopy, argptr);
+
+        errno = 0;
+        const int len = wxCRT_VsnprintfW(buf, WXSIZEOF(buf), format, argptrcopy);
+        va_end(argptrcopy);
+
+        if ( len >= 0 && static_cast<size_t>(len) < WXSIZEOF(buf) )
+        {
+            str.assign(buf, len);
+            return len;
+        }
+
+        if ( len < 0 && (errno == EILSEQ || errno == EINVAL) )
+        {
+            // Hard error, see the comment before DoStringPrintfV().
+            str.clear();
+            return -1;
+        }
+    }
+
+    // Note that we need to copy the format here, as it may point to the
+    // string contents, which are going to be overwritten.
+    return DoStringPrintfV(str, wxString(format), argptr);
+}
+
+#endif // wxUSE_UNICODE_WCHAR
+
 int wxString::PrintfV(const wxString& format, va_list argptr)
 {
-#if wxUSE_UTF8_LOCALE_ONLY
+#if wxUSE_UNICODE_WCHAR
+    return DoStringPrintfWchar(*this, format.wc_str(), argptr);
+#elif wxUSE_UTF8_LOCALE_ONLY
     return DoStringPrintfV<wxUTF8StringBuffer>(*this, format, argptr);
-#else
-    #if wxUSE_UNICODE_UTF8
+#else // wxUSE_UNICODE_UTF8
     if ( wxLocaleIsUtf8 )
         return DoStringPrintfV<wxUTF8StringBuffer>(*this, format, argptr);
     else
         // wxChar* version
         return DoStringPrintfV<wxStringBuffer>(*this, format, argptr);
-    #else
-        return DoStringPrintfV(*this, format, argptr);
-    #endif // UTF8/WCHAR
 #endif
 }
 
@@ -559,6 +559,173 @@ const wxScopedWCharBuffer wxScanfConvertFormatW(const wchar_t *format)
 #endif // !__WINDOWS__
 
 
+// ----------------------------------------------------------------------------
+// wxFormatString cache
+// ----------------------------------------------------------------------------
+
+// The same format strings, typically literals, are used over and over again,
+// so we keep a small per-thread cache of the results of converting them to
+// the form passed to the CRT functions and of parsing their specifiers, to
+// avoid redoing it, and allocating memory for it, on every call.
+//
+// The cache is keyed by the format string pointer, but the contents is
+// checked too, as the same pointer may refer to different strings over time.
+//
+// We don't use it with MinGW because of the bug in its thread_local variables
+// implementation, see the comment in src/common/translation.cpp.
+#ifndef __MINGW32__
+    #define wxHAS_FORMAT_STRING_CACHE
+#endif
+
+#ifdef wxHAS_FORMAT_STRING_CACHE
+
+namespace
+{
+
+template <typename CharType>
+struct FormatCacheEntry
+{
+    // The key used for the lookup and the copy of the format string contents.
+    const CharType* key = nullptr;
+    std::basic_string<CharType> format;
+
+    // The converted format strings, always owned by the buffer, so that they
+    // remain valid even if this entry is reused while still being referenced.
+#if !wxUSE_UTF8_LOCALE_ONLY
+    wxScopedWCharBuffer convertedWChar;
+#endif
+#if !wxUSE_UNICODE_WCHAR
+    wxScopedCharBuffer convertedChar;
+#endif
+
+    // The types of all arguments used by the format string, with Arg_Unknown
+    // for the missing or invalid specifiers, valid only if hasArgTypes is set.
+    std::vector<int> argTypes;
+    bool hasArgTypes = false;
+};
+
+template <typename CharType>
+FormatCacheEntry<CharType>& GetFormatCacheEntry(const CharType* format)
+{
+    static const size_t CACHE_SIZE = 16;
+    thread_local FormatCacheEntry<CharType> s_entries[CACHE_SIZE];
+
+    const wxUIntPtr p = wxPtrToUInt(format);
+    FormatCacheEntry<CharType>& entry = s_entries[(p ^ (p >> 6)) % CACHE_SIZE];
+
+    if ( entry.key != format || entry.format.compare(format) != 0 )
+    {
+        entry.key = format;
+        entry.format = format;
+#if !wxUSE_UTF8_LOCALE_ONLY
+        entry.convertedWChar.reset();
+#endif
+#if !wxUSE_UNICODE_WCHAR
+        entry.convertedChar.reset();
+#endif
+        entry.hasArgTypes = false;
+    }
+
+    return entry;
+}
+
+// Conversion of the format string to the other character type uses the
+// current locale encoding, which may change, so we only cache it for the
+// strings which are converted in the same way in all of them.
+template <typename CharType>
+bool IsASCIIFormat(const CharType* format)
+{
+    for ( ; *format; ++format )
+    {
+        if ( *format & ~0x7f )
+            return false;
+    }
+
+    return true;
+}
+
+#if !wxUSE_UTF8_LOCALE_ONLY
+
+wxScopedWCharBuffer FormatAsWChar(const wchar_t* format)
+{
+    return wxScopedWCharBuffer::CreateNonOwned(format);
+}
+
+wxScopedWCharBuffer FormatAsWChar(const char* format)
+{
+    if ( !IsASCIIFormat(format) )
+        return wxScopedWCharBuffer();
+
+    return wxConvLibc.cMB2WC(format);
+}
+
+// Return the cached converted format or an empty buffer if it can't be cached.
+template <typename CharType>
+wxScopedWCharBuffer GetCachedWCharFormat(const CharType* format)
+{
+    {
+        const FormatCacheEntry<CharType>& entry = GetFormatCacheEntry(format);
+        if ( entry.convertedWChar )
+            return entry.convertedWChar;
+    }
+
+    const wxScopedWCharBuffer input = FormatAsWChar(format);
+    if ( !input )
+        return input;
+
+    const wxWCharBuffer
+        converted(wxPrintfFormatConverterWchar().Convert(input.data()));
+
+    // Look the entry up again, it could have been reused in the meanwhile.
+    GetFormatCacheEntry(format).convertedWChar = converted;
+
+    return converted;
+}
+
+#endif // !wxUSE_UTF8_LOCALE_ONLY
+
+#if !wxUSE_UNICODE_WCHAR
+
+wxScopedCharBuffer FormatAsChar(const char* format)
+{
+    return wxScopedCharBuffer::CreateNonOwned(format);
+}
+
+wxScopedCharBuffer FormatAsChar(const wchar_t* format)
+{
+    if ( !IsASCIIFormat(format) )
+        return wxScopedCharBuffer();
+
+    return wxConvLibc.cWC2MB(format);
+}
+
+template <typename CharType>
+wxScopedCharBuffer GetCachedCharFormat(const CharType* format)
+{
+    {
+        const FormatCacheEntry<CharType>& entry = GetFormatCacheEntry(format);
+        if ( entry.convertedChar )
+            return entry.convertedChar;
+    }
+
+    const wxScopedCharBuffer input = FormatAsChar(format);
+    if ( !input )
+        return input;
+
+    const wxCharBuffer
+        converted(wxPrintfFormatConverterUtf8().Convert(input.data()));
+
+    GetFormatCacheEntry(format).convertedChar = converted;
+
+    return converted;
+}
+
+#endif // !wxUSE_UNICODE_WCHAR
+
+} // anonymous namespace
+
+#endif // wxHAS_FORMAT_STRING_CACHE
+
 // ----------------------------------------------------------------------------
 // wxFormatString
 // ----------------------------------------------------------------------------
@@ -589,6 +756,20 @@ const char* wxFormatString::InputAsChar()
 
 const char* wxFormatString::AsChar()
 {
+#ifdef wxHAS_FORMAT_STRING_CACHE
+    if ( !m_convertedChar )
+    {
+        if ( m_char )
+            m_convertedChar = GetCachedCharFormat(m_char.data());
+        else if ( m_wchar )
+            m_convertedChar = GetCachedCharFormat(m_wchar.data());
+        else if ( m_str )
+            m_convertedChar = GetCachedCharFormat(m_str->wx_str());
+        else if ( m_cstr )
+            m_convertedChar = GetCachedCharFormat(m_cstr->AsInternal());
+    }
+#endif // wxHAS_FORMAT_STRING_CACHE
+
     if ( !m_convertedChar )
         m_convertedChar = wxPrintfFormatConverterUtf8().Convert(InputAsChar());
 
@@ -631,6 +812,24 @@ const wchar_t* wxFormatString::InputAsWChar()
 
 const wchar_t* wxFormatString::AsWChar()
 {
+#ifdef wxHAS_FORMAT_STRING_CACHE
+    if ( !m_convertedWChar )
+    {
+        if ( m_char )
+            m_convertedWChar = GetCachedWCharFormat(m_char.data());
+        else if ( m_wchar )
+            m_convertedWChar = GetCachedWCharFormat(m_wchar.data());
+#if wxUSE_UNICODE_WCHAR
+        // In UTF-8 build these strings are converted from UTF-8 and not using
+        // the locale encoding, so don't bother caching them.
+        else if ( m_str )
+            m_convertedWChar = GetCachedWCharFormat(m_str->wc_str());
+        else if ( m_cstr )
+            m_convertedWChar = GetCachedWCharFormat(m_cstr->AsInternal());
+#endif // wxUSE_UNICODE_WCHAR
+    }
+#endif // wxHAS_FORMAT_STRING_CACHE
+
     if ( !m_convertedWChar )
         m_convertedWChar = wxPrintfFormatConverterWchar().Convert(InputAsWChar());
 
@@ -737,6 +936,72 @@ wxFormatString::ArgumentType DoGetArgumentType(const CharType *format,
     return ArgTypeFromParamType(parser.pspec[n-1]->m_type);
 }
 
+#ifdef wxHAS_FORMAT_STRING_CACHE
+
+// Return the types of all arguments used by the given format string.
+template<typename CharType>
+const std::vector<int>& GetCachedArgumentTypes(const CharType *format)
+{
+    {
+        const FormatCacheEntry<CharType>& entry = GetFormatCacheEntry(format);
+        if ( entry.hasArgTypes )
+            return entry.argTypes;
+    }
+
+    // Note that the parser may assert, which can result in formatting other
+    // strings and reusing the cache entry, so we can't parse entry.format and
+    // have to look up the entry again after parsing.
+    std::vector<int> argTypes;
+    {
+        wxPrintfConvSpecParser<CharType> parser(format);
+
+        argTypes.reserve(parser.nargs);
+        for ( unsigned n = 0; n < parser.nargs; ++n )
+        {
+            const auto pspec = parser.pspec[n];
+            argTypes.push_back(pspec && pspec->m_type != wxPAT_INVALID
+                                ? ArgTypeFromParamType(pspec->m_type)
+                                : wxFormatString::Arg_Unknown);
+        }
+    }
+
+    FormatCacheEntry<CharType>& entry = GetFormatCacheEntry(format);
+    entry.argTypes = std::move(argTypes);
+    entry.hasArgTypes = true;
+
+    return entry.argTypes;
+}
+
+template<typename CharType>
+wxFormatString::ArgumentType GetArgumentTypeUsingCache(const CharType *format,
+                                                       unsigned n)
+{
+    if ( format )
+    {
+        const std::vector<int>& argTypes = GetCachedArgumentTypes(format);
+        if ( n > argTypes.size() )
+            return wxFormatString::Arg_Unused;
+
+        const int argType = argTypes[n - 1];
+        if ( argType != wxFormatString::Arg_Unknown )
+            return static_cast<wxFormatString::ArgumentType>(argType);
+    }
+
+    // Let the non-cached version handle (and report) the errors.
+    return DoGetArgumentType(format, n);
+}
+
+#else // !wxHAS_FORMAT_STRING_CACHE
+
+template<typename CharType>
+wxFormatString::ArgumentType GetArgumentTypeUsingCache(const CharType *format,
+                                                       unsigned n)
+{
+    return DoGetArgumentType(format, n);
+}
+
+#endif // wxHAS_FORMAT_STRING_CACHE/!wxHAS_FORMAT_STRING_CACHE
+
 #if wxDEBUG_LEVEL
 
 template<typename CharType>
@@ -793,6 +1058,29 @@ void DoValidateFormat(const CharType* format, const std::vector<int>& argTypes)
     }
 }
 
+template<typename CharType>
+void ValidateFormatUsingCache(const CharType* format,
+                              const std::vector<int>& argTypes)
+{
+#ifdef wxHAS_FORMAT_STRING_CACHE
+    // Only check if everything is fine here and fall back to the full check
+    // for reporting the errors otherwise.
+    const std::vector<int>& formatArgTypes = GetCachedArgumentTypes(format);
+
+    bool ok = formatArgTypes.size() <= argTypes.size();
+    for ( size_t n = 0; ok && n < formatArgTypes.size(); ++n )
+    {
+        const int ptype = formatArgTypes[n];
+        ok = (ptype & argTypes[n]) == ptype;
+    }
+
+    if ( ok )
+        return;
+#endif // wxHAS_FORMAT_STRING_CACHE
+
+    DoValidateFormat(format, argTypes);
+}
+
 #endif // wxDEBUG_LEVEL
 
 } // anonymous namespace
@@ -800,13 +1088,13 @@ void DoValidateFormat(const CharType* format, const std::vector<int>& argTypes)
 wxFormatString::ArgumentType wxFormatString::GetArgumentType(unsigned n) const
 {
     if ( m_char )
-        return DoGetArgumentType(m_char.data(), n);
+        return GetArgumentTypeUsingCache(m_char.data(), n);
     else if ( m_wchar )
-        return DoGetArgumentType(m_wchar.data(), n);
+        return GetArgumentTypeUsingCache(m_wchar.data(), n);
     else if ( m_str )
-        return DoGetArgumentType(m_str->wx_str(), n);
+        return GetArgumentTypeUsingCache(m_str->wx_str(), n);
     else if ( m_cstr )
-        return DoGetArgumentType(m_cstr->AsInternal(), n);
+        return GetArgumentTypeUsingCache(m_cstr->AsInternal(), n);
 
     wxFAIL_MSG( "unreachable code" );
     return Arg_Unknown;
@@ -817,13 +1105,13 @@ wxFormatString::ArgumentType wxFormatString::GetArgumentType(unsigned n) const
 void wxFormatString::Validate(const std::vector<int>& argTypes) const
 {
     if ( m_char )
-        DoValidateFormat(m_char.data(), argTypes);
+        ValidateFormatUsingCache(m_char.data(), argTypes);
     else if ( m_wchar )
-        DoValidateFormat(m_wchar.data(), argTypes);
+        ValidateFormatUsingCache(m_wchar.data(), argTypes);
     else if ( m_str )
-        DoValidateFormat(m_str->wx_str(), argTypes);
+        ValidateFormatUsingCache(m_str->wx_str(), argTypes);
     else if ( m_cstr )
-        DoValidateFormat(m_cstr->AsInternal(), argTypes);
+        ValidateFormatUsingCache(m_cstr->AsInternal(), argTypes);
 }
 
 #endif // wxDEBUG_LEVEL
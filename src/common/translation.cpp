@@ -45,6 +45,7 @@
 #include "wx/stdpaths.h"
 #include "wx/version.h"
 #include "wx/uilocale.h"
+#include "wx/thread.h"
 
 #ifdef __WINDOWS__
     #include "wx/dynlib.h"
@@ -57,6 +58,7 @@
     #include <map>
 #endif
 
+#include <atomic>
 #include <memory>
 #include <unordered_set>
 
@@ -822,6 +824,18 @@ public:
     // fills the hash with string-translation pairs
     bool FillHash(wxTranslationsHashMap& hash, const wxString& domain) const;
 
+    // return true if the catalog contains a valid hash table which can be
+    // used by GetString() instead of calling FillHash()
+    bool HasHashTable() const { return m_pHashTable != nullptr; }
+
+    // get the translation of the given string using the hash table: this only
+    // converts the strings which are actually used to wxString and caches them
+    //
+    // returns nullptr if not found
+    const wxString *GetString(const wxString& str,
+                              unsigned index,
+                              const wxString& context);
+
     // return the charset of the strings in this catalog or empty string if
     // none/unknown
     wxString GetCharset() const { return m_charset; }
@@ -857,8 +871,38 @@ private:
     wxMsgTableEntry  *m_pOrigTable,   // pointer to original   strings
                      *m_pTransTable;  //            translated
 
+    size_t32          m_nHashSize;    // number of entries in hash table
+    const size_t32   *m_pHashTable;   // pointer to the hash table or nullptr
+
     wxString m_charset;               // from the message catalog header
 
+    // conversion used for the catalog strings, if null, wxConvCurrent is used
+    std::unique_ptr<wxMBConv> m_conv;
+
+    // translations already looked up by GetString(), with empty strings for
+    // the strings without translations, and the critical section protecting
+    // it as GetString() may be called from multiple threads
+    wxTranslationsHashMap m_cache;
+    wxCRIT_SECT_DECLARE_MEMBER(m_cacheCS);
+
+    wxMBConv& GetConv() const
+    {
+        // we must somehow convert the narrow strings in the message catalog to
+        // wide strings, so use the default conversion if we have no charset
+        return m_conv ? *m_conv : *wxConvCurrent;
+    }
+
+    // check that the hash table contains all the strings and is consistent
+    // with GetHashValue()
+    bool CheckHashTable() const;
+
+    // return the index of the given original string using the hash table or
+    // -1 if not found
+    int FindString(const char* str, size_t len) const;
+
+    // compute the hash value of a string as GNU gettext does
+    static wxUint64 GetHashValue(const char* str);
+
 
     // swap the 2 halves of 32 bit integer if needed
     size_t32 Swap(size_t32 ui) const
@@ -893,6 +937,8 @@ private:
 
 wxMsgCatalogFile::wxMsgCatalogFile()
 {
+    m_nHashSize = 0;
+    m_pHashTable = nullptr;
 }
 
 wxMsgCatalogFile::~wxMsgCatalogFile()
@@ -1024,35 +1070,183 @@ bool wxMsgCatalogFile::LoadData(const DataBuffer& data,
             rPluralFormsCalculator.reset(wxPluralFormsCalculator::make());
     }
 
+    if ( !m_charset.empty() )
+        m_conv.reset(new wxCSConv(m_charset));
+
+    // The hash table is optional and only used if it is valid, otherwise the
+    // catalog is loaded using FillHash() as usual.
+    m_nHashSize = Swap(pHeader->nHashSize);
+    m_pHashTable = nullptr;
+    if ( m_nHashSize > 2 )
+    {
+        const wxULongLong_t ofsHashTable = Swap(pHeader->ofsHashTable);
+        const wxULongLong_t tableSize = m_numStrings * sizeof(wxMsgTableEntry);
+        if ( !(ofsHashTable % sizeof(size_t32)) &&
+                ofsHashTable + m_nHashSize*sizeof(size_t32) <= data.length() &&
+                    Swap(pHeader->ofsOrigTable) + tableSize <= data.length() &&
+                        Swap(pHeader->ofsTransTable) + tableSize <= data.length() )
+        {
+            m_pHashTable = reinterpret_cast<const size_t32*>(data.data() +
+                                                             ofsHashTable);
+
+            if ( !CheckHashTable() )
+                m_pHashTable = nullptr;
+        }
+    }
+
     // everything is fine
     return true;
 }
 
-bool wxMsgCatalogFile::FillHash(wxTranslationsHashMap& hash,
-                                const wxString& domain) const
+/* static */
+wxUint64 wxMsgCatalogFile::GetHashValue(const char* str)
 {
-    wxUnusedVar(domain); // silence warning in Unicode build
+    // This is the same function as hash_string() used by GNU gettext to build
+    // the hash table, using 64 bits to give the same result as it on 64 bit
+    // platforms, where the catalogs are normally created nowadays.
+    wxUint64 hval = 0;
+    for ( ; *str; ++str )
+    {
+        hval <<= 4;
+        hval += static_cast<unsigned char>(*str);
 
-    // conversion to use to convert catalog strings to the GUI encoding
-    wxMBConv *inputConv = nullptr;
+        const wxUint64 g = hval & (~static_cast<wxUint64>(0) << 28);
+        if ( g )
+        {
+            hval ^= g >> 24;
+            hval ^= g;
+        }
+    }
 
-    std::unique_ptr<wxMBConv> inputConvPtr; // just to delete inputConv if needed
+    return hval;
+}
 
-    if ( !m_charset.empty() )
+int wxMsgCatalogFile::FindString(const char* str, size_t len) const
+{
+    const wxUint64 hval = GetHashValue(str);
+
+    size_t32 idx = hval % m_nHashSize;
+    const size_t32 incr = 1 + hval % (m_nHashSize - 2);
+
+    for ( size_t32 probes = 0; probes < m_nHashSize; probes++ )
     {
-        inputConv = new wxCSConv(m_charset);
+        size_t32 n = Swap(m_pHashTable[idx]);
+        if ( !n )
+            break;
+
+        // The entries in the hash table are 1-based, as 0 means "empty".
+        n--;
+
+        // Note that the original string of plural entries contains both the
+        // singular and plural forms separated by NUL and we only compare the
+        // singular one.
+        const size_t32 lenOrig = n < m_numStrings ? Swap(m_pOrigTable[n].nLen)
+                                                  : 0;
+        if ( lenOrig >= len )
+        {
+            const char* const orig = StringAtOfs(m_pOrigTable, n);
+            if ( orig && memcmp(orig, str, len) == 0 &&
+                    (lenOrig == len || orig[len] == '\0') )
+                return n;
+        }
 
-        // As we allocated it ourselves, we need to delete it, so ensure
-        // this happens.
-        inputConvPtr.reset(inputConv);
+        if ( idx >= m_nHashSize - incr )
+            idx -= m_nHashSize - incr;
+        else
+            idx += incr;
     }
-    else // no need to convert the encoding
+
+    return -1;
+}
+
+bool wxMsgCatalogFile::CheckHashTable() const
+{
+    // Check that we can find all the strings using the hash table, which
+    // also verifies that all of them are valid. This is much faster than
+    // filling the hash in FillHash() as it doesn't allocate anything.
+    for ( size_t32 i = 0; i < m_numStrings; i++ )
     {
-        // we must somehow convert the narrow strings in the message catalog to
-        // wide strings, so use the default conversion if we have no charset
-        inputConv = wxConvCurrent;
+        const char* const str = StringAtOfs(m_pOrigTable, i);
+        if ( !str || StringAtOfs(m_pTransTable, i) == nullptr )
+            return false;
+
+        const size_t len = wxStrnlen(str, Swap(m_pOrigTable[i].nLen));
+        if ( FindString(str, len) != static_cast<int>(i) )
+            return false;
     }
 
+    return true;
+}
+
+const wxString *wxMsgCatalogFile::GetString(const wxString& str,
+                                            unsigned index,
+                                            const wxString& context)
+{
+    // Use the same keys as FillHash() for the cache.
+    wxString keyFull;
+    if ( !context.empty() )
+        keyFull << context << wxS('\x04') << str;
+    if ( index != 0 )
+    {
+        if ( keyFull.empty() )
+            keyFull = str;
+        keyFull << wxChar(index);
+    }
+
+    const wxString& key = keyFull.empty() ? str : keyFull;
+
+    wxCRIT_SECT_LOCKER(lock, m_cacheCS);
+
+    wxTranslationsHashMap::const_iterator it = m_cache.find(key);
+    if ( it == m_cache.end() )
+    {
+        wxString translation;
+
+        const wxString msgid = context.empty() ? str
+                                               : context + wxS('\x04') + str;
+        const wxScopedCharBuffer buf(msgid.mb_str(GetConv()));
+
+        // Empty buffer is only valid for the catalog header, for all the other
+        // strings it means that they couldn't be converted to the catalog
+        // charset and so can't be found in it.
+        const int n = buf.length() || (str.empty() && context.empty())
+                        ? FindString(buf, buf.length())
+                        : -1;
+        if ( n != -1 )
+        {
+            // Find the translation with the given index among all of them,
+            // see FillHash() for the details.
+            const char* const data = StringAtOfs(m_pTransTable, n);
+            const size_t length = Swap(m_pTransTable[n].nLen);
+            size_t offset = 0;
+            for ( unsigned i = 0; offset < length; i++ )
+            {
+                const char * const s = data + offset;
+                const size_t len = wxStrnlen(s, length - offset);
+                if ( i == index )
+                {
+                    translation = wxString(s, GetConv(), len);
+                    break;
+                }
+
+                offset += len + 1;
+            }
+        }
+
+        it = m_cache.insert(std::make_pair(key, translation)).first;
+    }
+
+    return it->second.empty() ? nullptr : &it->second;
+}
+
+bool wxMsgCatalogFile::FillHash(wxTranslationsHashMap& hash,
+                                const wxString& domain) const
+{
+    wxUnusedVar(domain); // silence warning in Unicode build
+
+    // conversion to use to convert catalog strings to the GUI encoding
+    wxMBConv* const inputConv = &GetConv();
+
     for (size_t32 i = 0; i < m_numStrings; i++)
     {
         const char *data = StringAtOfs(m_pOrigTable, i);
@@ -1111,12 +1305,12 @@ wxMsgCatalog *wxMsgCatalog::CreateFromFile(const wxString& filename,
 {
     std::unique_ptr<wxMsgCatalog> cat(new wxMsgCatalog(domain));
 
-    wxMsgCatalogFile file;
+    std::unique_ptr<wxMsgCatalogFile> file(new wxMsgCatalogFile);
 
-    if ( !file.LoadFile(filename, cat->m_pluralFormsCalculator) )
+    if ( !file->LoadFile(filename, cat->m_pluralFormsCalculator) )
         return nullptr;
 
-    if ( !file.FillHash(cat->m_messages, domain) )
+    if ( !cat->Init(file) )
         return nullptr;
 
     return cat.release();
@@ -1128,17 +1322,36 @@ wxMsgCatalog *wxMsgCatalog::CreateFromData(const wxScopedCharBuffer& data,
 {
     std::unique_ptr<wxMsgCatalog> cat(new wxMsgCatalog(domain));
 
-    wxMsgCatalogFile file;
+    std::unique_ptr<wxMsgCatalogFile> file(new wxMsgCatalogFile);
+
+    // The catalog may keep pointers into the data, see Init(), so make a copy
+    // of it if it's not owned by the buffer, as it could be freed before the
+    // catalog is destroyed then (owned data is just shared, not copied).
+    const wxCharBuffer ownedData(data);
 
-    if ( !file.LoadData(data, cat->m_pluralFormsCalculator) )
+    if ( !file->LoadData(ownedData, cat->m_pluralFormsCalculator) )
         return nullptr;
 
-    if ( !file.FillHash(cat->m_messages, domain) )
+    if ( !cat->Init(file) )
         return nullptr;
 
     return cat.release();
 }
 
+bool wxMsgCatalog::Init(std::unique_ptr<wxMsgCatalogFile>& file)
+{
+    // If the catalog has a hash table, keep its data and look up the strings
+    // in it only when they're needed, instead of converting all of them to
+    // wxString and copying them into our own hash map.
+    if ( file->HasHashTable() )
+    {
+        m_file = std::move(file);
+        return true;
+    }
+
+    return file->FillHash(m_messages, m_domain);
+}
+
 const wxString *wxMsgCatalog::GetString(const wxString& str, unsigned n, const wxString& context) const
 {
     int index = 0;
@@ -1146,6 +1359,10 @@ const wxString *wxMsgCatalog::GetString(const wxString& str, unsigned n, const w
     {
         index = m_pluralFormsCalculator->evaluate(n);
     }
+
+    if ( m_file )
+        return m_file->GetString(str, index, context);
+
     wxTranslationsHashMap::const_iterator i;
     if (index != 0)
     {
@@ -1181,8 +1398,25 @@ namespace
 wxTranslations *gs_translations = nullptr;
 bool gs_translationsOwned = false;
 
+// Incremented whenever the translations change, see GetGeneration(). Notice
+// that 0 is never used, so it starts at 1.
+std::atomic<unsigned> gs_translationsGeneration(1);
+
 } // anonymous namespace
 
+/* static */
+unsigned wxTranslations::GetGeneration()
+{
+    return gs_translationsGeneration.load(std::memory_order_relaxed);
+}
+
+/* static */
+void wxTranslations::TranslationsChanged()
+{
+    if ( ++gs_translationsGeneration == 0 )
+        ++gs_translationsGeneration;
+}
+
 
 /*static*/
 wxTranslations *wxTranslations::Get()
@@ -1197,6 +1431,8 @@ void wxTranslations::Set(wxTranslations *t)
         delete gs_translations;
     gs_translations = t;
     gs_translationsOwned = true;
+
+    TranslationsChanged();
 }
 
 /*static*/
@@ -1206,6 +1442,8 @@ void wxTranslations::SetNonOwned(wxTranslations *t)
         delete gs_translations;
     gs_translations = t;
     gs_translationsOwned = false;
+
+    TranslationsChanged();
 }
 
 
@@ -1228,6 +1466,9 @@ wxTranslations::~wxTranslations()
         m_pMsgCat = m_pMsgCat->m_pNext;
         delete pTmpCat;
     }
+
+    // the strings in the catalogs can't be used any more
+    TranslationsChanged();
 }
 
 
@@ -1251,6 +1492,8 @@ void wxTranslations::SetLanguage(wxLanguage lang)
 void wxTranslations::SetLanguage(const wxString& lang)
 {
     m_lang = lang;
+
+    TranslationsChanged();
 }
 
 
@@ -1361,6 +1604,8 @@ bool wxTranslations::LoadCatalog(const wxString& domain, const wxString& lang)
         m_pMsgCat = cat;
         m_catalogMap[domain] = cat;
 
+        TranslationsChanged();
+
         return true;
     }
     else
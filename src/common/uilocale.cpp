@@ -32,6 +32,7 @@
     #include "wx/language.h"
 #endif
 
+#include "wx/private/sortkey.h"
 #include "wx/private/uilocale.h"
 
 #define TRACE_I18N wxS("i18n")
@@ -1079,6 +1080,15 @@ wxUILocale::CompareStrings(const wxString& lhs,
     return m_impl->CompareStrings(lhs, rhs, flags);
 }
 
+std::string
+wxUILocale::GetSortKey(const wxString& str, int flags) const
+{
+    if ( !m_impl )
+        return wxUILocaleImpl::GetDefaultSortKey(str, flags);
+
+    return m_impl->GetSortKey(str, flags);
+}
+
 wxUILocale::~wxUILocale()
 {
     if ( m_impl )
@@ -1358,6 +1368,16 @@ const wxLanguageInfo* wxUILocale::FindLanguageInfo(const wxLocaleIdent& locId)
     return infoRet;
 }
 
+/* static */
+std::string
+wxUILocaleImpl::GetDefaultSortKey(const wxString& str, int flags)
+{
+    std::string key;
+    wxPrivate::AppendSortKeyChars(key, str,
+                                  (flags & wxCompare_CaseInsensitive) != 0);
+    return key;
+}
+
 #if wxUSE_DATETIME
 int wxUILocaleImpl::ArrayIndexFromFlag(wxDateTime::NameFlags flags)
 {
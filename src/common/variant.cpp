@@ -35,6 +35,8 @@
 #include "wx/string.h"
 #include "wx/tokenzr.h"
 
+#include <new>
+
 wxVariant WXDLLIMPEXP_BASE wxNullVariant;
 
 
@@ -47,6 +49,30 @@ WX_DEFINE_LIST(wxVariantList)
 
 wxIMPLEMENT_DYNAMIC_CLASS(wxVariant, wxObject);
 
+namespace
+{
+
+// Strings are only stored inline if copying them doesn't allocate memory, as
+// otherwise it would be more expensive than just sharing the data, so limit
+// them to the size of the small string buffer of the standard library.
+inline bool IsShortString(const wxString& str)
+{
+    return str.length() < 16 / sizeof(wxStringCharType);
+}
+
+} // anonymous namespace
+
+template <typename T, typename V>
+void wxVariant::DoSetInline(DataKind kind, const V& value)
+{
+    static_assert( sizeof(T) <= sizeof(InlineData) &&
+                    alignof(T) <= alignof(InlineData),
+                   "inline buffer is too small" );
+
+    m_refData = new(m_inlineData.m_buffer) T(value);
+    m_inlineKind = kind;
+}
+
 wxVariant::wxVariant()
     : wxObject()
 {
@@ -62,6 +88,40 @@ void wxVariant::MakeNull()
     UnRef();
 }
 
+void wxVariant::UnRef()
+{
+    if ( m_inlineKind != Kind_Other )
+    {
+        ReleaseHeapCopy();
+
+        wxASSERT_MSG( m_refData->GetRefCount() == 1,
+                      "inline variant data can't be shared" );
+
+        // we can't use DecRef() which would delete the data
+        static_cast<wxVariantData*>(m_refData)->~wxVariantData();
+        m_refData = nullptr;
+        m_inlineKind = Kind_Other;
+    }
+    else
+    {
+        wxObject::UnRef();
+    }
+}
+
+void wxVariant::Ref(const wxVariant& clone)
+{
+    if ( m_refData == clone.m_refData )
+        return;
+
+    UnRef();
+
+    // inline data is copied as it can't be shared with another object
+    if ( clone.m_inlineKind != Kind_Other )
+        DoCopyInline(clone);
+    else
+        wxObject::Ref(clone);
+}
+
 void wxVariant::Clear()
 {
     m_name.clear();
@@ -75,6 +135,22 @@ wxVariant::wxVariant(const wxVariant& variant)
         Ref(variant);
 }
 
+wxVariant::wxVariant(wxVariant&& variant) noexcept
+    : wxObject()
+    , m_name(std::move(variant.m_name))
+{
+    if ( variant.m_inlineKind != Kind_Other )
+    {
+        DoCopyInline(variant);
+        variant.UnRef();
+    }
+    else
+    {
+        m_refData = variant.m_refData;
+        variant.m_refData = nullptr;
+    }
+}
+
 wxVariant::wxVariant(wxVariantData* data, const wxString& name) // User-defined data
     : wxObject()
     , m_name(name)
@@ -84,6 +160,8 @@ wxVariant::wxVariant(wxVariantData* data, const wxString& name) // User-defined
 
 wxVariant::~wxVariant()
 {
+    // release inline data before wxObject dtor tries to do it
+    UnRef();
 }
 
 wxObjectRefData *wxVariant::CreateRefData() const
@@ -105,6 +183,27 @@ void wxVariant::operator= (const wxVariant& variant)
     m_name = variant.m_name;
 }
 
+void wxVariant::operator= (wxVariant&& variant) noexcept
+{
+    if ( &variant == this )
+        return;
+
+    UnRef();
+
+    if ( variant.m_inlineKind != Kind_Other )
+    {
+        DoCopyInline(variant);
+        variant.UnRef();
+    }
+    else
+    {
+        m_refData = variant.m_refData;
+        variant.m_refData = nullptr;
+    }
+
+    m_name = std::move(variant.m_name);
+}
+
 // myVariant = new wxStringVariantData("hello")
 void wxVariant::operator= (wxVariantData* variantData)
 {
@@ -117,10 +216,19 @@ bool wxVariant::operator== (const wxVariant& variant) const
     if (IsNull() || variant.IsNull())
         return (IsNull() == variant.IsNull());
 
-    if (GetType() != variant.GetType())
+    // the inline data kinds correspond to different types, so we don't need
+    // to compare the type names for them
+    if ( m_inlineKind != Kind_Other && variant.m_inlineKind != Kind_Other )
+    {
+        if ( m_inlineKind != variant.m_inlineKind )
+            return false;
+    }
+    else if (GetType() != variant.GetType())
+    {
         return false;
+    }
 
-    return (GetData()->Eq(* variant.GetData()));
+    return (DoGetData()->Eq(* variant.DoGetData()));
 }
 
 bool wxVariant::operator!= (const wxVariant& variant) const
@@ -132,7 +240,7 @@ wxString wxVariant::MakeString() const
 {
     wxString str;
     if (!IsNull())
-        GetData()->Write(str);
+        DoGetData()->Write(str);
     return str;
 }
 
@@ -160,7 +268,7 @@ wxString wxVariant::GetType() const
     if (IsNull())
         return wxString(wxT("null"));
     else
-        return GetData()->GetType();
+        return DoGetData()->GetType();
 }
 
 
@@ -171,7 +279,7 @@ bool wxVariant::IsType(const wxString& type) const
 
 bool wxVariant::IsValueKindOf(const wxClassInfo* type) const
 {
-    wxClassInfo* info=GetData()->GetValueClassInfo();
+    wxClassInfo* info=DoGetData()->GetValueClassInfo();
     return info ? info->IsKindOf(type) : false ;
 }
 
@@ -211,13 +319,11 @@ wxAny wxVariant::GetAny() const
         return wxAny();
 
     wxAny any;
-    wxVariantData* data = GetData();
-
-    if ( data->GetAsAny(&any) )
+    if ( DoGetData()->GetAsAny(&any) )
         return any;
 
     // If everything else fails, wrap the whole wxVariantData
-    return wxAny(data);
+    return wxAny(GetData());
 }
 
 #endif // wxUSE_ANY
@@ -335,19 +441,19 @@ bool wxVariantDataLong::Read(wxString& str)
 
 wxVariant::wxVariant(long val, const wxString& name)
 {
-    m_refData = new wxVariantDataLong(val);
+    DoSetInline<wxVariantDataLong>(Kind_Long, val);
     m_name = name;
 }
 
 wxVariant::wxVariant(int val, const wxString& name)
 {
-    m_refData = new wxVariantDataLong((long)val);
+    DoSetInline<wxVariantDataLong>(Kind_Long, (long)val);
     m_name = name;
 }
 
 wxVariant::wxVariant(short val, const wxString& name)
 {
-    m_refData = new wxVariantDataLong((long)val);
+    DoSetInline<wxVariantDataLong>(Kind_Long, (long)val);
     m_name = name;
 }
 
@@ -367,15 +473,14 @@ bool wxVariant::operator!= (long value) const
 
 void wxVariant::operator= (long value)
 {
-    if (GetType() == wxT("long") &&
-        m_refData->GetRefCount() == 1)
+    if ( m_inlineKind == Kind_Long )
     {
-        ((wxVariantDataLong*)GetData())->SetValue(value);
+        ((wxVariantDataLong*)DoGetMutableData())->SetValue(value);
     }
     else
     {
         UnRef();
-        m_refData = new wxVariantDataLong(value);
+        DoSetInline<wxVariantDataLong>(Kind_Long, value);
     }
 }
 
@@ -487,7 +592,7 @@ bool wxVariantDoubleData::Read(wxString& str)
 
 wxVariant::wxVariant(double val, const wxString& name)
 {
-    m_refData = new wxVariantDoubleData(val);
+    DoSetInline<wxVariantDoubleData>(Kind_Double, val);
     m_name = name;
 }
 
@@ -507,15 +612,14 @@ bool wxVariant::operator!= (double value) const
 
 void wxVariant::operator= (double value)
 {
-    if (GetType() == wxT("double") &&
-        m_refData->GetRefCount() == 1)
+    if ( m_inlineKind == Kind_Double )
     {
-        ((wxVariantDoubleData*)GetData())->SetValue(value);
+        ((wxVariantDoubleData*)DoGetMutableData())->SetValue(value);
     }
     else
     {
         UnRef();
-        m_refData = new wxVariantDoubleData(value);
+        DoSetInline<wxVariantDoubleData>(Kind_Double, value);
     }
 }
 
@@ -630,7 +734,7 @@ bool wxVariantDataBool::Read(wxString& str)
 
 wxVariant::wxVariant(bool val, const wxString& name)
 {
-    m_refData = new wxVariantDataBool(val);
+    DoSetInline<wxVariantDataBool>(Kind_Bool, val);
     m_name = name;
 }
 
@@ -650,15 +754,14 @@ bool wxVariant::operator!= (bool value) const
 
 void wxVariant::operator= (bool value)
 {
-    if (GetType() == wxT("bool") &&
-        m_refData->GetRefCount() == 1)
+    if ( m_inlineKind == Kind_Bool )
     {
-        ((wxVariantDataBool*)GetData())->SetValue(value);
+        ((wxVariantDataBool*)DoGetMutableData())->SetValue(value);
     }
     else
     {
         UnRef();
-        m_refData = new wxVariantDataBool(value);
+        DoSetInline<wxVariantDataBool>(Kind_Bool, value);
     }
 }
 
@@ -774,19 +877,19 @@ bool wxVariantDataChar::Read(wxString& str)
 
 wxVariant::wxVariant(const wxUniChar& val, const wxString& name)
 {
-    m_refData = new wxVariantDataChar(val);
+    DoSetInline<wxVariantDataChar>(Kind_Char, wxUniChar(val));
     m_name = name;
 }
 
 wxVariant::wxVariant(char val, const wxString& name)
 {
-    m_refData = new wxVariantDataChar(val);
+    DoSetInline<wxVariantDataChar>(Kind_Char, wxUniChar(val));
     m_name = name;
 }
 
 wxVariant::wxVariant(wchar_t val, const wxString& name)
 {
-    m_refData = new wxVariantDataChar(val);
+    DoSetInline<wxVariantDataChar>(Kind_Char, wxUniChar(val));
     m_name = name;
 }
 
@@ -801,15 +904,14 @@ bool wxVariant::operator==(const wxUniChar& value) const
 
 wxVariant& wxVariant::operator=(const wxUniChar& value)
 {
-    if (GetType() == wxT("char") &&
-        m_refData->GetRefCount() == 1)
+    if ( m_inlineKind == Kind_Char )
     {
-        ((wxVariantDataChar*)GetData())->SetValue(value);
+        ((wxVariantDataChar*)DoGetMutableData())->SetValue(value);
     }
     else
     {
         UnRef();
-        m_refData = new wxVariantDataChar(value);
+        DoSetInline<wxVariantDataChar>(Kind_Char, value);
     }
 
     return *this;
@@ -934,49 +1036,49 @@ bool wxVariantDataString::Read(wxString& str)
 
 wxVariant::wxVariant(const wxString& val, const wxString& name)
 {
-    m_refData = new wxVariantDataString(val);
+    *this = val;
     m_name = name;
 }
 
 wxVariant::wxVariant(const char* val, const wxString& name)
 {
-    m_refData = new wxVariantDataString(wxString(val));
+    *this = wxString(val);
     m_name = name;
 }
 
 wxVariant::wxVariant(const wchar_t* val, const wxString& name)
 {
-    m_refData = new wxVariantDataString(wxString(val));
+    *this = wxString(val);
     m_name = name;
 }
 
 wxVariant::wxVariant(const wxCStrData& val, const wxString& name)
 {
-    m_refData = new wxVariantDataString(val.AsString());
+    *this = val.AsString();
     m_name = name;
 }
 
 wxVariant::wxVariant(const wxScopedCharBuffer& val, const wxString& name)
 {
-    m_refData = new wxVariantDataString(wxString(val));
+    *this = wxString(val);
     m_name = name;
 }
 
 wxVariant::wxVariant(const wxScopedWCharBuffer& val, const wxString& name)
 {
-    m_refData = new wxVariantDataString(wxString(val));
+    *this = wxString(val);
     m_name = name;
 }
 
 wxVariant::wxVariant(const std::string& val, const wxString& name)
 {
-    m_refData = new wxVariantDataString(wxString(val));
+    *this = wxString(val);
     m_name = name;
 }
 
 wxVariant::wxVariant(const std::wstring& val, const wxString& name)
 {
-    m_refData = new wxVariantDataString(wxString(val));
+    *this = wxString(val);
     m_name = name;
 }
 
@@ -996,10 +1098,23 @@ bool wxVariant::operator!= (const wxString& value) const
 
 wxVariant& wxVariant::operator= (const wxString& value)
 {
-    if (GetType() == wxT("string") &&
-        m_refData->GetRefCount() == 1)
+    if ( IsShortString(value) )
+    {
+        if ( m_inlineKind == Kind_String )
+        {
+            ((wxVariantDataString*)DoGetMutableData())->SetValue(value);
+        }
+        else
+        {
+            UnRef();
+            DoSetInline<wxVariantDataString>(Kind_String, value);
+        }
+    }
+    else if ( m_inlineKind == Kind_Other &&
+                GetDataKind() == Kind_String &&
+                    m_refData->GetRefCount() == 1 )
     {
-        ((wxVariantDataString*)GetData())->SetValue(value);
+        ((wxVariantDataString*)DoGetMutableData())->SetValue(value);
     }
     else
     {
@@ -1125,7 +1240,7 @@ wxVariant::wxVariant( wxObject* val, const wxString& name)
 
 bool wxVariant::operator== (wxObject* value) const
 {
-    return (value == ((wxVariantDataWxObjectPtr*)GetData())->GetValue());
+    return (value == ((wxVariantDataWxObjectPtr*)DoGetData())->GetValue());
 }
 
 bool wxVariant::operator!= (wxObject* value) const
@@ -1219,13 +1334,13 @@ bool wxVariantDataVoidPtr::Read(wxString& WXUNUSED(str))
 
 wxVariant::wxVariant( void* val, const wxString& name)
 {
-    m_refData = new wxVariantDataVoidPtr(val);
+    DoSetInline<wxVariantDataVoidPtr>(Kind_VoidPtr, val);
     m_name = name;
 }
 
 bool wxVariant::operator== (void* value) const
 {
-    return (value == ((wxVariantDataVoidPtr*)GetData())->GetValue());
+    return (value == ((wxVariantDataVoidPtr*)DoGetData())->GetValue());
 }
 
 bool wxVariant::operator!= (void* value) const
@@ -1235,14 +1350,14 @@ bool wxVariant::operator!= (void* value) const
 
 void wxVariant::operator= (void* value)
 {
-    if (GetType() == wxT("void*") && (m_refData->GetRefCount() == 1))
+    if ( m_inlineKind == Kind_VoidPtr )
     {
-        ((wxVariantDataVoidPtr*)GetData())->SetValue(value);
+        ((wxVariantDataVoidPtr*)DoGetMutableData())->SetValue(value);
     }
     else
     {
         UnRef();
-        m_refData = new wxVariantDataVoidPtr(value);
+        DoSetInline<wxVariantDataVoidPtr>(Kind_VoidPtr, value);
     }
 }
 
@@ -1347,7 +1462,7 @@ bool wxVariantDataDateTime::Read(wxString& str)
 
 wxVariant::wxVariant(const wxDateTime& val, const wxString& name) // Date
 {
-    m_refData = new wxVariantDataDateTime(val);
+    DoSetInline<wxVariantDataDateTime>(Kind_DateTime, val);
     m_name = name;
 }
 
@@ -1367,15 +1482,14 @@ bool wxVariant::operator!= (const wxDateTime& value) const
 
 void wxVariant::operator= (const wxDateTime& value)
 {
-    if (GetType() == wxT("datetime") &&
-        m_refData->GetRefCount() == 1)
+    if ( m_inlineKind == Kind_DateTime )
     {
-        ((wxVariantDataDateTime*)GetData())->SetValue(value);
+        ((wxVariantDataDateTime*)DoGetMutableData())->SetValue(value);
     }
     else
     {
         UnRef();
-        m_refData = new wxVariantDataDateTime(value);
+        DoSetInline<wxVariantDataDateTime>(Kind_DateTime, value);
     }
 }
 
@@ -1501,7 +1615,7 @@ void wxVariant::operator=(const wxArrayString& value)
     if (GetType() == wxT("arrstring") &&
         m_refData->GetRefCount() == 1)
     {
-        ((wxVariantDataArrayString *)GetData())->SetValue(value);
+        ((wxVariantDataArrayString *)DoGetMutableData())->SetValue(value);
     }
     else
     {
@@ -1513,7 +1627,7 @@ void wxVariant::operator=(const wxArrayString& value)
 wxArrayString wxVariant::GetArrayString() const
 {
     if ( GetType() == wxT("arrstring") )
-        return ((wxVariantDataArrayString *)GetData())->GetValue();
+        return ((wxVariantDataArrayString *)DoGetData())->GetValue();
 
     return wxArrayString();
 }
@@ -1642,7 +1756,7 @@ bool wxVariantDataLongLong::Read(wxString& str)
 
 wxVariant::wxVariant(wxLongLong val, const wxString& name)
 {
-    m_refData = new wxVariantDataLongLong(val);
+    DoSetInline<wxVariantDataLongLong>(Kind_LongLong, val);
     m_name = name;
 }
 
@@ -1662,15 +1776,14 @@ bool wxVariant::operator!=(wxLongLong value) const
 
 void wxVariant::operator=(wxLongLong value)
 {
-    if ( GetType() == wxS("longlong") &&
-         m_refData->GetRefCount() == 1 )
+    if ( m_inlineKind == Kind_LongLong )
     {
-        ((wxVariantDataLongLong*)GetData())->SetValue(value);
+        ((wxVariantDataLongLong*)DoGetMutableData())->SetValue(value);
     }
     else
     {
         UnRef();
-        m_refData = new wxVariantDataLongLong(value);
+        DoSetInline<wxVariantDataLongLong>(Kind_LongLong, value);
     }
 }
 
@@ -1813,7 +1926,7 @@ bool wxVariantDataULongLong::Read(wxString& str)
 
 wxVariant::wxVariant(wxULongLong val, const wxString& name)
 {
-    m_refData = new wxVariantDataULongLong(val);
+    DoSetInline<wxVariantDataULongLong>(Kind_ULongLong, val);
     m_name = name;
 }
 
@@ -1833,15 +1946,14 @@ bool wxVariant::operator!=(wxULongLong value) const
 
 void wxVariant::operator=(wxULongLong value)
 {
-    if ( GetType() == wxS("ulonglong") &&
-         m_refData->GetRefCount() == 1 )
+    if ( m_inlineKind == Kind_ULongLong )
     {
-        ((wxVariantDataULongLong*)GetData())->SetValue(value);
+        ((wxVariantDataULongLong*)DoGetMutableData())->SetValue(value);
     }
     else
     {
         UnRef();
-        m_refData = new wxVariantDataULongLong(value);
+        DoSetInline<wxVariantDataULongLong>(Kind_ULongLong, value);
     }
 }
 
@@ -2043,7 +2155,7 @@ bool wxVariant::operator== (const wxVariantList& value) const
     wxASSERT_MSG( (GetType() == wxT("list")), wxT("Invalid type for == operator") );
 
     wxVariantDataList other(value);
-    return (GetData()->Eq(other));
+    return (DoGetData()->Eq(other));
 }
 
 bool wxVariant::operator!= (const wxVariantList& value) const
@@ -2056,7 +2168,7 @@ void wxVariant::operator= (const wxVariantList& value)
     if (GetType() == wxT("list") &&
         m_refData->GetRefCount() == 1)
     {
-        ((wxVariantDataList*)GetData())->SetValue(value);
+        ((wxVariantDataList*)DoGetMutableData())->SetValue(value);
     }
     else
     {
@@ -2179,114 +2291,282 @@ size_t wxVariant::GetCount() const
     return 0;
 }
 
+// ----------------------------------------------------------------------------
+// Inline data support
+// ----------------------------------------------------------------------------
+
+void wxVariant::MoveDataToHeap()
+{
+    wxVariantData* const data = DoGetData()->Clone();
+    UnRef();
+    m_refData = data;
+}
+
+wxVariantData* wxVariant::GetHeapCopy() const
+{
+    wxVariantData* copy = m_heapCopy.load(std::memory_order_acquire);
+    if ( !copy )
+    {
+        wxVariantData* const newCopy = DoGetData()->Clone();
+        if ( m_heapCopy.compare_exchange_strong(copy, newCopy,
+                                                std::memory_order_acq_rel) )
+            copy = newCopy;
+        else // another thread has already created it, use its copy
+            newCopy->DecRef();
+    }
+
+    return copy;
+}
+
+void wxVariant::ReleaseHeapCopy()
+{
+    wxVariantData* const copy = m_heapCopy.exchange(nullptr);
+    if ( copy )
+        copy->DecRef();
+}
+
+void wxVariant::DoCopyInline(const wxVariant& variant)
+{
+    const wxVariantData* const data = variant.DoGetData();
+
+    switch ( variant.m_inlineKind )
+    {
+        case Kind_Long:
+            DoSetInline<wxVariantDataLong>
+                (Kind_Long, static_cast<const wxVariantDataLong*>(data)->GetValue());
+            break;
+
+        case Kind_Double:
+            DoSetInline<wxVariantDoubleData>
+                (Kind_Double, static_cast<const wxVariantDoubleData*>(data)->GetValue());
+            break;
+
+        case Kind_Bool:
+            DoSetInline<wxVariantDataBool>
+                (Kind_Bool, static_cast<const wxVariantDataBool*>(data)->GetValue());
+            break;
+
+        case Kind_Char:
+            DoSetInline<wxVariantDataChar>
+                (Kind_Char, static_cast<const wxVariantDataChar*>(data)->GetValue());
+            break;
+
+        case Kind_String:
+            DoSetInline<wxVariantDataString>
+                (Kind_String, static_cast<const wxVariantDataString*>(data)->GetValue());
+            break;
+
+        case Kind_VoidPtr:
+            DoSetInline<wxVariantDataVoidPtr>
+                (Kind_VoidPtr, static_cast<const wxVariantDataVoidPtr*>(data)->GetValue());
+            break;
+
+        case Kind_DateTime:
+#if wxUSE_DATETIME
+            DoSetInline<wxVariantDataDateTime>
+                (Kind_DateTime, static_cast<const wxVariantDataDateTime*>(data)->GetValue());
+#endif // wxUSE_DATETIME
+            break;
+
+        case Kind_LongLong:
+            DoSetInline<wxVariantDataLongLong>
+                (Kind_LongLong, static_cast<const wxVariantDataLongLong*>(data)->GetValue());
+            break;
+
+        case Kind_ULongLong:
+            DoSetInline<wxVariantDataULongLong>
+                (Kind_ULongLong, static_cast<const wxVariantDataULongLong*>(data)->GetValue());
+            break;
+
+        case Kind_Other:
+            wxFAIL_MSG( "variant data is not inline" );
+            break;
+    }
+}
+
+wxVariant::DataKind wxVariant::GetDataKind() const
+{
+    if ( m_inlineKind != Kind_Other || !m_refData )
+        return m_inlineKind;
+
+    // The data of the built-in types can still be allocated on the heap, e.g.
+    // when creating wxVariant from wxAny or for long strings, so we need to
+    // check its type name in this case.
+    const wxString type = DoGetData()->GetType();
+    if ( type == wxS("string") )
+        return Kind_String;
+    if ( type == wxS("long") )
+        return Kind_Long;
+    if ( type == wxS("double") )
+        return Kind_Double;
+    if ( type == wxS("bool") )
+        return Kind_Bool;
+    if ( type == wxS("char") )
+        return Kind_Char;
+    if ( type == wxS("void*") )
+        return Kind_VoidPtr;
+    if ( type == wxS("datetime") )
+        return Kind_DateTime;
+    if ( type == wxS("longlong") )
+        return Kind_LongLong;
+    if ( type == wxS("ulonglong") )
+        return Kind_ULongLong;
+
+    return Kind_Other;
+}
+
 // ----------------------------------------------------------------------------
 // Type conversion
 // ----------------------------------------------------------------------------
 
 bool wxVariant::Convert(long* value) const
 {
-    wxString type(GetType());
-    if (type == wxS("double"))
-        *value = (long) (((wxVariantDoubleData*)GetData())->GetValue());
-    else if (type == wxS("long"))
-        *value = ((wxVariantDataLong*)GetData())->GetValue();
-    else if (type == wxS("bool"))
-        *value = (long) (((wxVariantDataBool*)GetData())->GetValue());
-    else if (type == wxS("string"))
-        *value = wxAtol(((wxVariantDataString*)GetData())->GetValue());
-    else if (type == wxS("longlong"))
-    {
-        wxLongLong v = ((wxVariantDataLongLong*)GetData())->GetValue();
-        // Don't convert if return value would be vague
-        if ( v < LONG_MIN || v > LONG_MAX )
-            return false;
-        *value = v.ToLong();
-    }
-    else if (type == wxS("ulonglong"))
+    switch ( GetDataKind() )
     {
-        wxULongLong v = ((wxVariantDataULongLong*)GetData())->GetValue();
-        // Don't convert if return value would be vague
-        if ( v.GetHi() )
+        case Kind_Double:
+            *value = (long) (((wxVariantDoubleData*)DoGetData())->GetValue());
+            break;
+
+        case Kind_Long:
+            *value = ((wxVariantDataLong*)DoGetData())->GetValue();
+            break;
+
+        case Kind_Bool:
+            *value = (long) (((wxVariantDataBool*)DoGetData())->GetValue());
+            break;
+
+        case Kind_String:
+            *value = wxAtol(((wxVariantDataString*)DoGetData())->GetValue());
+            break;
+
+        case Kind_LongLong:
+            {
+                wxLongLong v = ((wxVariantDataLongLong*)DoGetData())->GetValue();
+                // Don't convert if return value would be vague
+                if ( v < LONG_MIN || v > LONG_MAX )
+                    return false;
+                *value = v.ToLong();
+            }
+            break;
+
+        case Kind_ULongLong:
+            {
+                wxULongLong v = ((wxVariantDataULongLong*)DoGetData())->GetValue();
+                // Don't convert if return value would be vague
+                if ( v.GetHi() )
+                    return false;
+                *value = (long) v.ToULong();
+            }
+            break;
+
+        default:
             return false;
-        *value = (long) v.ToULong();
     }
-    else
-        return false;
 
     return true;
 }
 
 bool wxVariant::Convert(bool* value) const
 {
-    wxString type(GetType());
-    if (type == wxT("double"))
-        *value = ((int) (((wxVariantDoubleData*)GetData())->GetValue()) != 0);
-    else if (type == wxT("long"))
-        *value = (((wxVariantDataLong*)GetData())->GetValue() != 0);
-    else if (type == wxT("bool"))
-        *value = ((wxVariantDataBool*)GetData())->GetValue();
-    else if (type == wxT("string"))
-    {
-        wxString val(((wxVariantDataString*)GetData())->GetValue());
-        val.MakeLower();
-        if (val == wxT("true") || val == wxT("yes") || val == wxT('1') )
-            *value = true;
-        else if (val == wxT("false") || val == wxT("no") || val == wxT('0') )
-            *value = false;
-        else
+    switch ( GetDataKind() )
+    {
+        case Kind_Double:
+            *value = ((int) (((wxVariantDoubleData*)DoGetData())->GetValue()) != 0);
+            break;
+
+        case Kind_Long:
+            *value = (((wxVariantDataLong*)DoGetData())->GetValue() != 0);
+            break;
+
+        case Kind_Bool:
+            *value = ((wxVariantDataBool*)DoGetData())->GetValue();
+            break;
+
+        case Kind_String:
+            {
+                wxString val(((wxVariantDataString*)DoGetData())->GetValue());
+                val.MakeLower();
+                if (val == wxT("true") || val == wxT("yes") || val == wxT('1') )
+                    *value = true;
+                else if (val == wxT("false") || val == wxT("no") || val == wxT('0') )
+                    *value = false;
+                else
+                    return false;
+            }
+            break;
+
+        default:
             return false;
     }
-    else
-        return false;
 
     return true;
 }
 
 bool wxVariant::Convert(double* value) const
 {
-    wxString type(GetType());
-    if (type == wxT("double"))
-        *value = ((wxVariantDoubleData*)GetData())->GetValue();
-    else if (type == wxT("long"))
-        *value = (double) (((wxVariantDataLong*)GetData())->GetValue());
-    else if (type == wxT("bool"))
-        *value = (double) (((wxVariantDataBool*)GetData())->GetValue());
-    else if (type == wxT("string"))
-        *value = (double) wxAtof(((wxVariantDataString*)GetData())->GetValue());
-    else if (type == wxS("longlong"))
-    {
-        *value = ((wxVariantDataLongLong*)GetData())->GetValue().ToDouble();
-    }
-    else if (type == wxS("ulonglong"))
+    switch ( GetDataKind() )
     {
-        *value = ((wxVariantDataULongLong*)GetData())->GetValue().ToDouble();
+        case Kind_Double:
+            *value = ((wxVariantDoubleData*)DoGetData())->GetValue();
+            break;
+
+        case Kind_Long:
+            *value = (double) (((wxVariantDataLong*)DoGetData())->GetValue());
+            break;
+
+        case Kind_Bool:
+            *value = (double) (((wxVariantDataBool*)DoGetData())->GetValue());
+            break;
+
+        case Kind_String:
+            *value = (double) wxAtof(((wxVariantDataString*)DoGetData())->GetValue());
+            break;
+
+        case Kind_LongLong:
+            *value = ((wxVariantDataLongLong*)DoGetData())->GetValue().ToDouble();
+            break;
+
+        case Kind_ULongLong:
+            *value = ((wxVariantDataULongLong*)DoGetData())->GetValue().ToDouble();
+            break;
+
+        default:
+            return false;
     }
-    else
-        return false;
 
     return true;
 }
 
 bool wxVariant::Convert(wxUniChar* value) const
 {
-    wxString type(GetType());
-    if (type == wxT("char"))
-        *value = ((wxVariantDataChar*)GetData())->GetValue();
-    else if (type == wxT("long"))
-        *value = (char) (((wxVariantDataLong*)GetData())->GetValue());
-    else if (type == wxT("bool"))
-        *value = (char) (((wxVariantDataBool*)GetData())->GetValue());
-    else if (type == wxS("string"))
-    {
-        // Also accept strings of length 1
-        const wxString& str = (((wxVariantDataString*)GetData())->GetValue());
-        if ( str.length() == 1 )
-            *value = str[0];
-        else
+    switch ( GetDataKind() )
+    {
+        case Kind_Char:
+            *value = ((wxVariantDataChar*)DoGetData())->GetValue();
+            break;
+
+        case Kind_Long:
+            *value = (char) (((wxVariantDataLong*)DoGetData())->GetValue());
+            break;
+
+        case Kind_Bool:
+            *value = (char) (((wxVariantDataBool*)DoGetData())->GetValue());
+            break;
+
+        case Kind_String:
+            {
+                // Also accept strings of length 1
+                const wxString& str = (((wxVariantDataString*)DoGetData())->GetValue());
+                if ( str.length() == 1 )
+                    *value = str[0];
+                else
+                    return false;
+            }
+            break;
+
+        default:
             return false;
     }
-    else
-        return false;
 
     return true;
 }
@@ -2311,69 +2591,99 @@ bool wxVariant::Convert(wchar_t* value) const
 
 bool wxVariant::Convert(wxString* value) const
 {
-    *value = MakeString();
+    // avoid the virtual Write() call in the most common case
+    if ( m_inlineKind == Kind_String )
+        *value = ((wxVariantDataString*)DoGetData())->GetValue();
+    else
+        *value = MakeString();
     return true;
 }
 
 bool wxVariant::Convert(wxLongLong* value) const
 {
-    wxString type(GetType());
-    if (type == wxS("longlong"))
-        *value = ((wxVariantDataLongLong*)GetData())->GetValue();
-    else if (type == wxS("long"))
-        *value = ((wxVariantDataLong*)GetData())->GetValue();
-    else if (type == wxS("string"))
+    switch ( GetDataKind() )
     {
-        wxString s = ((wxVariantDataString*)GetData())->GetValue();
-        wxLongLong_t value_t;
-        if ( !s.ToLongLong(&value_t) )
+        case Kind_LongLong:
+            *value = ((wxVariantDataLongLong*)DoGetData())->GetValue();
+            break;
+
+        case Kind_Long:
+            *value = ((wxVariantDataLong*)DoGetData())->GetValue();
+            break;
+
+        case Kind_String:
+            {
+                wxString s = ((wxVariantDataString*)DoGetData())->GetValue();
+                wxLongLong_t value_t;
+                if ( !s.ToLongLong(&value_t) )
+                    return false;
+                *value = value_t;
+            }
+            break;
+
+        case Kind_Bool:
+            *value = (long) (((wxVariantDataBool*)DoGetData())->GetValue());
+            break;
+
+        case Kind_Double:
+            value->Assign(((wxVariantDoubleData*)DoGetData())->GetValue());
+            break;
+
+        case Kind_ULongLong:
+            *value = ((wxVariantDataULongLong*)DoGetData())->GetValue();
+            break;
+
+        default:
             return false;
-        *value = value_t;
-    }
-    else if (type == wxS("bool"))
-        *value = (long) (((wxVariantDataBool*)GetData())->GetValue());
-    else if (type == wxS("double"))
-    {
-        value->Assign(((wxVariantDoubleData*)GetData())->GetValue());
     }
-    else if (type == wxS("ulonglong"))
-        *value = ((wxVariantDataULongLong*)GetData())->GetValue();
-    else
-        return false;
 
     return true;
 }
 
 bool wxVariant::Convert(wxULongLong* value) const
 {
-    wxString type(GetType());
-    if (type == wxS("ulonglong"))
-        *value = ((wxVariantDataULongLong*)GetData())->GetValue();
-    else if (type == wxS("long"))
-        *value = ((wxVariantDataLong*)GetData())->GetValue();
-    else if (type == wxS("string"))
-    {
-        wxString s = ((wxVariantDataString*)GetData())->GetValue();
-        wxULongLong_t value_t;
-        if ( !s.ToULongLong(&value_t) )
-            return false;
-        *value = value_t;
-    }
-    else if (type == wxS("bool"))
-        *value = (long) (((wxVariantDataBool*)GetData())->GetValue());
-    else if (type == wxS("double"))
+    switch ( GetDataKind() )
     {
-        double value_d = ((wxVariantDoubleData*)GetData())->GetValue();
-
-        if ( value_d < 0.0 )
+        case Kind_ULongLong:
+            *value = ((wxVariantDataULongLong*)DoGetData())->GetValue();
+            break;
+
+        case Kind_Long:
+            *value = ((wxVariantDataLong*)DoGetData())->GetValue();
+            break;
+
+        case Kind_String:
+            {
+                wxString s = ((wxVariantDataString*)DoGetData())->GetValue();
+                wxULongLong_t value_t;
+                if ( !s.ToULongLong(&value_t) )
+                    return false;
+                *value = value_t;
+            }
+            break;
+
+        case Kind_Bool:
+            *value = (long) (((wxVariantDataBool*)DoGetData())->GetValue());
+            break;
+
+        case Kind_Double:
+            {
+                double value_d = ((wxVariantDoubleData*)DoGetData())->GetValue();
+
+                if ( value_d < 0.0 )
+                    return false;
+
+                *value = (wxULongLong_t) value_d;
+            }
+            break;
+
+        case Kind_LongLong:
+            *value = ((wxVariantDataLongLong*)DoGetData())->GetValue();
+            break;
+
+        default:
             return false;
-
-        *value = (wxULongLong_t) value_d;
     }
-    else if (type == wxS("longlong"))
-        *value = ((wxVariantDataLongLong*)GetData())->GetValue();
-    else
-        return false;
 
     return true;
 }
@@ -2381,10 +2691,9 @@ bool wxVariant::Convert(wxULongLong* value) const
 #if wxUSE_DATETIME
 bool wxVariant::Convert(wxDateTime* value) const
 {
-    wxString type(GetType());
-    if (type == wxT("datetime"))
+    if ( GetDataKind() == Kind_DateTime )
     {
-        *value = ((wxVariantDataDateTime*)GetData())->GetValue();
+        *value = ((wxVariantDataDateTime*)DoGetData())->GetValue();
         return true;
     }
 
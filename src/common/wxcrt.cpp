@@ -478,7 +478,17 @@ int wxDoSnprintfWchar(wchar_t *str, size_t size, const wxChar *format, ...)
     va_list argptr;
     va_start(argptr, format);
 
+#if wxUSE_UNICODE_WCHAR
+    // Format directly into the provided buffer without creating a temporary
+    // wxString for the format, as wxVsnprintf() would do.
+    int rv = wxCRT_VsnprintfW(str, size, format, argptr);
+
+    // See the comment in wxVsnprintf() below.
+    if ( size )
+        str[size - 1] = 0;
+#else
     int rv = wxVsnprintf(str, size, format, argptr);
+#endif
 
     va_end(argptr);
     return rv;
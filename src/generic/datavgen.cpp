@@ -54,6 +54,9 @@
 #include "wx/private/markupparser.h"
 #endif // wxUSE_ACCESSIBILITY
 
+#include <unordered_map>
+#include <unordered_set>
+
 //-----------------------------------------------------------------------------
 // classes
 //-----------------------------------------------------------------------------
@@ -533,12 +536,29 @@ public:
     void InsertChild(wxDataViewMainWindow* window,
                      wxDataViewTreeNode *node, unsigned index);
 
+    // Insert several nodes at once, this is more efficient than calling
+    // InsertChild() for each of them. The positions are only used if the
+    // children are not sorted and must be in increasing order, each of them
+    // being the index of the existing child before which the corresponding
+    // node is inserted. If they are empty, the nodes are appended.
+    void InsertChildren(wxDataViewMainWindow* window,
+                        const wxDataViewTreeNodes& nodes,
+                        const wxVector<unsigned>& positions);
+
     void RemoveChild(unsigned index)
     {
         wxCHECK_RET( m_branchData != nullptr, "leaf node doesn't have children" );
         m_branchData->RemoveChild(index);
     }
 
+    // Remove the children at the given indices, which must be sorted in
+    // increasing order, at once. The nodes themselves are not deleted.
+    void RemoveChildren(const wxVector<unsigned>& indices)
+    {
+        wxCHECK_RET( m_branchData != nullptr, "leaf node doesn't have children" );
+        m_branchData->RemoveChildren(indices);
+    }
+
     // returns position of child node for given item in children list or wxNOT_FOUND
     int FindChildByItem(const wxDataViewItem& item) const
     {
@@ -659,6 +679,10 @@ public:
     }
 
 private:
+    // Prepare for inserting new children and return true if they should be
+    // inserted in the sort order, which is then stored in m_branchData.
+    bool PrepareToInsertChildren(wxDataViewMainWindow* window);
+
     // Called by the child after it has been updated to put it in the right
     // place among its siblings, depending on the sort order.
     //
@@ -692,6 +716,21 @@ private:
             children.erase(children.begin() + index);
         }
 
+        void RemoveChildren(const wxVector<unsigned>& indices)
+        {
+            size_t next = 0;
+            size_t dst = indices.empty() ? children.size() : indices[0];
+            for ( size_t src = dst; src < children.size(); src++ )
+            {
+                if ( next < indices.size() && indices[next] == src )
+                    next++;
+                else
+                    children[dst++] = children[src];
+            }
+
+            children.resize(dst);
+        }
+
         // Child nodes. Note that this may be empty even if m_hasChildren in
         // case this branch of the tree wasn't expanded and realized yet.
         wxDataViewTreeNodes  children;
@@ -733,7 +772,9 @@ public:
 
     // notifications from wxDataViewModel
     bool ItemAdded( const wxDataViewItem &parent, const wxDataViewItem &item );
+    bool ItemsAdded( const wxDataViewItem &parent, const wxDataViewItemArray &items );
     bool ItemDeleted( const wxDataViewItem &parent, const wxDataViewItem &item );
+    bool ItemsDeleted( const wxDataViewItem &parent, const wxDataViewItemArray &items );
     bool ItemChanged( const wxDataViewItem &item )
     {
         return DoItemChanged(item, wxNOT_FOUND);
@@ -1092,8 +1133,12 @@ public:
 
     virtual bool ItemAdded( const wxDataViewItem & parent, const wxDataViewItem & item ) override
         { return m_mainWindow->ItemAdded( parent , item ); }
+    virtual bool ItemsAdded( const wxDataViewItem &parent, const wxDataViewItemArray &items ) override
+        { return m_mainWindow->ItemsAdded( parent, items ); }
     virtual bool ItemDeleted( const wxDataViewItem &parent, const wxDataViewItem &item ) override
         { return m_mainWindow->ItemDeleted( parent, item ); }
+    virtual bool ItemsDeleted( const wxDataViewItem &parent, const wxDataViewItemArray &items ) override
+        { return m_mainWindow->ItemsDeleted( parent, items ); }
     virtual bool ItemChanged( const wxDataViewItem & item ) override
         { return m_mainWindow->ItemChanged(item);  }
     virtual bool ValueChanged( const wxDataViewItem & item , unsigned int col ) override
@@ -1849,27 +1894,95 @@ private:
     const SortOrder m_sortOrder;
 };
 
+// Sort the nodes by the values in the column specified by the given sort
+// order, which must use a column.
+//
+// This must only be used if the model UsesDefaultCompare() and results in the
+// same order as sorting using wxGenericTreeModelNodeCmp, but is much faster
+// as the values are retrieved only once for each node instead of twice for
+// each comparison.
+void SortNodesByValue(wxDataViewModel* model,
+                      wxDataViewTreeNodes& nodes,
+                      const SortOrder& sortOrder)
+{
+    struct SortKey
+    {
+        wxVariant value;
+        wxDataViewTreeNode* node;
+    };
+
+    const unsigned int column = sortOrder.GetColumn();
+    const bool ascending = sortOrder.IsAscending();
+
+    const size_t count = nodes.size();
+    wxVector<SortKey> keys(count);
+    for ( size_t n = 0; n < count; n++ )
+    {
+        SortKey& key = keys[n];
+        key.node = nodes[n];
+
+        // Don't call GetValue() for the cells without values, as Compare().
+        const wxDataViewItem& item = key.node->GetItem();
+        if ( model->HasValue(item, column) )
+            model->GetValue(key.value, item, column);
+    }
+
+    std::sort(keys.begin(), keys.end(),
+              [model, ascending](const SortKey& key1, const SortKey& key2)
+              {
+                  const int res = ascending
+                                ? model->CompareValues(key1.value, key2.value)
+                                : model->CompareValues(key2.value, key1.value);
+                  if ( res )
+                      return res < 0;
+
+                  // Order the equal items in the same way as Compare().
+                  const wxUIntPtr
+                      id1 = wxPtrToUInt(key1.node->GetItem().GetID()),
+                      id2 = wxPtrToUInt(key2.node->GetItem().GetID());
+
+                  return ascending ? id1 < id2 : id1 > id2;
+              });
+
+    for ( size_t n = 0; n < count; n++ )
+        nodes[n] = keys[n].node;
+}
+
+// Sort the nodes using the given sort order in the most efficient way.
+void SortNodes(wxDataViewMainWindow* window,
+               wxDataViewTreeNodes& nodes,
+               const SortOrder& sortOrder)
+{
+    wxDataViewModel* const model = window->GetModel();
+    if ( sortOrder.UsesColumn() && model->UsesDefaultCompare() )
+    {
+        SortNodesByValue(model, nodes, sortOrder);
+    }
+    else
+    {
+        std::sort(nodes.begin(), nodes.end(),
+                  wxGenericTreeModelNodeCmp(window, sortOrder));
+    }
+}
+
 } // anonymous namespace
 
-void wxDataViewTreeNode::InsertChild(wxDataViewMainWindow* window,
-                                     wxDataViewTreeNode *node, unsigned index)
+bool wxDataViewTreeNode::PrepareToInsertChildren(wxDataViewMainWindow* window)
 {
     if (!m_branchData)
         m_branchData = new BranchNodeData;
 
     const SortOrder sortOrder = window->GetSortOrder();
 
-    // Flag indicating whether we should retain existing sorted list when
-    // inserting the child node.
-    bool insertSorted = false;
-
     if ( sortOrder.IsNone() )
     {
         // We should insert assuming an unsorted list. This will cause the
         // child list to lose the current sort order, if any.
         m_branchData->sortOrder = SortOrder();
+        return false;
     }
-    else if ( m_branchData->children.empty() )
+
+    if ( m_branchData->children.empty() )
     {
         if ( m_branchData->open )
         {
@@ -1877,45 +1990,49 @@ void wxDataViewTreeNode::InsertChild(wxDataViewMainWindow* window,
             // item (there is only one), but we do need to remember the sort
             // order to use for the subsequent ones.
             m_branchData->sortOrder = sortOrder;
+            return true;
         }
-        else
-        {
-            // We're inserting the first child of a closed node. We can choose
-            // whether to consider this empty child list sorted or unsorted.
-            // By choosing unsorted, we postpone comparisons until the parent
-            // node is opened in the view, which may be never.
-            m_branchData->sortOrder = SortOrder();
-        }
+
+        // We're inserting the first child of a closed node. We can choose
+        // whether to consider this empty child list sorted or unsorted.
+        // By choosing unsorted, we postpone comparisons until the parent
+        // node is opened in the view, which may be never.
+        m_branchData->sortOrder = SortOrder();
+        return false;
     }
-    else if ( m_branchData->open )
+
+    if ( m_branchData->open )
     {
         // For open branches, children should be already sorted.
         wxASSERT_MSG( m_branchData->sortOrder == sortOrder,
                       wxS("Logic error in wxDVC sorting code") );
 
         // We can use fast insertion.
-        insertSorted = true;
+        return true;
     }
-    else if ( m_branchData->sortOrder == sortOrder )
+
+    if ( m_branchData->sortOrder == sortOrder )
     {
         // The children are already sorted by the correct criteria (because
         // the node must have been opened in the same time in the past). Even
         // though it is closed now, we still insert in sort order to avoid a
         // later resort.
-        insertSorted = true;
-    }
-    else
-    {
-        // The children of this closed node aren't sorted by the correct
-        // criteria, so we just insert unsorted.
-        m_branchData->sortOrder = SortOrder();
+        return true;
     }
 
+    // The children of this closed node aren't sorted by the correct
+    // criteria, so we just insert unsorted.
+    m_branchData->sortOrder = SortOrder();
+    return false;
+}
 
-    if ( insertSorted )
+void wxDataViewTreeNode::InsertChild(wxDataViewMainWindow* window,
+                                     wxDataViewTreeNode *node, unsigned index)
+{
+    if ( PrepareToInsertChildren(window) )
     {
         // Use binary search to find the correct position to insert at.
-        wxGenericTreeModelNodeCmp cmp(window, sortOrder);
+        wxGenericTreeModelNodeCmp cmp(window, m_branchData->sortOrder);
         int lo = 0, hi = m_branchData->children.size();
         while ( lo < hi )
         {
@@ -1936,6 +2053,60 @@ void wxDataViewTreeNode::InsertChild(wxDataViewMainWindow* window,
     }
 }
 
+void wxDataViewTreeNode::InsertChildren(wxDataViewMainWindow* window,
+                                        const wxDataViewTreeNodes& nodes,
+                                        const wxVector<unsigned>& positions)
+{
+    const bool insertSorted = PrepareToInsertChildren(window);
+
+    wxDataViewTreeNodes& children = m_branchData->children;
+    const size_t oldCount = children.size();
+
+    if ( insertSorted )
+    {
+        // Sort the new nodes and merge them with the existing ones, which are
+        // already sorted, instead of searching for the position of each of
+        // them and moving all the subsequent nodes every time.
+        const SortOrder& sortOrder = m_branchData->sortOrder;
+
+        wxDataViewTreeNodes sorted(nodes);
+        SortNodes(window, sorted, sortOrder);
+
+        children.insert(children.end(), sorted.begin(), sorted.end());
+        std::inplace_merge(children.begin(),
+                           children.begin() + oldCount,
+                           children.end(),
+                           wxGenericTreeModelNodeCmp(window, sortOrder));
+    }
+    else if ( positions.empty() )
+    {
+        // This happens when the nodes were supposed to be inserted in sorted
+        // order, but the children of this closed node are not sorted by the
+        // current criteria, so just append them, they will be sorted when the
+        // node is opened.
+        children.insert(children.end(), nodes.begin(), nodes.end());
+    }
+    else
+    {
+        wxCHECK_RET( positions.size() == nodes.size(), "positions mismatch" );
+
+        wxDataViewTreeNodes merged;
+        merged.reserve(oldCount + nodes.size());
+
+        size_t next = 0;
+        for ( size_t n = 0; n <= oldCount; n++ )
+        {
+            while ( next < nodes.size() && positions[next] <= n )
+                merged.push_back(nodes[next++]);
+
+            if ( n < oldCount )
+                merged.push_back(children[n]);
+        }
+
+        children.swap(merged);
+    }
+}
+
 
 void wxDataViewTreeNode::Resort(wxDataViewMainWindow* window)
 {
@@ -1956,9 +2127,7 @@ void wxDataViewTreeNode::Resort(wxDataViewMainWindow* window)
         // using model-specific sort order, which can change at any time.
         if ( m_branchData->sortOrder != sortOrder || !sortOrder.UsesColumn() )
         {
-            std::sort(m_branchData->children.begin(),
-                      m_branchData->children.end(),
-                      wxGenericTreeModelNodeCmp(window, sortOrder));
+            SortNodes(window, nodes, sortOrder);
 
             m_branchData->sortOrder = sortOrder;
         }
@@ -2013,34 +2182,29 @@ wxDataViewTreeNode::PutChildInSortOrder(wxDataViewMainWindow* window,
 
     wxGenericTreeModelNodeCmp cmp(window, m_branchData->sortOrder);
 
-    // Check if we actually need to move the node.
-    bool locationChanged = false;
-
-    // Compare with next node
-    if ( oldLocation != hi - 1)
+    // Check if we actually need to move the node. Note that it can only move
+    // towards the neighbour it's out of order with, the nodes on the other
+    // side remain sorted with respect to it, so we need to search for its new
+    // position only among the nodes on this side.
+    int lo;
+    if ( oldLocation != hi - 1 && !cmp(childNode, nodes[oldLocation + 1]) )
     {
-        if ( !cmp(childNode, nodes[oldLocation + 1]) )
-            locationChanged = true;
+        lo = oldLocation + 1;
     }
-
-    // Compare with previous node
-    if ( !locationChanged && oldLocation > 0 )
+    else if ( oldLocation > 0 && !cmp(nodes[oldLocation - 1], childNode) )
     {
-        if ( !cmp(nodes[oldLocation - 1], childNode) )
-            locationChanged = true;
+        lo = 0;
+        hi = oldLocation;
     }
-
-    if ( !locationChanged )
+    else
+    {
         return;
+    }
 
-    // Remove and reinsert the node in the child list
-    m_branchData->RemoveChild(oldLocation);
-    hi = nodes.size();
-    int lo = 0;
     while ( lo < hi )
     {
         int mid = lo + (hi - lo) / 2;
-        int r = cmp.Compare(childNode, m_branchData->children[mid]);
+        int r = cmp.Compare(childNode, nodes[mid]);
         if ( r < 0 )
             hi = mid;
         else if ( r > 0 )
@@ -2048,7 +2212,21 @@ wxDataViewTreeNode::PutChildInSortOrder(wxDataViewMainWindow* window,
         else
             lo = hi = mid;
     }
-    m_branchData->InsertChild(childNode, lo);
+
+    // Move the node to its new position, shifting only the nodes between the
+    // old and the new one.
+    if ( lo > oldLocation )
+    {
+        std::rotate(nodes.begin() + oldLocation,
+                    nodes.begin() + oldLocation + 1,
+                    nodes.begin() + lo);
+    }
+    else
+    {
+        std::rotate(nodes.begin() + lo,
+                    nodes.begin() + oldLocation,
+                    nodes.begin() + oldLocation + 1);
+    }
 
     // Make sure the change is actually shown right away
     window->UpdateDisplay();
@@ -3224,6 +3402,136 @@ bool wxDataViewMainWindow::ItemAdded(const wxDataViewItem & parent, const wxData
     return true;
 }
 
+bool wxDataViewMainWindow::ItemsAdded(const wxDataViewItem& parent,
+                                      const wxDataViewItemArray& items)
+{
+    // Adding the items one by one is fine for virtual list models, as it only
+    // updates the count, and for a single item, of course.
+    if ( IsVirtualList() || items.size() < 2 )
+    {
+        for ( size_t n = 0; n < items.size(); n++ )
+        {
+            if ( !ItemAdded(parent, items[n]) )
+                return false;
+        }
+
+        return true;
+    }
+
+    // specific position (row) is unclear, so clear whole height cache
+    ClearRowHeightCache();
+
+    const FindNodeResult findResult = FindNode(parent);
+    wxDataViewTreeNode *parentNode = findResult.m_node;
+
+    // These checks are the same as in ItemAdded(), see the comments there.
+    if ( !findResult.m_subtreeRealized )
+        return true;
+
+    if ( !parentNode )
+        return false;
+
+    if ( !parentNode->HasChildren() )
+    {
+        parentNode->SetHasChildren(true);
+        return true;
+    }
+
+    if ( !parentNode->IsOpen() && parentNode->GetChildNodes().empty() )
+        return true;
+
+    const wxDataViewModel* const model = GetModel();
+
+    wxDataViewTreeNodes nodes;
+    nodes.reserve(items.size());
+
+    wxVector<unsigned> positions;
+
+    if ( GetSortOrder().IsNone() )
+    {
+        // There's no sorting, so insert the new items in the model order, each
+        // of them before the first existing node following it in the model.
+        std::unordered_set<void*> newItems;
+        for ( size_t n = 0; n < items.size(); n++ )
+            newItems.insert(items[n].GetID());
+
+        const wxDataViewTreeNodes& nodeSiblings = parentNode->GetChildNodes();
+        const unsigned nodeSiblingsSize = nodeSiblings.size();
+
+        std::unordered_map<void*, unsigned> nodePositions;
+        for ( unsigned n = 0; n < nodeSiblingsSize; n++ )
+            nodePositions[nodeSiblings[n]->GetItem().GetID()] = n;
+
+        wxDataViewItemArray modelSiblings;
+        model->GetChildren(parent, modelSiblings);
+
+        for ( size_t n = 0; n < modelSiblings.size(); n++ )
+        {
+            const wxDataViewItem& sibling = modelSiblings[n];
+            if ( newItems.count(sibling.GetID()) )
+            {
+                nodes.push_back(new wxDataViewTreeNode(parentNode, sibling));
+                continue;
+            }
+
+            const auto it = nodePositions.find(sibling.GetID());
+            if ( it != nodePositions.end() )
+                positions.resize(nodes.size(), it->second);
+        }
+
+        // Append the remaining items to the end.
+        positions.resize(nodes.size(), nodeSiblingsSize);
+
+        if ( nodes.size() != newItems.size() )
+        {
+            for ( size_t n = 0; n < nodes.size(); n++ )
+                delete nodes[n];
+
+            wxFAIL_MSG( "adding non-existent item?" );
+            return false;
+        }
+    }
+    else
+    {
+        // Node list is or will be sorted, so positions are not needed (if
+        // the children turn out to be unsorted, the nodes are appended).
+        for ( size_t n = 0; n < items.size(); n++ )
+            nodes.push_back(new wxDataViewTreeNode(parentNode, items[n]));
+    }
+
+    for ( size_t n = 0; n < nodes.size(); n++ )
+        nodes[n]->SetHasChildren(model->IsContainer(nodes[n]->GetItem()));
+
+    parentNode->ChangeSubTreeCount(static_cast<int>(nodes.size()));
+    parentNode->InsertChildren(this, nodes, positions);
+
+    InvalidateCount();
+
+    if ( !m_selection.IsEmpty() )
+    {
+        // Update the selection for all the new rows, in increasing order, as
+        // ItemAdded() would do, but without looking up the row of each item.
+        const std::unordered_set<wxDataViewTreeNode*>
+            newNodes(nodes.begin(), nodes.end());
+
+        int row = GetRowByItem(parent) + 1;
+
+        const wxDataViewTreeNodes& children = parentNode->GetChildNodes();
+        for ( size_t n = 0; n < children.size(); n++ )
+        {
+            if ( newNodes.count(children[n]) )
+                m_selection.OnItemsInserted(row, 1);
+
+            row += 1 + children[n]->GetSubTreeCount();
+        }
+    }
+
+    GetOwner()->InvalidateColBestWidths();
+    UpdateDisplay();
+
+    return true;
+}
+
 bool wxDataViewMainWindow::ItemDeleted(const wxDataViewItem& parent,
                                        const wxDataViewItem& item)
 {
@@ -3347,6 +3655,108 @@ bool wxDataViewMainWindow::ItemDeleted(const wxDataViewItem& parent,
     return true;
 }
 
+bool wxDataViewMainWindow::ItemsDeleted(const wxDataViewItem& parent,
+                                        const wxDataViewItemArray& items)
+{
+    if ( IsVirtualList() || items.size() < 2 )
+    {
+        for ( size_t n = 0; n < items.size(); n++ )
+        {
+            if ( !ItemDeleted(parent, items[n]) )
+                return false;
+        }
+
+        return true;
+    }
+
+    // These checks are the same as in ItemDeleted(), see the comments there.
+    const FindNodeResult findResult = FindNode(parent);
+    wxDataViewTreeNode *parentNode = findResult.m_node;
+
+    if ( !findResult.m_subtreeRealized )
+        return true;
+
+    if ( !parentNode )
+        return true;
+
+    wxCHECK_MSG( parentNode->HasChildren(), false, "parent node doesn't have children?" );
+
+    std::unordered_set<void*> deletedItems;
+    for ( size_t n = 0; n < items.size(); n++ )
+        deletedItems.insert(items[n].GetID());
+
+    // Find all the nodes to delete in a single pass over the children, also
+    // remembering the rows they occupy if we need to update the selection.
+    const bool updateSelection = !m_selection.IsEmpty();
+    int row = updateSelection ? GetRowByItem(parent) + 1 : 0;
+
+    wxVector<unsigned> positions;
+    wxDataViewTreeNodes itemNodes;
+    wxVector<int> rows;
+    int itemsDeleted = 0;
+
+    const wxDataViewTreeNodes& parentsChildren = parentNode->GetChildNodes();
+    for ( size_t n = 0; n < parentsChildren.size(); n++ )
+    {
+        wxDataViewTreeNode* const node = parentsChildren[n];
+        const int rowsCount = 1 + node->GetSubTreeCount();
+
+        if ( deletedItems.count(node->GetItem().GetID()) )
+        {
+            positions.push_back(n);
+            itemNodes.push_back(node);
+            itemsDeleted += rowsCount;
+
+            if ( updateSelection )
+                rows.push_back(row);
+        }
+
+        row += rowsCount;
+    }
+
+    if ( itemNodes.empty() )
+    {
+        if ( parentNode->GetChildNodes().empty() )
+            parentNode->SetHasChildren(GetModel()->IsContainer(parent));
+
+        return true;
+    }
+
+    ClearRowHeightCache();
+
+    parentNode->RemoveChildren(positions);
+    parentNode->ChangeSubTreeCount(-itemsDeleted);
+
+    InvalidateCount();
+
+    if ( parentNode->GetChildNodes().empty() )
+    {
+        bool isContainer = GetModel()->IsContainer(parent);
+        parentNode->SetHasChildren(isContainer);
+        if ( isContainer && parentNode->IsOpen() )
+            parentNode->ToggleOpen(this);
+    }
+
+    // Update the selection starting from the last deleted item, so that the
+    // rows of the preceding ones remain valid.
+    for ( size_t n = rows.size(); n > 0; n-- )
+    {
+        m_selection.OnItemsDeleted(rows[n - 1],
+                                   1 + itemNodes[n - 1]->GetSubTreeCount());
+    }
+
+    for ( size_t n = 0; n < itemNodes.size(); n++ )
+        delete itemNodes[n];
+
+    if ( HasCurrentRow() && m_currentRow >= GetRowCount() )
+        ChangeCurrentRow(m_count - 1);
+
+    GetOwner()->InvalidateColBestWidths();
+    UpdateDisplay();
+
+    return true;
+}
+
 bool wxDataViewMainWindow::DoItemChanged(const wxDataViewItem & item, int view_column)
 {
     if ( !IsVirtualList() )
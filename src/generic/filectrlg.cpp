@@ -27,6 +27,7 @@
 #include "wx/file.h"        // for wxS_IXXX constants only
 #include "wx/generic/dirctrlg.h" // for wxFileIconsTable
 #include "wx/dir.h"
+#include "wx/flathashmap.h"
 #include "wx/tokenzr.h"
 #include "wx/imaglist.h"
 
@@ -45,6 +46,43 @@
 // private functions
 // ----------------------------------------------------------------------------
 
+#ifdef wxHAS_GENERIC_CMP_NATURAL
+
+// Calling wxCmpNatural() for each comparison is slow for big directories, so
+// compare the natural sort keys, computed only once for each item, instead.
+WX_DECLARE_FLAT_VOIDPTR_HASH_MAP(std::string, wxFileDataSortKeys);
+
+struct wxFileDataNameSortData
+{
+    wxFileDataSortKeys keys;
+    long sortOrder;
+};
+
+static
+int wxCALLBACK wxFileDataNameCompare( wxIntPtr data1, wxIntPtr data2, wxIntPtr sortData)
+{
+     const wxFileDataNameSortData& sd =
+         *static_cast<const wxFileDataNameSortData*>(wxUIntToPtr(sortData));
+     const long sortOrder = sd.sortOrder;
+
+     wxFileData *fd1 = (wxFileData *)wxUIntToPtr(data1);
+     wxFileData *fd2 = (wxFileData *)wxUIntToPtr(data2);
+
+     if (fd1->GetFileName() == wxT(".."))
+         return -sortOrder;
+     if (fd2->GetFileName() == wxT(".."))
+         return sortOrder;
+     if (fd1->IsDir() && !fd2->IsDir())
+         return -sortOrder;
+     if (fd2->IsDir() && !fd1->IsDir())
+         return sortOrder;
+
+     const int rc = sd.keys.at(fd1).compare(sd.keys.at(fd2));
+     return rc > 0 ? sortOrder : rc < 0 ? -sortOrder : 0;
+}
+
+#else // !wxHAS_GENERIC_CMP_NATURAL
+
 static
 int wxCALLBACK wxFileDataNameCompare( wxIntPtr data1, wxIntPtr data2, wxIntPtr sortOrder)
 {
@@ -63,6 +101,8 @@ int wxCALLBACK wxFileDataNameCompare( wxIntPtr data1, wxIntPtr data2, wxIntPtr s
      return sortOrder*wxCmpNatural( fd1->GetFileName(), fd2->GetFileName() );
 }
 
+#endif // wxHAS_GENERIC_CMP_NATURAL/!wxHAS_GENERIC_CMP_NATURAL
+
 static
 int wxCALLBACK wxFileDataSizeCompare(wxIntPtr data1, wxIntPtr data2, wxIntPtr sortOrder)
 {
@@ -847,7 +887,25 @@ void wxFileListCtrl::SortItems(wxFileData::fileListFieldType field, bool forward
 
         case wxFileData::FileList_Name :
         default :
+#ifdef wxHAS_GENERIC_CMP_NATURAL
+            {
+                wxFileDataNameSortData sortData;
+                sortData.sortOrder = sort_dir;
+
+                const int count = GetItemCount();
+                sortData.keys.reserve(count);
+                for ( int n = 0; n < count; n++ )
+                {
+                    wxFileData *fd = (wxFileData *)wxUIntToPtr(GetItemData(n));
+                    sortData.keys[fd] = wxGetNaturalSortKey(fd->GetFileName());
+                }
+
+                wxListCtrl::SortItems(wxFileDataNameCompare,
+                                      wxPtrToUInt(&sortData));
+            }
+#else // !wxHAS_GENERIC_CMP_NATURAL
             wxListCtrl::SortItems(wxFileDataNameCompare, sort_dir);
+#endif // wxHAS_GENERIC_CMP_NATURAL/!wxHAS_GENERIC_CMP_NATURAL
             break;
     }
 }
@@ -61,6 +61,12 @@ const char wxGridNameStr[] = "grid";
 // Required for wxIs... functions
 #include <ctype.h>
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
 // ----------------------------------------------------------------------------
 // globals
 // ----------------------------------------------------------------------------
@@ -85,6 +91,10 @@ struct DefaultHeaderRenderers
     wxGridCornerHeaderRendererDefault cornerRenderer;
 } gs_defaultHeaderRenderers;
 
+// incremented whenever a cell attribute becomes a part of a multicell or stops
+// being one, see wxGridCellAttrData::UpdateAttrRowsOrCols()
+unsigned gs_cellSpanChanges = 0;
+
 } // anonymous namespace
 
 // ----------------------------------------------------------------------------
@@ -641,7 +651,10 @@ void wxGridCellAttr::MergeWith(wxGridCellAttr *mergefrom)
         SetAlignment(hAlign, vAlign);
     }
     if ( !HasSize() && mergefrom->HasSize() )
+    {
         mergefrom->GetSize( &m_sizeRows, &m_sizeCols );
+        gs_cellSpanChanges++;
+    }
 
     // Directly access member functions as GetRender/Editor don't just return
     // m_renderer/m_editor
@@ -687,6 +700,9 @@ void wxGridCellAttr::SetSize(int num_rows, int num_cols)
                   !((num_rows == 0) && (num_cols == 0))),
                   wxT("wxGridCellAttr::SetSize only takes two positive values or negative/zero values"));
 
+    if ( HasSize() != (num_rows != 1 || num_cols != 1) )
+        gs_cellSpanChanges++;
+
     m_sizeRows = num_rows;
     m_sizeCols = num_cols;
 }
@@ -933,6 +949,136 @@ wxGridCellEditor* wxGridCellAttr::GetEditor(const wxGrid* grid, int row, int col
     return editor;
 }
 
+// ----------------------------------------------------------------------------
+// wxGridPosToIndexMap
+// ----------------------------------------------------------------------------
+
+void wxGridPosToIndexMap::Reset()
+{
+    m_segments.assign(1, Segment{0, 0});
+    m_byIndex.clear();
+    m_nextIndex = INT_MIN;
+}
+
+size_t wxGridPosToIndexMap::FindSegment(int pos) const
+{
+    const auto it = std::upper_bound(m_segments.begin(), m_segments.end(), pos,
+                                     [](int p, const Segment& segment)
+                                     {
+                                         return p < segment.pos;
+                                     });
+
+    // Invalid negative positions just use the first segment.
+    return it == m_segments.begin() ? 0 : it - m_segments.begin() - 1;
+}
+
+int wxGridPosToIndexMap::GetIndex(int pos) const
+{
+    const Segment& segment = m_segments[FindSegment(pos)];
+
+    return segment.index + (pos - segment.pos);
+}
+
+int wxGridPosToIndexMap::GetPos(int index) const
+{
+    if ( m_byIndex.empty() )
+    {
+        m_byIndex.resize(m_segments.size());
+        for ( size_t n = 0; n < m_byIndex.size(); ++n )
+            m_byIndex[n] = n;
+
+        std::sort(m_byIndex.begin(), m_byIndex.end(),
+                  [this](size_t n1, size_t n2)
+                  {
+                      return m_segments[n1].index < m_segments[n2].index;
+                  });
+    }
+
+    auto it = std::upper_bound(m_byIndex.begin(), m_byIndex.end(), index,
+                               [this](int i, size_t n)
+                               {
+                                   return i < m_segments[n].index;
+                               });
+    if ( it == m_byIndex.begin() )
+        return wxNOT_FOUND;
+
+    const size_t n = *--it;
+    const Segment& segment = m_segments[n];
+
+    // Use 64 bit arithmetic as the indices can be of different signs.
+    const wxLongLong_t offset = static_cast<wxLongLong_t>(index) - segment.index;
+    if ( n + 1 < m_segments.size() &&
+            offset >= m_segments[n + 1].pos - segment.pos )
+        return wxNOT_FOUND;
+
+    return segment.pos + static_cast<int>(offset);
+}
+
+size_t wxGridPosToIndexMap::SplitAt(int pos)
+{
+    const size_t n = FindSegment(pos);
+    const Segment& segment = m_segments[n];
+    if ( segment.pos == pos )
+        return n;
+
+    const Segment tail{pos, segment.index + (pos - segment.pos)};
+    m_segments.insert(m_segments.begin() + n + 1, tail);
+
+    return n + 1;
+}
+
+void wxGridPosToIndexMap::MergeWithPrevious(size_t n)
+{
+    if ( n == 0 || n >= m_segments.size() )
+        return;
+
+    const Segment& prev = m_segments[n - 1];
+    if ( static_cast<wxLongLong_t>(prev.index) + (m_segments[n].pos - prev.pos)
+            == m_segments[n].index )
+        m_segments.erase(m_segments.begin() + n);
+}
+
+void wxGridPosToIndexMap::Insert(int pos, int count)
+{
+    m_byIndex.clear();
+
+    const size_t n = SplitAt(pos);
+    m_segments.insert(m_segments.begin() + n, Segment{pos, m_nextIndex});
+    m_nextIndex += count;
+
+    for ( size_t i = n + 1; i < m_segments.size(); ++i )
+        m_segments[i].pos += count;
+
+    // This keeps the number of segments constant when inserting the positions
+    // one by one, e.g. when appending them.
+    MergeWithPrevious(n + 1);
+    MergeWithPrevious(n);
+}
+
+std::vector<std::pair<int, int>> wxGridPosToIndexMap::Delete(int pos, int count)
+{
+    m_byIndex.clear();
+
+    const size_t first = SplitAt(pos);
+    const size_t last = SplitAt(pos + count);
+
+    std::vector<std::pair<int, int>> deleted;
+    for ( size_t n = first; n < last; ++n )
+    {
+        deleted.push_back(std::make_pair(m_segments[n].index,
+                                         m_segments[n + 1].pos - m_segments[n].pos));
+    }
+
+    m_segments.erase(m_segments.begin() + first, m_segments.begin() + last);
+
+    for ( size_t n = first; n < m_segments.size(); ++n )
+        m_segments[n].pos -= count;
+
+    MergeWithPrevious(first);
+
+    return deleted;
+}
+
 // ----------------------------------------------------------------------------
 // wxGridCellAttrData
 // ----------------------------------------------------------------------------
@@ -956,6 +1102,18 @@ void KeyToCoords(wxGridCoordsToAttrMap::key_type key, int *pRow, int *pCol)
     *pCol = key & wxUINT32_MAX;
 }
 
+// Hash function allowing to use wxGridCellCoords in unordered containers.
+struct CellCoordsHash
+{
+    size_t operator()(const wxGridCellCoords& coords) const
+    {
+        return std::hash<wxGridCoordsToAttrMap::key_type>()
+            (CoordsToKey(coords.GetRow(), coords.GetCol()));
+    }
+};
+
+using CellCoordsSet = std::unordered_set<wxGridCellCoords, CellCoordsHash>;
+
 } // anonymous namespace
 
 wxGridCellAttrData::~wxGridCellAttrData()
@@ -970,29 +1128,60 @@ wxGridCellAttrData::~wxGridCellAttrData()
     m_attrs.clear();
 }
 
+void wxGridCellAttrData::AddAttr(KeyType key, wxGridCellAttr *attr)
+{
+    m_attrs[key] = attr;
+
+    int rowIndex, colIndex;
+    KeyToCoords(key, &rowIndex, &colIndex);
+    m_rowsKeys.insert(key);
+    m_colsKeys.insert(CoordsToKey(colIndex, rowIndex));
+}
+
+void wxGridCellAttrData::RemoveAttr(wxGridCoordsToAttrMap::iterator it)
+{
+    int rowIndex, colIndex;
+    KeyToCoords(it->first, &rowIndex, &colIndex);
+    m_rowsKeys.erase(it->first);
+    m_colsKeys.erase(CoordsToKey(colIndex, rowIndex));
+
+    it->second->DecRef();
+    m_attrs.erase(it);
+}
+
 void wxGridCellAttrData::SetAttr(wxGridCellAttr *attr, int row, int col)
 {
     wxGridCoordsToAttrMap::iterator it = FindIndex(row, col);
+
+    // The multicells must be found again if this cell was or becomes one.
+    if ( (attr && attr->HasSize()) ||
+            (it != m_attrs.end() && it->second->HasSize()) )
+        m_multicellsValid = false;
+
     if ( it == m_attrs.end() )
     {
         if ( attr )
         {
             // add the attribute
-            m_attrs[CoordsToKey(row, col)] = attr;
+            AddAttr(CoordsToKey(m_rows.GetIndex(row), m_cols.GetIndex(col)),
+                    attr);
         }
         //else: nothing to do
     }
     else // we already have an attribute for this cell
     {
-        // See note near DecRef() in wxGridRowOrColAttrData::SetAttr for why
-        // this also works when old and new attribute are the same.
-        it->second->DecRef();
-
         // Change or remove the attribute.
         if ( attr )
+        {
+            // See note near DecRef() in wxGridRowOrColAttrData::SetAttr for
+            // why this also works when old and new attribute are the same.
+            it->second->DecRef();
             it->second = attr;
+        }
         else
-            m_attrs.erase(it);
+        {
+            RemoveAttr(it);
+        }
     }
 }
 
@@ -1010,46 +1199,103 @@ wxGridCellAttr *wxGridCellAttrData::GetAttr(int row, int col) const
     return attr;
 }
 
-namespace
+void wxGridCellAttrData::RemoveAttrs(int first, int count, bool rows)
 {
+    std::set<KeyType>& keys = rows ? m_rowsKeys : m_colsKeys;
+    std::set<KeyType>& otherKeys = rows ? m_colsKeys : m_rowsKeys;
+
+    const wxLongLong_t end = static_cast<wxLongLong_t>(first) + count;
+    for ( std::set<KeyType>::iterator it = keys.lower_bound(CoordsToKey(first, 0));
+          it != keys.end(); )
+    {
+        int index, otherIndex;
+        KeyToCoords(*it, &index, &otherIndex);
+        if ( index >= end )
+            break;
+
+        it = keys.erase(it);
+        otherKeys.erase(CoordsToKey(otherIndex, index));
+
+        const KeyType key = rows ? CoordsToKey(index, otherIndex)
+                                 : CoordsToKey(otherIndex, index);
+        wxGridCoordsToAttrMap::iterator itAttr = m_attrs.find(key);
+        itAttr->second->DecRef();
+        m_attrs.erase(itAttr);
+    }
+}
 
-void UpdateCellAttrRowsOrCols(wxGridCoordsToAttrMap& attrs, int editPos,
-                              int editRowCount, int editColCount)
+void wxGridCellAttrData::UpdateAttrRowsOrCols(int editPos, int editCount,
+                                              bool isEditingRows)
 {
-    wxASSERT( !editRowCount || !editColCount );
+    if ( m_attrs.empty() )
+    {
+        // Take this opportunity to make the indices trivial again.
+        m_rows.Reset();
+        m_cols.Reset();
+        return;
+    }
 
-    const bool isEditingRows = (editRowCount != 0);
-    const int editCount = (isEditingRows ? editRowCount : editColCount);
+    const int editRowCount = isEditingRows ? editCount : 0;
+    const int editColCount = isEditingRows ? 0 : editCount;
 
-    // Copy updated attributes to a new map instead of attempting to edit attrs
-    // map in-place. This requires more memory but greatly simplifies the code
-    // and any attempt with in-place editing would likely also require a lot
-    // more attr lookups.
-    // The updated copy will contain an attrs map with, if applicable: adjusted
-    // coords and cell size, newly inserted attributes (for multicells), and
-    // without now deleted attributes.
-    wxGridCoordsToAttrMap newAttrs;
+    wxGridPosToIndexMap& indices = isEditingRows ? m_rows : m_cols;
 
-    for ( wxGridCoordsToAttrMap::iterator it = attrs.begin();
-          it != attrs.end();
-          ++it )
+    // The attributes of the cells are indexed by the row and column indices
+    // which don't change when rows or columns are inserted or deleted, so
+    // nothing needs to be done for most of them, except for removing the
+    // attributes of the deleted cells. But multicells sizes depend on the
+    // positions of their cells, so they still need to be updated here.
+    if ( !m_multicellsValid || m_multicellsChanges != gs_cellSpanChanges )
+    {
+        m_multicells.clear();
+        for ( const auto& kv : m_attrs )
+        {
+            if ( kv.second->HasSize() )
+                m_multicells.push_back(kv.first);
+        }
+
+        m_multicellsValid = true;
+    }
+
+    // The attributes to remove, as their multicell main cell is deleted.
+    std::vector<KeyType> removedAttrs;
+
+    // The attributes to add for the inside cells of the multicells which
+    // grow, at their position after the insertion.
+    struct NewAttr
     {
-        const wxGridCoordsToAttrMap::key_type oldCoords = it->first;
+        int pos;
+        int otherIndex;
+        wxGridCellAttr* attr;
+    };
+    std::vector<NewAttr> newAttrs;
+
+    for ( const KeyType key : m_multicells )
+    {
+        wxGridCoordsToAttrMap::iterator it = m_attrs.find(key);
+        if ( it == m_attrs.end() )
+            continue;
+
         wxGridCellAttr* cellAttr = it->second;
 
         int cellRows, cellCols;
         cellAttr->GetSize(&cellRows, &cellCols);
 
-        int cellRow, cellCol;
-        KeyToCoords(oldCoords, &cellRow, &cellCol);
+        const wxGrid::CellSpan cellSpan = GetCellSpan(cellRows, cellCols);
+        if ( cellSpan == wxGrid::CellSpan_None )
+            continue;
+
+        int rowIndex, colIndex;
+        KeyToCoords(key, &rowIndex, &colIndex);
 
-        const int cellPos = isEditingRows ? cellRow : cellCol;
+        const int cellPos = indices.GetPos(isEditingRows ? rowIndex : colIndex);
+        const int otherIndex = isEditingRows ? colIndex : rowIndex;
 
         if ( cellPos < editPos )
         {
             // This cell's coords aren't influenced by the editing, however
             // do adjust a multicell's main size, if needed.
-            if ( GetCellSpan(cellRows, cellCols) == wxGrid::CellSpan_Main )
+            if ( cellSpan == wxGrid::CellSpan_Main )
             {
                 int mainSize = isEditingRows ? cellRows : cellCols;
                 if ( cellPos + mainSize > editPos )
@@ -1110,35 +1356,23 @@ void UpdateCellAttrRowsOrCols(wxGridCoordsToAttrMap& attrs, int editPos,
                 }
             }
 
-            // Set attribute at old/unmodified coords.
-            newAttrs[oldCoords] = cellAttr;
-
             continue;
         }
 
         if ( editCount < 0 && cellPos < editPos - editCount )
         {
-            // This row/col is deleted and the cell doesn't exist any longer:
-            // Remove the attribute.
-            cellAttr->DecRef();
-
+            // This row/col is deleted and its attribute is removed below
+            // together with all the other attributes in it.
             continue;
         }
 
-        const wxGridCoordsToAttrMap::key_type newCoords
-            = CoordsToKey(cellRow + editRowCount, cellCol + editColCount);
-
-        if ( GetCellSpan(cellRows, cellCols) != wxGrid::CellSpan_Inside )
+        if ( cellSpan != wxGrid::CellSpan_Inside )
         {
-            // Rows/cols inserted or deleted (and this cell still exists):
-            // Adjust cell coords.
-            newAttrs[newCoords] = cellAttr;
-
-            // Nothing more to do: cell is not an inside cell of a multicell.
+            // Nothing to do: cell is not an inside cell of a multicell.
             continue;
         }
 
-        // Handle inside cell's existence, coords, and size.
+        // Handle inside cell's existence and size.
 
         const int mainPos = cellPos + (isEditingRows ? cellRows : cellCols);
 
@@ -1148,15 +1382,11 @@ void UpdateCellAttrRowsOrCols(wxGridCoordsToAttrMap& attrs, int editPos,
             // On a position that still exists after deletion but main cell
             // of multicell is within deletion range so the multicell is gone:
             // Remove the attribute.
-            cellAttr->DecRef();
+            removedAttrs.push_back(key);
 
             continue;
         }
 
-        // Rows/cols inserted or deleted (and this inside cell still exists):
-        // Adjust (inside) cell coords.
-        newAttrs[newCoords] = cellAttr;
-
         if ( mainPos >= editPos )
         {
             // Nothing more to do: the multicell that this inside cell is part
@@ -1180,9 +1410,7 @@ void UpdateCellAttrRowsOrCols(wxGridCoordsToAttrMap& attrs, int editPos,
                 wxGridCellAttr* attr = new wxGridCellAttr;
                 attr->SetSize(cellRows - adjustRows, cellCols - adjustCols);
 
-                const int row = cellRow + adjustRows,
-                          col = cellCol + adjustCols;
-                newAttrs[CoordsToKey(row, col)] = attr;
+                newAttrs.push_back(NewAttr{cellPos + i, otherIndex, attr});
             }
         }
 
@@ -1190,25 +1418,87 @@ void UpdateCellAttrRowsOrCols(wxGridCoordsToAttrMap& attrs, int editPos,
         cellAttr->SetSize(cellRows - editRowCount, cellCols - editColCount);
     }
 
-    attrs = newAttrs;
+    for ( const KeyType key : removedAttrs )
+        RemoveAttr(m_attrs.find(key));
+
+    if ( editCount > 0 )
+    {
+        indices.Insert(editPos, editCount);
+    }
+    else
+    {
+        for ( const auto& deleted : indices.Delete(editPos, -editCount) )
+            RemoveAttrs(deleted.first, deleted.second, isEditingRows);
+    }
+
+    for ( const NewAttr& newAttr : newAttrs )
+    {
+        const int index = indices.GetIndex(newAttr.pos);
+        const KeyType key = isEditingRows
+                                ? CoordsToKey(index, newAttr.otherIndex)
+                                : CoordsToKey(newAttr.otherIndex, index);
+        AddAttr(key, newAttr.attr);
+        m_multicells.push_back(key);
+    }
+
+    // We kept track of the changes to the multicells ourselves.
+    m_multicells.erase(std::remove_if(m_multicells.begin(), m_multicells.end(),
+                                      [this](KeyType key)
+                                      {
+                                          return m_attrs.find(key) == m_attrs.end();
+                                      }),
+                       m_multicells.end());
+    m_multicellsChanges = gs_cellSpanChanges;
+
+    // Each insertion or deletion can add a couple of segments to the maps, so
+    // start from scratch when there are too many of them compared to the
+    // number of attributes, which keeps the cost of this amortized constant.
+    if ( m_rows.GetSegmentCount() + m_cols.GetSegmentCount() > m_attrs.size() + 32 )
+        Compact();
 }
 
-} // anonymous namespace
+void wxGridCellAttrData::Compact()
+{
+    wxGridCoordsToAttrMap attrs;
+    for ( const auto& kv : m_attrs )
+    {
+        int rowIndex, colIndex;
+        KeyToCoords(kv.first, &rowIndex, &colIndex);
+        attrs[CoordsToKey(m_rows.GetPos(rowIndex), m_cols.GetPos(colIndex))]
+            = kv.second;
+    }
+
+    m_attrs.swap(attrs);
+    m_rows.Reset();
+    m_cols.Reset();
+
+    m_rowsKeys.clear();
+    m_colsKeys.clear();
+    for ( const auto& kv : m_attrs )
+    {
+        int row, col;
+        KeyToCoords(kv.first, &row, &col);
+        m_rowsKeys.insert(kv.first);
+        m_colsKeys.insert(CoordsToKey(col, row));
+    }
+
+    m_multicellsValid = false;
+}
 
 void wxGridCellAttrData::UpdateAttrRows( size_t pos, int numRows )
 {
-    UpdateCellAttrRowsOrCols(m_attrs, static_cast<int>(pos), numRows, 0);
+    UpdateAttrRowsOrCols(static_cast<int>(pos), numRows, true);
 }
 
 void wxGridCellAttrData::UpdateAttrCols( size_t pos, int numCols )
 {
-    UpdateCellAttrRowsOrCols(m_attrs, static_cast<int>(pos), 0, numCols);
+    UpdateAttrRowsOrCols(static_cast<int>(pos), numCols, false);
 }
 
 wxGridCoordsToAttrMap::iterator
 wxGridCellAttrData::FindIndex(int row, int col) const
 {
-    return m_attrs.find(CoordsToKey(row, col));
+    return m_attrs.find(CoordsToKey(m_rows.GetIndex(row), m_cols.GetIndex(col)));
 }
 
 // ----------------------------------------------------------------------------
@@ -1977,23 +2267,1324 @@ void wxGridStringTable::SetValue( int row, int col, const wxString& value )
     m_data[row][col] = value;
 }
 
-void wxGridStringTable::Clear()
+void wxGridStringTable::Clear()
+{
+    for ( auto& colData : m_data )
+    {
+        for ( auto& cell : colData )
+            cell.clear();
+    }
+}
+
+bool wxGridStringTable::InsertRows( size_t pos, size_t numRows )
+{
+    if ( pos >= m_data.size() )
+    {
+        return AppendRows( numRows );
+    }
+
+    m_data.insert( m_data.begin() + pos, numRows, ColData(m_numCols) );
+
+    if ( GetView() )
+    {
+        GetView()->ProcessTableMessage( this,
+                                wxGRIDTABLE_NOTIFY_ROWS_INSERTED,
+                                pos,
+                                numRows );
+    }
+
+    return true;
+}
+
+bool wxGridStringTable::AppendRows( size_t numRows )
+{
+    m_data.insert( m_data.end(), numRows, ColData(m_numCols) );
+
+    if ( GetView() )
+    {
+        GetView()->ProcessTableMessage( this,
+                                wxGRIDTABLE_NOTIFY_ROWS_APPENDED,
+                                numRows );
+    }
+
+    return true;
+}
+
+bool wxGridStringTable::DeleteRows( size_t pos, size_t numRows )
+{
+    size_t curNumRows = m_data.size();
+
+    if ( pos >= curNumRows )
+    {
+        wxFAIL_MSG( wxString::Format
+                    (
+                        wxT("Called wxGridStringTable::DeleteRows(pos=%lu, N=%lu)\nPos value is invalid for present table with %lu rows"),
+                        (unsigned long)pos,
+                        (unsigned long)numRows,
+                        (unsigned long)curNumRows
+                    ) );
+
+        return false;
+    }
+
+    if ( numRows > curNumRows - pos )
+    {
+        numRows = curNumRows - pos;
+    }
+
+    if ( numRows >= curNumRows )
+    {
+        m_data.clear();
+    }
+    else
+    {
+        const auto first = m_data.begin() + pos;
+        m_data.erase( first, first + numRows );
+    }
+
+    if ( GetView() )
+    {
+        GetView()->ProcessTableMessage( this,
+                                wxGRIDTABLE_NOTIFY_ROWS_DELETED,
+                                pos,
+                                numRows );
+    }
+
+    return true;
+}
+
+bool wxGridStringTable::InsertCols( size_t pos, size_t numCols )
+{
+    if ( pos >= static_cast<size_t>(m_numCols) )
+    {
+        return AppendCols( numCols );
+    }
+
+    if ( !m_colLabels.IsEmpty() )
+    {
+        m_colLabels.Insert( wxEmptyString, pos, numCols );
+
+        for ( size_t i = pos; i < pos + numCols; i++ )
+            m_colLabels[i] = wxGridTableBase::GetColLabelValue( i );
+    }
+
+    for ( auto& colData: m_data )
+    {
+        colData.insert( colData.begin() + pos, numCols, {} );
+    }
+
+    m_numCols += numCols;
+
+    if ( GetView() )
+    {
+        GetView()->ProcessTableMessage( this,
+                                wxGRIDTABLE_NOTIFY_COLS_INSERTED,
+                                pos,
+                                numCols );
+    }
+
+    return true;
+}
+
+bool wxGridStringTable::AppendCols( size_t numCols )
+{
+    for ( auto& colData: m_data )
+    {
+        colData.insert( colData.end(), numCols, {} );
+    }
+
+    m_numCols += numCols;
+
+    if ( GetView() )
+    {
+        GetView()->ProcessTableMessage( this,
+                                wxGRIDTABLE_NOTIFY_COLS_APPENDED,
+                                numCols );
+    }
+
+    return true;
+}
+
+bool wxGridStringTable::DeleteCols( size_t pos, size_t numCols )
+{
+    size_t curNumCols = m_numCols;
+
+    if ( pos >= curNumCols )
+    {
+        wxFAIL_MSG( wxString::Format
+                    (
+                        wxT("Called wxGridStringTable::DeleteCols(pos=%lu, N=%lu)\nPos value is invalid for present table with %lu cols"),
+                        (unsigned long)pos,
+                        (unsigned long)numCols,
+                        (unsigned long)curNumCols
+                    ) );
+        return false;
+    }
+
+    int colID;
+    if ( GetView() )
+        colID = GetView()->GetColAt( pos );
+    else
+        colID = pos;
+
+    if ( numCols > curNumCols - colID )
+    {
+        numCols = curNumCols - colID;
+    }
+
+    if ( !m_colLabels.IsEmpty() )
+    {
+        // m_colLabels stores just as many elements as it needs, e.g. if only
+        // the label of the first column had been set it would have only one
+        // element and not numCols, so account for it
+        int numRemaining = m_colLabels.size() - colID;
+        if (numRemaining > 0)
+            m_colLabels.RemoveAt( colID, wxMin(numCols, numRemaining) );
+    }
+
+    if ( numCols >= curNumCols )
+    {
+        for ( auto& colData: m_data )
+        {
+            colData.clear();
+        }
+
+        m_numCols = 0;
+    }
+    else // something will be left
+    {
+        for ( auto& colData: m_data )
+        {
+            const auto first = colData.begin() + colID;
+            colData.erase( first, first + numCols );
+        }
+
+        m_numCols -= numCols;
+    }
+
+    if ( GetView() )
+    {
+        GetView()->ProcessTableMessage( this,
+                                wxGRIDTABLE_NOTIFY_COLS_DELETED,
+                                pos,
+                                numCols );
+    }
+
+    return true;
+}
+
+wxString wxGridStringTable::GetRowLabelValue( int row )
+{
+    if ( row > (int)(m_rowLabels.GetCount()) - 1 )
+    {
+        // using default label
+        //
+        return wxGridTableBase::GetRowLabelValue( row );
+    }
+    else
+    {
+        return m_rowLabels[row];
+    }
+}
+
+wxString wxGridStringTable::GetColLabelValue( int col )
+{
+    if ( col > (int)(m_colLabels.GetCount()) - 1 )
+    {
+        // using default label
+        //
+        return wxGridTableBase::GetColLabelValue( col );
+    }
+    else
+    {
+        return m_colLabels[col];
+    }
+}
+
+void wxGridStringTable::SetRowLabelValue( int row, const wxString& value )
+{
+    if ( row > (int)(m_rowLabels.GetCount()) - 1 )
+    {
+        int n = m_rowLabels.GetCount();
+        int i;
+
+        for ( i = n; i <= row; i++ )
+        {
+            m_rowLabels.Add( wxGridTableBase::GetRowLabelValue(i) );
+        }
+    }
+
+    m_rowLabels[row] = value;
+}
+
+void wxGridStringTable::SetColLabelValue( int col, const wxString& value )
+{
+    if ( col > (int)(m_colLabels.GetCount()) - 1 )
+    {
+        int n = m_colLabels.GetCount();
+        int i;
+
+        for ( i = n; i <= col; i++ )
+        {
+            m_colLabels.Add( wxGridTableBase::GetColLabelValue(i) );
+        }
+    }
+
+    m_colLabels[col] = value;
+}
+
+void wxGridStringTable::SetCornerLabelValue( const wxString& value )
+{
+    m_cornerLabel = value;
+}
+
+wxString wxGridStringTable::GetCornerLabelValue() const
+{
+    return m_cornerLabel;
+}
+
+//////////////////////////////////////////////////////////////////////
+//
+// A grid table storing the values of each column in a vector of the
+// column type instead of storing all of them as strings.
+//
+
+class wxGridTypedTable::Column
+{
+public:
+    enum Type
+    {
+        Type_String,
+        Type_Long,
+        Type_Double,
+        Type_Bool
+    };
+
+    // Return false if the type name doesn't correspond to a supported type.
+    static bool FromTypeName(const wxString& typeName, Type* type)
+    {
+        if ( typeName == wxGRID_VALUE_STRING )
+            *type = Type_String;
+        else if ( typeName == wxGRID_VALUE_NUMBER )
+            *type = Type_Long;
+        else if ( typeName == wxGRID_VALUE_FLOAT )
+            *type = Type_Double;
+        else if ( typeName == wxGRID_VALUE_BOOL )
+            *type = Type_Bool;
+        else
+            return false;
+
+        return true;
+    }
+
+    Column(Type type, size_t numRows)
+        : m_type(type)
+    {
+        Reset(numRows);
+    }
+
+    Type GetType() const { return m_type; }
+
+    wxString GetTypeName() const
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                break;
+
+            case Type_Long:
+                return wxGRID_VALUE_NUMBER;
+
+            case Type_Double:
+                return wxGRID_VALUE_FLOAT;
+
+            case Type_Bool:
+                return wxGRID_VALUE_BOOL;
+        }
+
+        return wxGRID_VALUE_STRING;
+    }
+
+    // Discard all the values and use the given number of empty ones instead.
+    void Reset(size_t numRows)
+    {
+        m_codes.clear();
+        m_longs.clear();
+        m_nulls.clear();
+        m_doubles.clear();
+        m_bools.clear();
+
+        m_dict.clear();
+        m_dictRefs.clear();
+        m_dictIndex.clear();
+        m_freeCodes.clear();
+
+        // The code 0 always corresponds to the empty string, which is never
+        // removed from the dictionary and so doesn't need to be counted.
+        if ( m_type == Type_String )
+        {
+            m_dict.push_back(wxString());
+            m_dictRefs.push_back(0);
+        }
+
+        Insert(0, numRows);
+    }
+
+    void Insert(size_t pos, size_t count)
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                DoInsert(m_codes, pos, count, 0u);
+                break;
+
+            case Type_Long:
+                // The new cells are empty, as in the other columns.
+                DoInsert(m_longs, pos, count, static_cast<wxLongLong_t>(0));
+                DoInsert(m_nulls, pos, count, true);
+                break;
+
+            case Type_Double:
+                DoInsert(m_doubles, pos, count, GetEmptyDouble());
+                break;
+
+            case Type_Bool:
+                DoInsert(m_bools, pos, count, false);
+                break;
+        }
+    }
+
+    void Erase(size_t pos, size_t count)
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                for ( size_t n = pos; n < pos + count; n++ )
+                    Release(m_codes[n]);
+
+                DoErase(m_codes, pos, count);
+                break;
+
+            case Type_Long:
+                DoErase(m_longs, pos, count);
+                DoErase(m_nulls, pos, count);
+                break;
+
+            case Type_Double:
+                DoErase(m_doubles, pos, count);
+                break;
+
+            case Type_Bool:
+                DoErase(m_bools, pos, count);
+                break;
+        }
+    }
+
+    // Reorder the values so that the value at position n is the one which
+    // was previously at position order[n].
+    void Permute(const std::vector<size_t>& order)
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                DoPermute(m_codes, order);
+                break;
+
+            case Type_Long:
+                DoPermute(m_longs, order);
+                DoPermute(m_nulls, order);
+                break;
+
+            case Type_Double:
+                DoPermute(m_doubles, order);
+                break;
+
+            case Type_Bool:
+                DoPermute(m_bools, order);
+                break;
+        }
+    }
+
+    // Sort the given row indices by the values in this column, keeping the
+    // relative order of the rows with equal values.
+    void SortOrder(std::vector<size_t>& order, bool ascending) const
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                {
+                    // Sort the dictionary once, which is typically much
+                    // smaller than the column, and then compare just the
+                    // ranks of the strings in it.
+                    std::vector<wxUint32> byValue(m_dict.size());
+                    for ( size_t n = 0; n < byValue.size(); n++ )
+                        byValue[n] = static_cast<wxUint32>(n);
+
+                    std::sort(byValue.begin(), byValue.end(),
+                              [this](wxUint32 a, wxUint32 b)
+                              {
+                                  return m_dict[a] < m_dict[b];
+                              });
+
+                    std::vector<wxUint32> ranks(m_dict.size());
+                    for ( size_t n = 0; n < byValue.size(); n++ )
+                        ranks[byValue[n]] = static_cast<wxUint32>(n);
+
+                    DoSortOrder(order, ascending,
+                                [this, &ranks](size_t a, size_t b)
+                                {
+                                    return ranks[m_codes[a]] < ranks[m_codes[b]];
+                                });
+                }
+                break;
+
+            case Type_Long:
+                // Empty values are considered to be greater than all the
+                // others, as for the floating point columns.
+                DoSortOrder(order, ascending,
+                            [this](size_t a, size_t b)
+                            {
+                                return !m_nulls[a] &&
+                                        (m_nulls[b] || m_longs[a] < m_longs[b]);
+                            });
+                break;
+
+            case Type_Double:
+                // Empty values, represented by NaN, are considered to be
+                // greater than all the others.
+                DoSortOrder(order, ascending,
+                            [this](size_t a, size_t b)
+                            {
+                                const double x = m_doubles[a],
+                                             y = m_doubles[b];
+                                return !wxIsNaN(x) && (wxIsNaN(y) || x < y);
+                            });
+                break;
+
+            case Type_Bool:
+                DoSortOrder(order, ascending,
+                            [this](size_t a, size_t b)
+                            {
+                                return !m_bools[a] && m_bools[b];
+                            });
+                break;
+        }
+    }
+
+    bool IsEmpty(size_t row) const
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                return m_codes[row] == 0;
+
+            case Type_Long:
+                return m_nulls[row];
+
+            case Type_Double:
+                return wxIsNaN(m_doubles[row]);
+
+            case Type_Bool:
+                break;
+        }
+
+        return false;
+    }
+
+    // Getters converting the value to the requested type if necessary.
+    wxString GetString(size_t row) const
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                return m_dict[m_codes[row]];
+
+            case Type_Long:
+                if ( m_nulls[row] )
+                    break;
+                return wxString() << m_longs[row];
+
+            case Type_Double:
+                return DoubleToString(m_doubles[row]);
+
+            case Type_Bool:
+                return BoolToString(m_bools[row]);
+        }
+
+        return wxString();
+    }
+
+    wxLongLong_t GetLong(size_t row) const
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                {
+                    wxLongLong_t value;
+                    if ( m_dict[m_codes[row]].ToLongLong(&value) )
+                        return value;
+                }
+                break;
+
+            case Type_Long:
+                return m_longs[row];
+
+            case Type_Double:
+                return DoubleToLong(m_doubles[row]);
+
+            case Type_Bool:
+                return m_bools[row];
+        }
+
+        return 0;
+    }
+
+    double GetDouble(size_t row) const
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                {
+                    double value;
+                    if ( m_dict[m_codes[row]].ToDouble(&value) )
+                        return value;
+                }
+                break;
+
+            case Type_Long:
+                return static_cast<double>(m_longs[row]);
+
+            case Type_Double:
+                if ( !wxIsNaN(m_doubles[row]) )
+                    return m_doubles[row];
+                break;
+
+            case Type_Bool:
+                return m_bools[row];
+        }
+
+        return 0.0;
+    }
+
+    bool GetBool(size_t row) const
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                return StringToBool(m_dict[m_codes[row]]);
+
+            case Type_Long:
+                return m_longs[row] != 0;
+
+            case Type_Double:
+                return !wxIsNaN(m_doubles[row]) && m_doubles[row] != 0.0;
+
+            case Type_Bool:
+                return m_bools[row];
+        }
+
+        return false;
+    }
+
+    // Setters converting the value to the column type if necessary.
+    void SetString(size_t row, const wxString& value)
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                SetCode(row, value);
+                break;
+
+            case Type_Long:
+                // Empty or invalid strings result in empty cells, as for
+                // the floating point columns.
+                m_nulls[row] = !value.ToLongLong(&m_longs[row]);
+                if ( m_nulls[row] )
+                    m_longs[row] = 0;
+                break;
+
+            case Type_Double:
+                if ( value.empty() || !value.ToDouble(&m_doubles[row]) )
+                    m_doubles[row] = GetEmptyDouble();
+                break;
+
+            case Type_Bool:
+                m_bools[row] = StringToBool(value);
+                break;
+        }
+    }
+
+    void SetLong(size_t row, wxLongLong_t value)
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                SetCode(row, wxString() << value);
+                break;
+
+            case Type_Long:
+                m_longs[row] = value;
+                m_nulls[row] = false;
+                break;
+
+            case Type_Double:
+                m_doubles[row] = static_cast<double>(value);
+                break;
+
+            case Type_Bool:
+                m_bools[row] = value != 0;
+                break;
+        }
+    }
+
+    void SetDouble(size_t row, double value)
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                SetCode(row, DoubleToString(value));
+                break;
+
+            case Type_Long:
+                m_longs[row] = DoubleToLong(value);
+                m_nulls[row] = wxIsNaN(value);
+                break;
+
+            case Type_Double:
+                m_doubles[row] = value;
+                break;
+
+            case Type_Bool:
+                m_bools[row] = !wxIsNaN(value) && value != 0.0;
+                break;
+        }
+    }
+
+    void SetBool(size_t row, bool value)
+    {
+        switch ( m_type )
+        {
+            case Type_String:
+                SetCode(row, BoolToString(value));
+                break;
+
+            case Type_Long:
+                m_longs[row] = value;
+                m_nulls[row] = false;
+                break;
+
+            case Type_Double:
+                m_doubles[row] = value;
+                break;
+
+            case Type_Bool:
+                m_bools[row] = value;
+                break;
+        }
+    }
+
+    // Bulk access to the values, the column must be of the matching type.
+    void SetValues(const std::vector<wxString>& values)
+    {
+        wxASSERT( m_type == Type_String );
+
+        for ( size_t n = 0; n < values.size(); n++ )
+            SetCode(n, values[n]);
+    }
+
+    void SetValues(const std::vector<wxLongLong_t>& values)
+    {
+        wxASSERT( m_type == Type_Long );
+
+        m_longs = values;
+        m_nulls.assign(values.size(), false);
+    }
+
+    void SetValues(const std::vector<double>& values)
+    {
+        wxASSERT( m_type == Type_Double );
+
+        m_doubles = values;
+    }
+
+    void SetValues(const std::vector<bool>& values)
+    {
+        wxASSERT( m_type == Type_Bool );
+
+        m_bools = values;
+    }
+
+    void GetValues(std::vector<wxString>& values) const
+    {
+        wxASSERT( m_type == Type_String );
+
+        values.clear();
+        values.reserve(m_codes.size());
+        for ( const auto code : m_codes )
+            values.push_back(m_dict[code]);
+    }
+
+    void GetValues(std::vector<wxLongLong_t>& values) const
+    {
+        wxASSERT( m_type == Type_Long );
+
+        values = m_longs;
+    }
+
+    void GetValues(std::vector<double>& values) const
+    {
+        wxASSERT( m_type == Type_Double );
+
+        values = m_doubles;
+    }
+
+    void GetValues(std::vector<bool>& values) const
+    {
+        wxASSERT( m_type == Type_Bool );
+
+        values = m_bools;
+    }
+
+private:
+    static double GetEmptyDouble()
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    static wxString DoubleToString(double value)
+    {
+        return wxIsNaN(value) ? wxString() : wxString::FromDouble(value);
+    }
+
+    // Convert the value to integer, clamping it to the representable range,
+    // as just casting it would be undefined for the out of range values.
+    static wxLongLong_t DoubleToLong(double value)
+    {
+        if ( wxIsNaN(value) )
+            return 0;
+
+        if ( value <= static_cast<double>(std::numeric_limits<wxLongLong_t>::min()) )
+            return std::numeric_limits<wxLongLong_t>::min();
+
+        if ( value >= static_cast<double>(std::numeric_limits<wxLongLong_t>::max()) )
+            return std::numeric_limits<wxLongLong_t>::max();
+
+        return static_cast<wxLongLong_t>(value);
+    }
+
+    // Use the same representation as the default one used by
+    // wxGridCellBoolEditor.
+    static wxString BoolToString(bool value)
+    {
+        return value ? wxString(wxS("1")) : wxString();
+    }
+
+    static bool StringToBool(const wxString& value)
+    {
+        return !value.empty() && value != wxS("0");
+    }
+
+    // Return the code of the given string, adding it to the dictionary if
+    // necessary, and increment its reference count.
+    wxUint32 Encode(const wxString& value)
+    {
+        if ( value.empty() )
+            return 0;
+
+        const size_t hash = HashString(value);
+
+        const wxUint32 existing = FindCode(hash, value);
+        if ( existing )
+        {
+            m_dictRefs[existing]++;
+            return existing;
+        }
+
+        wxUint32 code;
+        if ( m_freeCodes.empty() )
+        {
+            code = static_cast<wxUint32>(m_dict.size());
+            m_dict.push_back(value);
+            m_dictRefs.push_back(1);
+        }
+        else // reuse the code of a string which is not used any longer
+        {
+            code = m_freeCodes.back();
+            m_freeCodes.pop_back();
+            m_dict[code] = value;
+            m_dictRefs[code] = 1;
+        }
+
+        m_dictIndex.insert(std::make_pair(hash, code));
+
+        return code;
+    }
+
+    static size_t HashString(const wxString& value)
+    {
+        return std::hash<wxString>()(value);
+    }
+
+    // Return the code of the given non-empty string with the given hash or 0
+    // if it's not in the dictionary.
+    wxUint32 FindCode(size_t hash, const wxString& value) const
+    {
+        const auto range = m_dictIndex.equal_range(hash);
+        for ( auto it = range.first; it != range.second; ++it )
+        {
+            if ( m_dict[it->second] == value )
+                return it->second;
+        }
+
+        return 0;
+    }
+
+    // Decrement the reference count of the string with the given code and
+    // remove it from the dictionary if it's not used by any cell any more.
+    void Release(wxUint32 code)
+    {
+        if ( code == 0 || --m_dictRefs[code] )
+            return;
+
+        const auto range = m_dictIndex.equal_range(HashString(m_dict[code]));
+        for ( auto it = range.first; it != range.second; ++it )
+        {
+            if ( it->second == code )
+            {
+                m_dictIndex.erase(it);
+                break;
+            }
+        }
+
+        wxString().swap(m_dict[code]);
+        m_freeCodes.push_back(code);
+    }
+
+    void SetCode(size_t row, const wxString& value)
+    {
+        // Encode the new value first to avoid removing it from the
+        // dictionary if it's the same as the old one.
+        const wxUint32 code = Encode(value);
+        Release(m_codes[row]);
+        m_codes[row] = code;
+    }
+
+    template <typename T>
+    static void DoInsert(std::vector<T>& values, size_t pos, size_t count,
+                         T value)
+    {
+        values.insert(values.begin() + pos, count, value);
+    }
+
+    template <typename T>
+    static void DoErase(std::vector<T>& values, size_t pos, size_t count)
+    {
+        const auto first = values.begin() + pos;
+        values.erase(first, first + count);
+    }
+
+    template <typename T>
+    static void DoPermute(std::vector<T>& values,
+                          const std::vector<size_t>& order)
+    {
+        std::vector<T> permuted;
+        permuted.reserve(values.size());
+        for ( const auto n : order )
+            permuted.push_back(values[n]);
+
+        values.swap(permuted);
+    }
+
+    // Sort the row indices using the given function comparing the values in
+    // the rows with the given indices.
+    template <typename Less>
+    static void DoSortOrder(std::vector<size_t>& order,
+                            bool ascending,
+                            Less less)
+    {
+        if ( ascending )
+        {
+            std::stable_sort(order.begin(), order.end(), less);
+        }
+        else
+        {
+            std::stable_sort(order.begin(), order.end(),
+                             [&](size_t a, size_t b)
+                             {
+                                 return less(b, a);
+                             });
+        }
+    }
+
+
+    const Type m_type;
+
+    // Only the vector corresponding to the column type is used.
+    std::vector<wxUint32> m_codes;
+    std::vector<wxLongLong_t> m_longs;
+    std::vector<double> m_doubles;
+    std::vector<bool> m_bools;
+
+    // For the integer columns, which don't have any special value which could
+    // be used for the empty cells, unlike NaN for the floating point ones,
+    // this contains true for the empty cells, whose value in m_longs is 0.
+    std::vector<bool> m_nulls;
+
+    // Each distinct string of a string column is stored only once, in this
+    // dictionary, and m_codes contains the indices in it. The strings which
+    // are not used by any cell any more are removed from it and their codes
+    // are reused.
+    std::vector<wxString> m_dict;
+    std::vector<wxUint32> m_dictRefs;
+
+    // Index allowing to find the code of a string: it maps the string hashes
+    // to the codes instead of using the strings themselves as keys to avoid
+    // storing a second copy of each of them.
+    std::unordered_multimap<size_t, wxUint32> m_dictIndex;
+    std::vector<wxUint32> m_freeCodes;
+
+    wxDECLARE_NO_COPY_CLASS(Column);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxGridTypedTable, wxGridTableBase);
+
+wxGridTypedTable::wxGridTypedTable()
+        : wxGridTableBase()
+{
+    m_numRows = 0;
+}
+
+wxGridTypedTable::wxGridTypedTable( int numRows, int numCols )
+        : wxGridTableBase()
+{
+    m_numRows = numRows;
+
+    for ( int col = 0; col < numCols; col++ )
+        m_cols.emplace_back(new Column(Column::Type_String, numRows));
+}
+
+wxGridTypedTable::~wxGridTypedTable() = default;
+
+wxGridTypedTable::Column* wxGridTypedTable::GetColumn( int col ) const
+{
+    wxCHECK_MSG( col >= 0 && col < wxSsize(m_cols),
+                 nullptr,
+                 wxT("invalid column index in wxGridTypedTable") );
+
+    return m_cols[col].get();
+}
+
+wxGridTypedTable::Column*
+wxGridTypedTable::GetCellColumn( int row, int col ) const
+{
+    wxCHECK_MSG( (row >= 0 && row < m_numRows) &&
+                 (col >= 0 && col < wxSsize(m_cols)),
+                 nullptr,
+                 wxT("invalid row or column index in wxGridTypedTable") );
+
+    return m_cols[col].get();
+}
+
+wxGridTypedTable::Column*
+wxGridTypedTable::ResetColumn( int col, const wxString& typeName )
+{
+    Column::Type type;
+    if ( !Column::FromTypeName(typeName, &type) )
+        return nullptr;
+
+    m_cols[col].reset(new Column(type, m_numRows));
+
+    return m_cols[col].get();
+}
+
+bool wxGridTypedTable::SetColType( int col, const wxString& typeName )
+{
+    Column* const column = GetColumn(col);
+    if ( !column )
+        return false;
+
+    Column::Type type;
+    wxCHECK_MSG( Column::FromTypeName(typeName, &type), false,
+                 wxString::Format("unsupported column type \"%s\"", typeName) );
+
+    if ( type == column->GetType() )
+        return true;
+
+    std::unique_ptr<Column> converted(new Column(type, m_numRows));
+    for ( int row = 0; row < m_numRows; row++ )
+    {
+        // Preserve the empty values.
+        if ( column->IsEmpty(row) )
+        {
+            converted->SetString(row, wxString());
+            continue;
+        }
+
+        switch ( column->GetType() )
+        {
+            case Column::Type_String:
+                converted->SetString(row, column->GetString(row));
+                break;
+
+            case Column::Type_Long:
+                converted->SetLong(row, column->GetLong(row));
+                break;
+
+            case Column::Type_Double:
+                converted->SetDouble(row, column->GetDouble(row));
+                break;
+
+            case Column::Type_Bool:
+                converted->SetBool(row, column->GetBool(row));
+                break;
+        }
+    }
+
+    m_cols[col] = std::move(converted);
+
+    return true;
+}
+
+wxString wxGridTypedTable::GetColType( int col ) const
+{
+    Column* const column = GetColumn(col);
+
+    return column ? column->GetTypeName() : wxString();
+}
+
+bool
+wxGridTypedTable::SetColValues( int col, const std::vector<wxString>& values )
+{
+    wxCHECK_MSG( wxSsize(values) == m_numRows, false,
+                 wxT("wrong number of values in wxGridTypedTable") );
+
+    if ( !GetColumn(col) )
+        return false;
+
+    ResetColumn(col, wxGRID_VALUE_STRING)->SetValues(values);
+
+    return true;
+}
+
+bool
+wxGridTypedTable::SetColValues( int col, const std::vector<wxLongLong_t>& values )
+{
+    wxCHECK_MSG( wxSsize(values) == m_numRows, false,
+                 wxT("wrong number of values in wxGridTypedTable") );
+
+    if ( !GetColumn(col) )
+        return false;
+
+    ResetColumn(col, wxGRID_VALUE_NUMBER)->SetValues(values);
+
+    return true;
+}
+
+bool
+wxGridTypedTable::SetColValues( int col, const std::vector<double>& values )
+{
+    wxCHECK_MSG( wxSsize(values) == m_numRows, false,
+                 wxT("wrong number of values in wxGridTypedTable") );
+
+    if ( !GetColumn(col) )
+        return false;
+
+    ResetColumn(col, wxGRID_VALUE_FLOAT)->SetValues(values);
+
+    return true;
+}
+
+bool
+wxGridTypedTable::SetColValues( int col, const std::vector<bool>& values )
+{
+    wxCHECK_MSG( wxSsize(values) == m_numRows, false,
+                 wxT("wrong number of values in wxGridTypedTable") );
+
+    if ( !GetColumn(col) )
+        return false;
+
+    ResetColumn(col, wxGRID_VALUE_BOOL)->SetValues(values);
+
+    return true;
+}
+
+bool
+wxGridTypedTable::GetColValues( int col, std::vector<wxString>& values ) const
+{
+    Column* const column = GetColumn(col);
+    if ( !column || column->GetType() != Column::Type_String )
+        return false;
+
+    column->GetValues(values);
+
+    return true;
+}
+
+bool
+wxGridTypedTable::GetColValues( int col, std::vector<wxLongLong_t>& values ) const
+{
+    Column* const column = GetColumn(col);
+    if ( !column || column->GetType() != Column::Type_Long )
+        return false;
+
+    column->GetValues(values);
+
+    return true;
+}
+
+bool
+wxGridTypedTable::GetColValues( int col, std::vector<double>& values ) const
+{
+    Column* const column = GetColumn(col);
+    if ( !column || column->GetType() != Column::Type_Double )
+        return false;
+
+    column->GetValues(values);
+
+    return true;
+}
+
+bool
+wxGridTypedTable::GetColValues( int col, std::vector<bool>& values ) const
+{
+    Column* const column = GetColumn(col);
+    if ( !column || column->GetType() != Column::Type_Bool )
+        return false;
+
+    column->GetValues(values);
+
+    return true;
+}
+
+void wxGridTypedTable::SortByCol( int col, bool ascending )
+{
+    Column* const column = GetColumn(col);
+    if ( !column )
+        return;
+
+    std::vector<size_t> order(m_numRows);
+    for ( size_t n = 0; n < order.size(); n++ )
+        order[n] = n;
+
+    column->SortOrder(order, ascending);
+
+    for ( auto& c : m_cols )
+        c->Permute(order);
+}
+
+wxString wxGridTypedTable::GetValue( int row, int col )
+{
+    Column* const column = GetCellColumn(row, col);
+
+    return column ? column->GetString(row) : wxString();
+}
+
+void wxGridTypedTable::SetValue( int row, int col, const wxString& value )
+{
+    Column* const column = GetCellColumn(row, col);
+    if ( column )
+        column->SetString(row, value);
+}
+
+bool wxGridTypedTable::IsEmptyCell( int row, int col )
+{
+    Column* const column = GetCellColumn(row, col);
+
+    return !column || column->IsEmpty(row);
+}
+
+wxString wxGridTypedTable::GetTypeName( int WXUNUSED(row), int col )
+{
+    return GetColType(col);
+}
+
+bool wxGridTypedTable::CanGetValueAs( int row, int col,
+                                      const wxString& typeName )
+{
+    // all values can be retrieved as strings too
+    if ( typeName == wxGRID_VALUE_STRING )
+        return true;
+
+    // but empty cells can't be retrieved as numbers, so that the renderers
+    // show them as empty instead of 0
+    if ( row < 0 || row >= m_numRows || col < 0 || col >= wxSsize(m_cols) )
+        return false;
+
+    const Column& column = *m_cols[col];
+    return !column.IsEmpty(row) && typeName == column.GetTypeName();
+}
+
+long wxGridTypedTable::GetValueAsLong( int row, int col )
+{
+    Column* const column = GetCellColumn(row, col);
+
+    if ( !column )
+        return 0;
+
+    // long may be smaller than the values stored in the table, so clamp them
+    // to its range instead of truncating, use GetColValues() to retrieve the
+    // full 64-bit values.
+    const wxLongLong_t value = column->GetLong(row);
+    if ( value < std::numeric_limits<long>::min() )
+        return std::numeric_limits<long>::min();
+    if ( value > std::numeric_limits<long>::max() )
+        return std::numeric_limits<long>::max();
+
+    return static_cast<long>(value);
+}
+
+double wxGridTypedTable::GetValueAsDouble( int row, int col )
+{
+    Column* const column = GetCellColumn(row, col);
+
+    return column ? column->GetDouble(row) : 0.0;
+}
+
+bool wxGridTypedTable::GetValueAsBool( int row, int col )
+{
+    Column* const column = GetCellColumn(row, col);
+
+    return column && column->GetBool(row);
+}
+
+void wxGridTypedTable::SetValueAsLong( int row, int col, long value )
+{
+    Column* const column = GetCellColumn(row, col);
+    if ( column )
+        column->SetLong(row, value);
+}
+
+void wxGridTypedTable::SetValueAsDouble( int row, int col, double value )
+{
+    Column* const column = GetCellColumn(row, col);
+    if ( column )
+        column->SetDouble(row, value);
+}
+
+void wxGridTypedTable::SetValueAsBool( int row, int col, bool value )
+{
+    Column* const column = GetCellColumn(row, col);
+    if ( column )
+        column->SetBool(row, value);
+}
+
+void wxGridTypedTable::Clear()
 {
-    for ( auto& colData : m_data )
-    {
-        for ( auto& cell : colData )
-            cell.clear();
-    }
+    for ( auto& column : m_cols )
+        column->Reset(m_numRows);
 }
 
-bool wxGridStringTable::InsertRows( size_t pos, size_t numRows )
+bool wxGridTypedTable::InsertRows( size_t pos, size_t numRows )
 {
-    if ( pos >= m_data.size() )
+    if ( pos >= static_cast<size_t>(m_numRows) )
     {
         return AppendRows( numRows );
     }
 
-    m_data.insert( m_data.begin() + pos, numRows, ColData(m_numCols) );
+    for ( auto& column : m_cols )
+        column->Insert(pos, numRows);
+
+    m_numRows += numRows;
 
     if ( GetView() )
     {
@@ -2006,9 +3597,12 @@ bool wxGridStringTable::InsertRows( size_t pos, size_t numRows )
     return true;
 }
 
-bool wxGridStringTable::AppendRows( size_t numRows )
+bool wxGridTypedTable::AppendRows( size_t numRows )
 {
-    m_data.insert( m_data.end(), numRows, ColData(m_numCols) );
+    for ( auto& column : m_cols )
+        column->Insert(m_numRows, numRows);
+
+    m_numRows += numRows;
 
     if ( GetView() )
     {
@@ -2020,37 +3614,22 @@ bool wxGridStringTable::AppendRows( size_t numRows )
     return true;
 }
 
-bool wxGridStringTable::DeleteRows( size_t pos, size_t numRows )
+bool wxGridTypedTable::DeleteRows( size_t pos, size_t numRows )
 {
-    size_t curNumRows = m_data.size();
-
-    if ( pos >= curNumRows )
-    {
-        wxFAIL_MSG( wxString::Format
-                    (
-                        wxT("Called wxGridStringTable::DeleteRows(pos=%lu, N=%lu)\nPos value is invalid for present table with %lu rows"),
-                        (unsigned long)pos,
-                        (unsigned long)numRows,
-                        (unsigned long)curNumRows
-                    ) );
+    const size_t curNumRows = m_numRows;
 
-        return false;
-    }
+    wxCHECK_MSG( pos < curNumRows, false,
+                 wxT("invalid row index in wxGridTypedTable::DeleteRows()") );
 
     if ( numRows > curNumRows - pos )
     {
         numRows = curNumRows - pos;
     }
 
-    if ( numRows >= curNumRows )
-    {
-        m_data.clear();
-    }
-    else
-    {
-        const auto first = m_data.begin() + pos;
-        m_data.erase( first, first + numRows );
-    }
+    for ( auto& column : m_cols )
+        column->Erase(pos, numRows);
+
+    m_numRows -= numRows;
 
     if ( GetView() )
     {
@@ -2063,9 +3642,9 @@ bool wxGridStringTable::DeleteRows( size_t pos, size_t numRows )
     return true;
 }
 
-bool wxGridStringTable::InsertCols( size_t pos, size_t numCols )
+bool wxGridTypedTable::InsertCols( size_t pos, size_t numCols )
 {
-    if ( pos >= static_cast<size_t>(m_numCols) )
+    if ( pos >= m_cols.size() )
     {
         return AppendCols( numCols );
     }
@@ -2078,13 +3657,12 @@ bool wxGridStringTable::InsertCols( size_t pos, size_t numCols )
             m_colLabels[i] = wxGridTableBase::GetColLabelValue( i );
     }
 
-    for ( auto& colData: m_data )
+    for ( size_t n = 0; n < numCols; n++ )
     {
-        colData.insert( colData.begin() + pos, numCols, {} );
+        m_cols.emplace(m_cols.begin() + pos + n,
+                       new Column(Column::Type_String, m_numRows));
     }
 
-    m_numCols += numCols;
-
     if ( GetView() )
     {
         GetView()->ProcessTableMessage( this,
@@ -2096,14 +3674,10 @@ bool wxGridStringTable::InsertCols( size_t pos, size_t numCols )
     return true;
 }
 
-bool wxGridStringTable::AppendCols( size_t numCols )
+bool wxGridTypedTable::AppendCols( size_t numCols )
 {
-    for ( auto& colData: m_data )
-    {
-        colData.insert( colData.end(), numCols, {} );
-    }
-
-    m_numCols += numCols;
+    for ( size_t n = 0; n < numCols; n++ )
+        m_cols.emplace_back(new Column(Column::Type_String, m_numRows));
 
     if ( GetView() )
     {
@@ -2115,62 +3689,29 @@ bool wxGridStringTable::AppendCols( size_t numCols )
     return true;
 }
 
-bool wxGridStringTable::DeleteCols( size_t pos, size_t numCols )
+bool wxGridTypedTable::DeleteCols( size_t pos, size_t numCols )
 {
-    size_t curNumCols = m_numCols;
-
-    if ( pos >= curNumCols )
-    {
-        wxFAIL_MSG( wxString::Format
-                    (
-                        wxT("Called wxGridStringTable::DeleteCols(pos=%lu, N=%lu)\nPos value is invalid for present table with %lu cols"),
-                        (unsigned long)pos,
-                        (unsigned long)numCols,
-                        (unsigned long)curNumCols
-                    ) );
-        return false;
-    }
+    const size_t curNumCols = m_cols.size();
 
-    int colID;
-    if ( GetView() )
-        colID = GetView()->GetColAt( pos );
-    else
-        colID = pos;
+    wxCHECK_MSG( pos < curNumCols, false,
+                 wxT("invalid column index in wxGridTypedTable::DeleteCols()") );
 
-    if ( numCols > curNumCols - colID )
+    if ( numCols > curNumCols - pos )
     {
-        numCols = curNumCols - colID;
+        numCols = curNumCols - pos;
     }
 
     if ( !m_colLabels.IsEmpty() )
     {
-        // m_colLabels stores just as many elements as it needs, e.g. if only
-        // the label of the first column had been set it would have only one
-        // element and not numCols, so account for it
-        int numRemaining = m_colLabels.size() - colID;
+        // as in wxGridStringTable, m_colLabels may have fewer elements than
+        // the number of columns
+        int numRemaining = m_colLabels.size() - pos;
         if (numRemaining > 0)
-            m_colLabels.RemoveAt( colID, wxMin(numCols, numRemaining) );
-    }
-
-    if ( numCols >= curNumCols )
-    {
-        for ( auto& colData: m_data )
-        {
-            colData.clear();
-        }
-
-        m_numCols = 0;
+            m_colLabels.RemoveAt( pos, wxMin(numCols, numRemaining) );
     }
-    else // something will be left
-    {
-        for ( auto& colData: m_data )
-        {
-            const auto first = colData.begin() + colID;
-            colData.erase( first, first + numCols );
-        }
 
-        m_numCols -= numCols;
-    }
+    const auto first = m_cols.begin() + pos;
+    m_cols.erase( first, first + numCols );
 
     if ( GetView() )
     {
@@ -2183,72 +3724,44 @@ bool wxGridStringTable::DeleteCols( size_t pos, size_t numCols )
     return true;
 }
 
-wxString wxGridStringTable::GetRowLabelValue( int row )
+wxString wxGridTypedTable::GetRowLabelValue( int row )
 {
-    if ( row > (int)(m_rowLabels.GetCount()) - 1 )
-    {
-        // using default label
-        //
+    if ( row >= static_cast<int>(m_rowLabels.GetCount()) )
         return wxGridTableBase::GetRowLabelValue( row );
-    }
-    else
-    {
-        return m_rowLabels[row];
-    }
+
+    return m_rowLabels[row];
 }
 
-wxString wxGridStringTable::GetColLabelValue( int col )
+wxString wxGridTypedTable::GetColLabelValue( int col )
 {
-    if ( col > (int)(m_colLabels.GetCount()) - 1 )
-    {
-        // using default label
-        //
+    if ( col >= static_cast<int>(m_colLabels.GetCount()) )
         return wxGridTableBase::GetColLabelValue( col );
-    }
-    else
-    {
-        return m_colLabels[col];
-    }
+
+    return m_colLabels[col];
 }
 
-void wxGridStringTable::SetRowLabelValue( int row, const wxString& value )
+void wxGridTypedTable::SetRowLabelValue( int row, const wxString& value )
 {
-    if ( row > (int)(m_rowLabels.GetCount()) - 1 )
-    {
-        int n = m_rowLabels.GetCount();
-        int i;
-
-        for ( i = n; i <= row; i++ )
-        {
-            m_rowLabels.Add( wxGridTableBase::GetRowLabelValue(i) );
-        }
-    }
+    for ( int n = m_rowLabels.GetCount(); n <= row; n++ )
+        m_rowLabels.Add( wxGridTableBase::GetRowLabelValue(n) );
 
     m_rowLabels[row] = value;
 }
 
-void wxGridStringTable::SetColLabelValue( int col, const wxString& value )
+void wxGridTypedTable::SetColLabelValue( int col, const wxString& value )
 {
-    if ( col > (int)(m_colLabels.GetCount()) - 1 )
-    {
-        int n = m_colLabels.GetCount();
-        int i;
-
-        for ( i = n; i <= col; i++ )
-        {
-            m_colLabels.Add( wxGridTableBase::GetColLabelValue(i) );
-        }
-    }
+    for ( int n = m_colLabels.GetCount(); n <= col; n++ )
+        m_colLabels.Add( wxGridTableBase::GetColLabelValue(n) );
 
     m_colLabels[col] = value;
 }
 
-void wxGridStringTable::SetCornerLabelValue( const wxString& value )
+void wxGridTypedTable::SetCornerLabelValue( const wxString& value )
 {
     m_cornerLabel = value;
 }
 
-wxString wxGridStringTable::GetCornerLabelValue() const
+wxString wxGridTypedTable::GetCornerLabelValue() const
 {
     return m_cornerLabel;
 }
@@ -2402,7 +3915,7 @@ void wxGridWindow::OnPaint( wxPaintEvent &WXUNUSED(event) )
     wxRegion reg = GetUpdateRegion();
 
     wxGridCellCoordsVector dirtyCells = m_owner->CalcCellsExposed( reg , this );
-    m_owner->DrawGridCellArea( dc, dirtyCells );
+    m_owner->DoDrawGridCellArea( dc, dirtyCells, true );
 
     m_owner->DrawGridSpace( dc, this );
 
@@ -3229,6 +4742,8 @@ void wxGrid::Init()
     m_gridFrozenBorderColour = wxSystemSettings::SelectLightDark(*wxBLACK, *wxWHITE);
     m_gridFrozenBorderPenWidth = 2;
 
+    m_drawnCellBackgrounds = nullptr;
+
     m_canDragRowMove = false;
     m_canDragColMove = false;
     m_canHideColumns = true;
@@ -6720,6 +8235,15 @@ bool wxGrid::SetCurrentCell( const wxGridCellCoords& coords )
 // CalcExposedCells)
 //
 void wxGrid::DrawGridCellArea( wxDC& dc, const wxGridCellCoordsVector& cells )
+{
+    // We don't know if the grid lines are going to be drawn by the caller, so
+    // don't draw anything in the space reserved for them.
+    DoDrawGridCellArea(dc, cells, false);
+}
+
+void wxGrid::DoDrawGridCellArea(wxDC& dc,
+                                const wxGridCellCoordsVector& cells,
+                                bool fillLineGaps)
 {
     if ( !m_numRows || !m_numCols )
         return;
@@ -6727,6 +8251,39 @@ void wxGrid::DrawGridCellArea( wxDC& dc, const wxGridCellCoordsVector& cells )
     int i, numCells = cells.size();
     wxGridCellCoordsVector redrawCells;
 
+    // All the cells to draw, in the order in which they're drawn.
+    wxGridCellCoordsVector cellsToDraw;
+    cellsToDraw.reserve(numCells);
+
+    // Checking whether a cell is already going to be drawn is done using sets
+    // instead of searching the vectors above, as this would be quadratic in
+    // the number of cells and slow down redrawing of big grids with many
+    // multicells or overflowing cells. The set of all cells is only filled
+    // when it's needed for the first time as it's not needed at all for the
+    // simple grids.
+    CellCoordsSet cellsSet,
+                  redrawSet;
+
+    // The leftmost column of the cells in redrawCells in each row.
+    std::unordered_map<int, int> redrawLeftCols;
+
+    const auto markForRedraw = [&](const wxGridCellCoords& cell)
+    {
+        if ( cellsSet.empty() )
+            cellsSet.insert(cells.begin(), cells.end());
+
+        if ( cellsSet.count(cell) || !redrawSet.insert(cell).second )
+            return;
+
+        redrawCells.push_back( cell );
+
+        const auto it = redrawLeftCols.find(cell.GetRow());
+        if ( it == redrawLeftCols.end() )
+            redrawLeftCols[cell.GetRow()] = cell.GetCol();
+        else if ( cell.GetCol() < it->second )
+            it->second = cell.GetCol();
+    };
+
     for ( i = numCells - 1; i >= 0; i-- )
     {
         int row, col, cell_rows, cell_cols;
@@ -6736,32 +8293,7 @@ void wxGrid::DrawGridCellArea( wxDC& dc, const wxGridCellCoordsVector& cells )
         // If this cell is part of a multicell block, find owner for repaint
         if ( GetCellSize( row, col, &cell_rows, &cell_cols ) == CellSpan_Inside )
         {
-            wxGridCellCoords cell( row + cell_rows, col + cell_cols );
-            bool marked = false;
-            for ( int j = 0; j < numCells; j++ )
-            {
-                if ( cell == cells[j] )
-                {
-                    marked = true;
-                    break;
-                }
-            }
-
-            if (!marked)
-            {
-                int count = redrawCells.size();
-                for (int j = 0; j < count; j++)
-                {
-                    if ( cell == redrawCells[j] )
-                    {
-                        marked = true;
-                        break;
-                    }
-                }
-
-                if (!marked)
-                    redrawCells.push_back( cell );
-            }
+            markForRedraw( wxGridCellCoords( row + cell_rows, col + cell_cols ) );
 
             // don't bother drawing this cell
             continue;
@@ -6773,17 +8305,10 @@ void wxGrid::DrawGridCellArea( wxDC& dc, const wxGridCellCoordsVector& cells )
             for ( int l = 0; l < cell_rows; l++ )
             {
                 // find a cell in this row to leave already marked for repaint
-                int left = col;
-                for ( const auto& cell: redrawCells )
-                {
-                    if ((cell.GetCol() < left) && (cell.GetRow() == row))
-                    {
-                        left = cell.GetCol();
-                    }
-                }
-
-                if (left == col)
-                    left = 0; // oh well
+                int left = 0; // oh well
+                const auto it = redrawLeftCols.find(row);
+                if ( it != redrawLeftCols.end() && it->second < col )
+                    left = it->second;
 
                 for (int j = col - 1; j >= left; j--)
                 {
@@ -6798,47 +8323,159 @@ void wxGrid::DrawGridCellArea( wxDC& dc, const wxGridCellCoordsVector& cells )
                             continue;
 
                         if ( attr->CanOverflow() )
-                        {
-                            wxGridCellCoords cellOver(row + l, j);
-                            bool marked = false;
-
-                            for ( const auto& cell: cells )
-                            {
-                                if ( cellOver == cell )
-                                {
-                                    marked = true;
-                                    break;
-                                }
-                            }
+                            markForRedraw( wxGridCellCoords(row + l, j) );
 
-                            if (!marked)
-                            {
-                                for ( const auto& cell: redrawCells )
-                                {
-                                    if ( cellOver == cell )
-                                    {
-                                        marked = true;
-                                        break;
-                                    }
-                                }
-                                if (!marked)
-                                    redrawCells.push_back( cellOver );
-                            }
-                        }
                         break;
                     }
                 }
             }
         }
 
-        DrawCell( dc, cells[i] );
+        cellsToDraw.push_back( cells[i] );
     }
 
     numCells = redrawCells.size();
 
     for ( i = numCells - 1; i >= 0; i-- )
     {
-        DrawCell( dc, redrawCells[i] );
+        cellsToDraw.push_back( redrawCells[i] );
+    }
+
+    // Find the attributes of all cells only once, as doing it is relatively
+    // expensive, and use them both for filling the backgrounds and drawing.
+    struct CellToDraw
+    {
+        wxGridCellCoords coords;
+        wxGridCellAttrPtr attr;
+        wxRect rect;
+        bool isSelected;
+    };
+
+    std::vector<CellToDraw> cellsData;
+    cellsData.reserve(cellsToDraw.size());
+
+    struct CellBackground
+    {
+        wxRect rect;
+        wxColour colour;
+    };
+
+    std::vector<CellBackground> backgrounds;
+    backgrounds.reserve(cellsToDraw.size());
+
+    wxGridDrawnCellBackgrounds drawnBackgrounds;
+
+    const bool editorShown = IsCellEditControlShown();
+
+    for ( const auto& coords : cellsToDraw )
+    {
+        const int row = coords.GetRow();
+        const int col = coords.GetCol();
+
+        if ( GetColWidth(col) <= 0 || GetRowHeight(row) <= 0 )
+            continue;
+
+        CellToDraw cell{coords, GetCellAttrPtr(row, col),
+                        CellToRect(row, col), IsInSelection(coords)};
+
+        // Backgrounds of the multicells and of the cell being edited are
+        // drawn by their renderer or editor only.
+        int numRows, numCols;
+        cell.attr->GetSize(&numRows, &numCols);
+        if ( GetCellSpan(numRows, numCols) == CellSpan_None &&
+                !(editorShown && coords == m_currentCellCoords) &&
+                    !cell.rect.IsEmpty() )
+        {
+            const wxColour colour = wxGridPrivate::GetCellBackgroundColour
+                                    (
+                                        *this, *cell.attr, cell.isSelected
+                                    );
+
+            drawnBackgrounds.Add(row, col, cell.rect, colour);
+            backgrounds.push_back(CellBackground{cell.rect, colour});
+        }
+
+        cellsData.push_back(cell);
+    }
+
+    // Merge the backgrounds of the adjacent cells of the same colour in the
+    // same row first and then merge the identical runs of the adjacent rows
+    // to fill them using as few rectangles as possible. The gaps between the
+    // cells can be filled too if the grid lines are drawn over them later.
+    const int gap = fillLineGaps && m_gridLinesEnabled ? 1 : 0;
+
+    std::sort(backgrounds.begin(), backgrounds.end(),
+              [](const CellBackground& bg1, const CellBackground& bg2)
+              {
+                  return bg1.rect.y < bg2.rect.y ||
+                            (bg1.rect.y == bg2.rect.y && bg1.rect.x < bg2.rect.x);
+              });
+
+    std::vector<CellBackground> runs;
+    for ( const auto& bg : backgrounds )
+    {
+        if ( !runs.empty() )
+        {
+            wxRect& last = runs.back().rect;
+            if ( runs.back().colour == bg.colour &&
+                    last.y == bg.rect.y && last.height == bg.rect.height &&
+                        last.GetRight() + 1 + gap == bg.rect.x )
+            {
+                last.SetRight(bg.rect.GetRight());
+                continue;
+            }
+        }
+
+        runs.push_back(bg);
+    }
+
+    std::vector<CellBackground> rects;
+
+    // The index in rects of the last rectangle with the given horizontal
+    // position and width.
+    std::unordered_map<wxLongLong_t, size_t> lastRects;
+
+    for ( const auto& run : runs )
+    {
+        const wxLongLong_t key = CoordsToKey(run.rect.x, run.rect.width);
+
+        const auto it = lastRects.find(key);
+        if ( it != lastRects.end() )
+        {
+            CellBackground& above = rects[it->second];
+            if ( above.colour == run.colour &&
+                    above.rect.GetBottom() + 1 + gap == run.rect.y )
+            {
+                above.rect.SetBottom(run.rect.GetBottom());
+                continue;
+            }
+        }
+
+        lastRects[key] = rects.size();
+        rects.push_back(run);
+    }
+
+    dc.SetPen( *wxTRANSPARENT_PEN );
+
+    wxColour brushColour;
+    for ( const auto& bg : rects )
+    {
+        if ( bg.colour != brushColour )
+        {
+            dc.SetBrush(bg.colour);
+            brushColour = bg.colour;
+        }
+
+        dc.DrawRectangle(bg.rect);
+    }
+
+    // Let the renderers know which backgrounds don't need to be drawn again.
+    m_drawnCellBackgrounds = &drawnBackgrounds;
+    wxON_BLOCK_EXIT_SET(m_drawnCellBackgrounds, nullptr);
+
+    for ( auto& cell : cellsData )
+    {
+        DoDrawCell(dc, cell.coords, *cell.attr, cell.rect, cell.isSelected);
     }
 }
 
@@ -6885,24 +8522,42 @@ void wxGrid::DrawCell( wxDC& dc, const wxGridCellCoords& coords )
     // we draw the cell border ourselves
     wxGridCellAttrPtr attr = GetCellAttrPtr(row, col);
 
-    bool isCurrent = coords == m_currentCellCoords;
+    DoDrawCell(dc, coords, *attr, CellToRect(row, col), IsInSelection(coords));
+}
 
-    wxRect rect = CellToRect( row, col );
+void wxGrid::DoDrawCell(wxDC& dc,
+                        const wxGridCellCoords& coords,
+                        wxGridCellAttr& attr,
+                        const wxRect& rect,
+                        bool isSelected)
+{
+    int row = coords.GetRow();
+    int col = coords.GetCol();
+
+    bool isCurrent = coords == m_currentCellCoords;
 
     // if the editor is shown, we should use it and not the renderer
     // Note: However, only if it is really _shown_, i.e. not hidden!
     if ( isCurrent && IsCellEditControlShown() )
     {
-        attr->GetEditorPtr(this, row, col)->PaintBackground(dc, rect, *attr);
+        attr.GetEditorPtr(this, row, col)->PaintBackground(dc, rect, attr);
     }
     else
     {
         // but all the rest is drawn by the cell renderer and hence may be customized
-        attr->GetRendererPtr(this, row, col)
-            ->Draw(*this, *attr, dc, rect, row, col, IsInSelection(coords));
+        attr.GetRendererPtr(this, row, col)
+            ->Draw(*this, attr, dc, rect, row, col, isSelected);
     }
 }
 
+bool wxGrid::UseDrawnCellBackground(int row, int col,
+                                    const wxRect& rect,
+                                    const wxColour& colour)
+{
+    return m_drawnCellBackgrounds &&
+            m_drawnCellBackgrounds->Use(row, col, rect, colour);
+}
+
 void wxGrid::DrawCellHighlight( wxDC& dc, const wxGridCellAttr *attr )
 {
     // don't show highlight when the grid doesn't have focus
@@ -35,37 +35,53 @@
 // wxGridCellRenderer
 // ----------------------------------------------------------------------------
 
+wxColour
+wxGridPrivate::GetCellBackgroundColour(const wxGrid& grid,
+                                       const wxGridCellAttr& attr,
+                                       bool isSelected)
+{
+    // grey out fields if the grid is disabled
+    if ( !grid.IsThisEnabled() )
+        return wxSystemSettings::GetColour(wxSYS_COLOUR_BTNFACE);
+
+    if ( !grid.UsesOverlaySelection() && isSelected )
+    {
+        if ( grid.HasFocus() )
+            return grid.GetSelectionBackground();
+
+        return wxSystemSettings::GetColour(wxSYS_COLOUR_BTNSHADOW);
+    }
+
+    return attr.GetBackgroundColour();
+}
+
 void wxGridCellRenderer::Draw(wxGrid& grid,
                               wxGridCellAttr& attr,
                               wxDC& dc,
                               const wxRect& rect,
-                              int WXUNUSED(row), int WXUNUSED(col),
+                              int row, int col,
                               bool isSelected)
 {
     dc.SetBackgroundMode( wxBRUSHSTYLE_SOLID );
 
-    wxColour clr;
-    if ( grid.IsThisEnabled() )
-    {
-        if ( !grid.UsesOverlaySelection() && isSelected )
-        {
-            if ( grid.HasFocus() )
-                clr = grid.GetSelectionBackground();
-            else
-                clr = wxSystemSettings::GetColour(wxSYS_COLOUR_BTNSHADOW);
-        }
-        else
-        {
-            clr = attr.GetBackgroundColour();
-        }
-    }
-    else // grey out fields if the grid is disabled
-    {
-        clr = wxSystemSettings::GetColour(wxSYS_COLOUR_BTNFACE);
-    }
+    const wxColour
+        clr = wxGridPrivate::GetCellBackgroundColour(grid, attr, isSelected);
+
+    // leave the DC in the same state in any case, as the derived classes may
+    // rely on it, but avoid changing it unnecessarily
+    const wxBrush& brush = dc.GetBrush();
+    if ( !brush.IsOk() || brush.GetStyle() != wxBRUSHSTYLE_SOLID ||
+            brush.GetColour() != clr )
+        dc.SetBrush(clr);
+
+    if ( !dc.GetPen().IsTransparent() )
+        dc.SetPen( *wxTRANSPARENT_PEN );
+
+    // the grid may have already filled the background of this cell together
+    // with its neighbours, don't do it again then
+    if ( grid.UseDrawnCellBackground(row, col, rect, clr) )
+        return;
 
-    dc.SetBrush(clr);
-    dc.SetPen( *wxTRANSPARENT_PEN );
     dc.DrawRectangle(rect);
 }
 
@@ -78,32 +94,29 @@ void wxGridCellRenderer::SetTextColoursAndFont(const wxGrid& grid,
 
     // TODO some special colours for attr.IsReadOnly() case?
 
+    dc.SetTextBackground
+       (
+        wxGridPrivate::GetCellBackgroundColour(grid, attr, isSelected)
+       );
+
     // different coloured text when the grid is disabled
     if ( grid.IsThisEnabled() )
     {
         if ( !grid.UsesOverlaySelection() && isSelected )
-        {
-            wxColour clr;
-            if ( grid.HasFocus() )
-                clr = grid.GetSelectionBackground();
-            else
-                clr = wxSystemSettings::GetColour(wxSYS_COLOUR_BTNSHADOW);
-            dc.SetTextBackground( clr );
             dc.SetTextForeground( grid.GetSelectionForeground() );
-        }
         else
-        {
-            dc.SetTextBackground( attr.GetBackgroundColour() );
             dc.SetTextForeground( attr.GetTextColour() );
-        }
     }
     else
     {
-        dc.SetTextBackground(wxSystemSettings::GetColour(wxSYS_COLOUR_BTNFACE));
         dc.SetTextForeground(wxSystemSettings::GetColour(wxSYS_COLOUR_GRAYTEXT));
     }
 
-    dc.SetFont( attr.GetFont() );
+    // most cells use the same font, so avoid changing it unnecessarily as
+    // this is relatively expensive for some DC implementations
+    const wxFont& font = attr.GetFont();
+    if ( !dc.GetFont().IsSameAs(font) )
+        dc.SetFont( font );
 }
 
 // ----------------------------------------------------------------------------
@@ -40,6 +40,8 @@
 
 #include "wx/generic/private/drawbitmap.h"
 
+#include <algorithm>
+
 #ifdef __WXMAC__
     #include "wx/osx/private.h"
 #endif
@@ -58,6 +60,9 @@ using wxGenericTreeItems = std::vector<wxGenericTreeItem*>;
 
 static const int NO_IMAGE = -1;
 
+// the maximal number of item labels kept in memory in virtual mode
+static const size_t VIRTUAL_LABELS_CACHE_SIZE = 1024;
+
 static const int PIXELS_PER_UNIT = 10;
 
 // the margin between the item state image and the item normal image
@@ -135,6 +140,85 @@ private:
     wxDECLARE_NO_COPY_CLASS(wxTreeFindTimer);
 };
 
+// Index of the number of rows taken by the subtrees of the children of an
+// item, allowing to find the row of any child and the child shown at any row
+// in logarithmic time.
+//
+// This is a Fenwick tree, i.e. its element n contains the sum of the rows of
+// the children in the range (n - lowbit(n), n], with 1-based indices.
+class wxTreeRowsIndex
+{
+public:
+    wxTreeRowsIndex() = default;
+
+    bool IsOk() const { return !m_tree.empty(); }
+
+    void Invalidate() { m_tree.clear(); }
+
+    // (Re)build the index using the given function returning the number of
+    // rows of the child with the given index.
+    template <typename F>
+    void Build(size_t count, F getRows)
+    {
+        m_tree.assign(count + 1, 0);
+
+        for ( size_t n = 1; n <= count; n++ )
+        {
+            m_tree[n] += getRows(n - 1);
+
+            const size_t next = n + LowBit(n);
+            if ( next <= count )
+                m_tree[next] += m_tree[n];
+        }
+    }
+
+    // Update the index after the number of rows of the given child changed.
+    void Add(size_t index, ptrdiff_t delta)
+    {
+        for ( size_t n = index + 1; n < m_tree.size(); n += LowBit(n) )
+            m_tree[n] += delta;
+    }
+
+    // Return the total number of rows of the children before the given one.
+    size_t GetRowsBefore(size_t index) const
+    {
+        size_t rows = 0;
+        for ( size_t n = index; n; n -= LowBit(n) )
+            rows += m_tree[n];
+
+        return rows;
+    }
+
+    // Return the index of the child whose subtree contains the given row,
+    // counted from the row of the first child, which must be less than the
+    // total number of rows of all children.
+    size_t FindRow(size_t row) const
+    {
+        size_t step = 1;
+        while ( step * 2 < m_tree.size() )
+            step *= 2;
+
+        size_t pos = 0;
+        for ( ; step; step /= 2 )
+        {
+            if ( pos + step < m_tree.size() && m_tree[pos + step] <= row )
+            {
+                pos += step;
+                row -= m_tree[pos];
+            }
+        }
+
+        return pos;
+    }
+
+private:
+    static size_t LowBit(size_t n) { return n & (~n + 1); }
+
+    std::vector<size_t> m_tree;
+
+    wxDECLARE_NO_COPY_CLASS(wxTreeRowsIndex);
+};
+
 // a tree item
 class wxGenericTreeItem
 {
@@ -145,6 +229,8 @@ public:
         m_data = nullptr;
         m_widthText =
         m_heightText = -1;
+        m_childRows =
+        m_index = 0;
     }
 
     wxGenericTreeItem( wxGenericTreeItem *parent,
@@ -175,6 +261,11 @@ public:
         ResetTextSize();
     }
 
+    // used in virtual mode, where the text may be discarded and retrieved
+    // again later without affecting the item size
+    void SetVirtualText(const wxString& text) { m_text = text; }
+    void DiscardVirtualText() { wxString().swap(m_text); }
+
     void SetImage(int image, wxTreeItemIcon which)
     {
         m_images[which] = image;
@@ -245,7 +336,52 @@ public:
     size_t GetChildrenCount(bool recursively = true) const;
 
     void Insert(wxGenericTreeItem *child, size_t index)
-        { m_children.insert(m_children.begin() + index, child); }
+    {
+        m_children.insert(m_children.begin() + index, child);
+        m_rowsIndex.Invalidate();
+
+        ChildRowsChanged(child, child->GetRows());
+    }
+
+    // remove the child which is going to be deleted
+    void Remove(size_t index)
+    {
+        wxGenericTreeItem * const child = m_children[index];
+        m_children.erase(m_children.begin() + index);
+        m_rowsIndex.Invalidate();
+
+        ChildRowsChanged(child, -static_cast<ptrdiff_t>(child->GetRows()));
+
+        // the rows of its children are already accounted for, don't subtract
+        // them again when they're deleted
+        child->m_childRows = 0;
+    }
+
+    // must be called after changing the order of the children
+    void InvalidateRowsIndex() { m_rowsIndex.Invalidate(); }
+
+    // return the number of rows taken by this item and its children if it is
+    // expanded, or by just this item otherwise
+    size_t GetRows() const { return IsExpanded() ? m_childRows + 1 : 1; }
+
+    // return the number of rows taken by the children, as if it were expanded
+    size_t GetChildRows() const { return m_childRows; }
+
+    // return the index of the rows of the children subtrees
+    const wxTreeRowsIndex& GetRowsIndex()
+    {
+        UpdateRowsIndex();
+        return m_rowsIndex;
+    }
+
+    // return the index of this item among the children of its parent
+    size_t GetIndex() const
+    {
+        wxASSERT_MSG( m_parent, "root item doesn't have any index" );
+
+        m_parent->UpdateRowsIndex();
+        return m_index;
+    }
 
     // calculate and cache the item size using either the provided DC (which is
     // supposed to already have wxGenericTreeCtrl font selected into it!) or a
@@ -269,8 +405,31 @@ public:
                                 int &flags,
                                 int level );
 
-    void Expand() { m_isCollapsed = false; }
-    void Collapse() { m_isCollapsed = true; }
+        // set the flags for the point which must be inside this item line
+    void GetHitTestFlags( const wxPoint& point,
+                          const wxGenericTreeCtrl *,
+                          int &flags );
+
+    void Expand()
+    {
+        if ( m_isCollapsed )
+        {
+            m_isCollapsed = false;
+            if ( m_parent )
+                m_parent->ChildRowsChanged(this, m_childRows);
+        }
+    }
+
+    void Collapse()
+    {
+        if ( !m_isCollapsed )
+        {
+            m_isCollapsed = true;
+            if ( m_parent )
+                m_parent->ChildRowsChanged(this,
+                                           -static_cast<ptrdiff_t>(m_childRows));
+        }
+    }
 
     void SetHilight( bool set = true ) { m_hasHilight = set; }
 
@@ -318,6 +477,16 @@ private:
     // m_widthText and m_heightText properly
     void DoCalculateSize(wxGenericTreeCtrl *control, wxReadOnlyDC& dc);
 
+    // delete all children without updating the rows of the parent items
+    void DoDeleteChildren(wxGenericTreeCtrl *tree);
+
+    // update the rows of this item and all of its parents after the number of
+    // rows of the given child changed by delta
+    void ChildRowsChanged(wxGenericTreeItem *child, ptrdiff_t delta);
+
+    // rebuild m_rowsIndex and the indices of the children if necessary
+    void UpdateRowsIndex();
+
     // since there can be very many of these, we save size by chosing
     // the smallest representation for the elements and by ordering
     // the members to avoid padding.
@@ -332,6 +501,11 @@ private:
     wxGenericTreeItems  m_children;     // list of children
     wxGenericTreeItem  *m_parent;       // parent of this item
 
+    size_t              m_childRows;    // rows of all children subtrees
+    size_t              m_index;        // index in the parent children, only
+                                        // valid if its m_rowsIndex is
+    wxTreeRowsIndex     m_rowsIndex;    // lazily built index of m_children
+
     wxItemAttr     *m_attr;         // attributes???
 
     // tree ctrl images for the normal, selected, expanded and
@@ -413,6 +587,25 @@ FindItemIndex(const wxGenericTreeItems& items, const wxGenericTreeItem* item)
     return wxNOT_FOUND;
 }
 
+// Return the index of the child whose subtree contains the given vertical
+// position, or 0 if the position is above all of them.
+//
+// This relies on the positions of the children of an expanded item, as
+// computed by CalculatePositions(), being increasing: the subtree of each
+// child then occupies the range from its own position and up to the position
+// of the next child, so that binary search can be used.
+static size_t
+FindChildAtY(const wxGenericTreeItems& children, int y)
+{
+    const auto it = std::upper_bound(children.begin(), children.end(), y,
+                                     [](int pos, const wxGenericTreeItem* child)
+                                     {
+                                         return pos < child->GetY();
+                                     });
+
+    return it == children.begin() ? 0 : it - children.begin() - 1;
+}
+
 // -----------------------------------------------------------------------------
 // wxTreeRenameTimer (internal)
 // -----------------------------------------------------------------------------
@@ -438,7 +631,7 @@ wxEND_EVENT_TABLE()
 
 wxTreeTextCtrl::wxTreeTextCtrl(wxGenericTreeCtrl *owner,
                                wxGenericTreeItem *itm)
-              : m_itemEdited(itm), m_startValue(itm->GetText())
+              : m_itemEdited(itm), m_startValue(owner->GetItemText(itm))
 {
     m_owner = owner;
     m_aboutToFinish = false;
@@ -635,6 +828,9 @@ wxGenericTreeItem::wxGenericTreeItem(wxGenericTreeItem *parent,
     m_state = wxTREE_ITEMSTATE_NONE;
     m_x = m_y = 0;
 
+    m_childRows =
+    m_index = 0;
+
     m_isCollapsed = true;
     m_hasHilight = false;
     m_hasPlus = false;
@@ -665,20 +861,66 @@ wxGenericTreeItem::~wxGenericTreeItem()
 }
 
 void wxGenericTreeItem::DeleteChildren(wxGenericTreeCtrl *tree)
+{
+    const size_t rows = m_childRows;
+
+    DoDeleteChildren(tree);
+
+    if ( m_parent && IsExpanded() )
+        m_parent->ChildRowsChanged(this, -static_cast<ptrdiff_t>(rows));
+}
+
+void wxGenericTreeItem::DoDeleteChildren(wxGenericTreeCtrl *tree)
 {
     size_t count = m_children.size();
     for ( size_t n = 0; n < count; n++ )
     {
         wxGenericTreeItem *child = m_children[n];
         tree->SendDeleteEvent(child);
+        tree->UncacheItemLabel(child);
 
-        child->DeleteChildren(tree);
+        child->DoDeleteChildren(tree);
         if ( child == tree->m_select_me )
             tree->m_select_me = nullptr;
         delete child;
     }
 
     m_children.clear();
+    m_rowsIndex.Invalidate();
+    m_childRows = 0;
+}
+
+void wxGenericTreeItem::ChildRowsChanged(wxGenericTreeItem *child,
+                                         ptrdiff_t delta)
+{
+    for ( wxGenericTreeItem *item = this; item; item = item->m_parent )
+    {
+        if ( item->m_rowsIndex.IsOk() )
+            item->m_rowsIndex.Add(child->m_index, delta);
+
+        item->m_childRows += delta;
+
+        // the rows of a collapsed item don't depend on its children
+        if ( !item->IsExpanded() )
+            break;
+
+        child = item;
+    }
+}
+
+void wxGenericTreeItem::UpdateRowsIndex()
+{
+    if ( m_rowsIndex.IsOk() )
+        return;
+
+    const size_t count = m_children.size();
+    for ( size_t n = 0; n < count; n++ )
+        m_children[n]->m_index = n;
+
+    m_rowsIndex.Build(count, [this](size_t n)
+                             {
+                                 return m_children[n]->GetRows();
+                             });
 }
 
 size_t wxGenericTreeItem::GetChildrenCount(bool recursively) const
@@ -716,89 +958,100 @@ void wxGenericTreeItem::GetSize( int &x, int &y,
     }
 }
 
-wxGenericTreeItem *wxGenericTreeItem::HitTest(const wxPoint& point,
-                                              const wxGenericTreeCtrl *theCtrl,
-                                              int &flags,
-                                              int level)
+void wxGenericTreeItem::GetHitTestFlags(const wxPoint& point,
+                                        const wxGenericTreeCtrl *theCtrl,
+                                        int &flags)
 {
-    // for a hidden root node, don't evaluate it, but do evaluate children
-    if ( !(level == 0 && theCtrl->HasFlag(wxTR_HIDE_ROOT)) )
-    {
-        // evaluate the item
-        int h = theCtrl->GetLineHeight(this);
-        if ((point.y > m_y) && (point.y < m_y + h))
-        {
-            int y_mid = m_y + h/2;
-            if (point.y < y_mid )
-                flags |= wxTREE_HITTEST_ONITEMUPPERPART;
-            else
-                flags |= wxTREE_HITTEST_ONITEMLOWERPART;
+    const int h = theCtrl->GetLineHeight(this);
+    int y_mid = m_y + h/2;
+    if (point.y < y_mid )
+        flags |= wxTREE_HITTEST_ONITEMUPPERPART;
+    else
+        flags |= wxTREE_HITTEST_ONITEMLOWERPART;
 
-            int xCross = m_x - theCtrl->FromDIP(theCtrl->GetSpacing());
+    int xCross = m_x - theCtrl->FromDIP(theCtrl->GetSpacing());
 #if defined(__WXMAC__) || defined(__WXGTK__)
-            // according to the drawing code the triangles are drawn
-            // at -4/-4  from the position up to +10/+10 max, but
-            // we have to detect the clicks at -10,-10 as also the
-            // native controls react to mouse click on the full
-            // height of the entry, not just where the triangle or
-            // chevron is drawn
-            const int triangleStart = theCtrl->FromDIP(10); // -10,-10
-            const int triangleEnd = theCtrl->FromDIP(10);   // +10, +10
-            if ((point.x > xCross - triangleStart) && (point.x < xCross + triangleEnd) &&
-                (point.y > y_mid - triangleStart) && (point.y < y_mid + triangleEnd) &&
-                HasPlus() && theCtrl->HasButtons() )
+    // according to the drawing code the triangles are drawn
+    // at -4/-4  from the position up to +10/+10 max, but
+    // we have to detect the clicks at -10,-10 as also the
+    // native controls react to mouse click on the full
+    // height of the entry, not just where the triangle or
+    // chevron is drawn
+    const int triangleStart = theCtrl->FromDIP(10); // -10,-10
+    const int triangleEnd = theCtrl->FromDIP(10);   // +10, +10
+    if ((point.x > xCross - triangleStart) && (point.x < xCross + triangleEnd) &&
+        (point.y > y_mid - triangleStart) && (point.y < y_mid + triangleEnd) &&
+        HasPlus() && theCtrl->HasButtons() )
 #else
-            // 5 is the size of the plus sign
-            const int plusSize = 1 + theCtrl->FromDIP(5);
-            if ((point.x > xCross - plusSize) && (point.x < xCross + plusSize) &&
-                (point.y > y_mid - plusSize) && (point.y < y_mid + plusSize) &&
-                HasPlus() && theCtrl->HasButtons() )
+    // 5 is the size of the plus sign
+    const int plusSize = 1 + theCtrl->FromDIP(5);
+    if ((point.x > xCross - plusSize) && (point.x < xCross + plusSize) &&
+        (point.y > y_mid - plusSize) && (point.y < y_mid + plusSize) &&
+        HasPlus() && theCtrl->HasButtons() )
 #endif
-            {
-                flags |= wxTREE_HITTEST_ONITEMBUTTON;
-                return this;
-            }
+    {
+        flags |= wxTREE_HITTEST_ONITEMBUTTON;
+        return;
+    }
 
-            if ((point.x >= m_x) && (point.x <= m_x+m_width))
-            {
-                int image_w = -1;
+    // in virtual mode the item may have not been measured yet
+    if ( theCtrl->IsVirtual() )
+        CalculateSize(wxConstCast(theCtrl, wxGenericTreeCtrl));
 
-                // assuming every image (normal and selected) has the same size!
-                if ( (GetImage() != NO_IMAGE) && theCtrl->HasImages() )
-                {
-                    image_w = theCtrl->GetImageLogicalSize(theCtrl).x;
-                }
+    if ((point.x >= m_x) && (point.x <= m_x+m_width))
+    {
+        int image_w = -1;
+
+        // assuming every image (normal and selected) has the same size!
+        if ( (GetImage() != NO_IMAGE) && theCtrl->HasImages() )
+        {
+            image_w = theCtrl->GetImageLogicalSize(theCtrl).x;
+        }
 
-                int state_w = -1;
+        int state_w = -1;
 
-                if ( (GetState() != wxTREE_ITEMSTATE_NONE) &&
-                        theCtrl->m_imagesState.HasImages() )
-                {
-                    int state_h;
-                    theCtrl->m_imagesState.GetImageLogicalSize(theCtrl,
+        if ( (GetState() != wxTREE_ITEMSTATE_NONE) &&
+                theCtrl->m_imagesState.HasImages() )
+        {
+            int state_h;
+            theCtrl->m_imagesState.GetImageLogicalSize(theCtrl,
                                                        state_w, state_h);
-                }
+        }
 
-                if ((state_w != -1) && (point.x <= m_x + state_w + 1))
-                    flags |= wxTREE_HITTEST_ONITEMSTATEICON;
-                else if ((image_w != -1) &&
-                         (point.x <= m_x +
-                            (state_w != -1 ? state_w +
-                                                MARGIN_BETWEEN_STATE_AND_IMAGE
-                                           : 0)
-                                            + image_w + 1))
-                    flags |= wxTREE_HITTEST_ONITEMICON;
-                else
-                    flags |= wxTREE_HITTEST_ONITEMLABEL;
+        if ((state_w != -1) && (point.x <= m_x + state_w + 1))
+            flags |= wxTREE_HITTEST_ONITEMSTATEICON;
+        else if ((image_w != -1) &&
+                 (point.x <= m_x +
+                    (state_w != -1 ? state_w +
+                                        MARGIN_BETWEEN_STATE_AND_IMAGE
+                                   : 0)
+                                    + image_w + 1))
+            flags |= wxTREE_HITTEST_ONITEMICON;
+        else
+            flags |= wxTREE_HITTEST_ONITEMLABEL;
 
-                return this;
-            }
+        return;
+    }
 
-            if (point.x < m_x)
-                flags |= wxTREE_HITTEST_ONITEMINDENT;
-            if (point.x > m_x+m_width)
-                flags |= wxTREE_HITTEST_ONITEMRIGHT;
+    if (point.x < m_x)
+        flags |= wxTREE_HITTEST_ONITEMINDENT;
+    if (point.x > m_x+m_width)
+        flags |= wxTREE_HITTEST_ONITEMRIGHT;
+}
 
+wxGenericTreeItem *wxGenericTreeItem::HitTest(const wxPoint& point,
+                                              const wxGenericTreeCtrl *theCtrl,
+                                              int &flags,
+                                              int level)
+{
+    // for a hidden root node, don't evaluate it, but do evaluate children
+    if ( !(level == 0 && theCtrl->HasFlag(wxTR_HIDE_ROOT)) )
+    {
+        // evaluate the item
+        int h = theCtrl->GetLineHeight(this);
+        if ((point.y > m_y) && (point.y < m_y + h))
+        {
+            GetHitTestFlags(point, theCtrl, flags);
             return this;
         }
 
@@ -809,7 +1062,17 @@ wxGenericTreeItem *wxGenericTreeItem::HitTest(const wxPoint& point,
 
     // evaluate children
     size_t count = m_children.size();
-    for ( size_t n = 0; n < count; n++ )
+    size_t n = 0;
+    if ( !theCtrl->m_dirty && count > 1 )
+    {
+        // when the positions are up to date, only the subtree of the child
+        // containing the point can match it, so don't bother checking the
+        // preceding ones nor the following ones
+        n = FindChildAtY(m_children, point.y);
+        count = n + 1;
+    }
+
+    for ( ; n < count; n++ )
     {
         wxGenericTreeItem *res = m_children[n]->HitTest( point,
                                                          theCtrl,
@@ -870,6 +1133,8 @@ wxGenericTreeItem::DoCalculateSize(wxGenericTreeCtrl* control,
     if ( m_width != 0 ) // Size known, nothing to do
         return;
 
+    const int heightOld = m_height;
+
     if ( m_widthText == -1 )
     {
         bool fontChanged = false;
@@ -878,7 +1143,8 @@ wxGenericTreeItem::DoCalculateSize(wxGenericTreeCtrl* control,
             fontChanged = true;
         }
 
-        dc.GetTextExtent( GetText(), &m_widthText, &m_heightText );
+        dc.GetTextExtent( control->GetItemLabel(this),
+                          &m_widthText, &m_heightText );
 
         // restore normal font if the DC used it previously and we changed it
         if ( fontChanged )
@@ -912,8 +1178,19 @@ wxGenericTreeItem::DoCalculateSize(wxGenericTreeCtrl* control,
     m_height += control->FromDIP(2); // See CalculateLineHeight().
 
     if (m_height > control->m_lineHeight)
+    {
         control->m_lineHeight = m_height;
 
+        // the positions of all items depend on the line height
+        control->m_dirty = true;
+    }
+    else if ( heightOld && m_height != heightOld &&
+                control->HasFlag(wxTR_HAS_VARIABLE_ROW_HEIGHT) )
+    {
+        // the positions of the items below this one depend on its height
+        control->m_dirty = true;
+    }
+
     m_width = state_w + image_w + m_widthText + 2;
 }
 
@@ -970,6 +1247,7 @@ void wxGenericTreeCtrl::Init()
     m_lineHeight = 10;
     m_indent = 0;
     m_spacing = 0;
+    m_itemsWidth = 0;
 
     m_dragCount = 0;
     m_isDragging = false;
@@ -1130,7 +1408,7 @@ wxString wxGenericTreeCtrl::GetItemText(const wxTreeItemId& item) const
 {
     wxCHECK_MSG( item.IsOk(), wxEmptyString, wxT("invalid tree item") );
 
-    return GetItemPtr(item)->GetText();
+    return GetItemLabel(GetItemPtr(item));
 }
 
 int wxGenericTreeCtrl::GetItemImage(const wxTreeItemId& item,
@@ -1187,7 +1465,20 @@ wxGenericTreeCtrl::SetItemText(const wxTreeItemId& item, const wxString& text)
     wxCHECK_RET( item.IsOk(), wxT("invalid tree item") );
 
     wxGenericTreeItem *pItem = GetItemPtr(item);
-    pItem->SetText(text);
+    if ( IsVirtual() )
+    {
+        // the new label is kept in the cache, just as if it had been returned
+        // by OnGetItemText()
+        UncacheItemLabel(pItem);
+        pItem->SetText(text);
+        if ( !text.empty() )
+            CacheItemLabel(pItem);
+    }
+    else
+    {
+        pItem->SetText(text);
+    }
+
     pItem->CalculateSize(this);
     RefreshLine(pItem);
 }
@@ -1316,6 +1607,9 @@ bool wxGenericTreeCtrl::SetFont( const wxFont &font )
     if (m_anchor)
         m_anchor->RecursiveResetTextSize();
 
+    // the item sizes and the line height have changed
+    m_dirty = true;
+
     return true;
 }
 
@@ -1455,10 +1749,7 @@ wxTreeItemId wxGenericTreeCtrl::GetNextSibling(const wxTreeItemId& item) const
     }
 
     wxGenericTreeItems& siblings = parent->GetChildren();
-    const int index = FindItemIndex(siblings, i);
-    wxASSERT( index != wxNOT_FOUND ); // I'm not a child of my parent?
-
-    size_t n = (size_t)(index + 1);
+    size_t n = i->GetIndex() + 1;
     return n == siblings.size() ? wxTreeItemId()
                                 : wxTreeItemId(siblings[n]);
 }
@@ -1476,11 +1767,9 @@ wxTreeItemId wxGenericTreeCtrl::GetPrevSibling(const wxTreeItemId& item) const
     }
 
     wxGenericTreeItems& siblings = parent->GetChildren();
-    const int index = FindItemIndex(siblings, i);
-    wxASSERT( index != wxNOT_FOUND ); // I'm not a child of my parent?
-
+    const size_t index = i->GetIndex();
     return index == 0 ? wxTreeItemId()
-                      : wxTreeItemId(siblings[(size_t)(index - 1)]);
+                      : wxTreeItemId(siblings[index - 1]);
 }
 
 // Only for internal use right now, but should probably be public
@@ -1517,17 +1806,142 @@ wxGenericTreeCtrl::DoGetNext(const wxTreeItemId& item, int flags) const
      return toFind;
 }
 
+size_t wxGenericTreeCtrl::GetRowCount() const
+{
+    if ( !m_anchor )
+        return 0;
+
+    size_t rows = m_anchor->GetRows();
+    if ( HasFlag(wxTR_HIDE_ROOT) )
+        rows--;
+
+    return rows;
+}
+
+size_t wxGenericTreeCtrl::GetItemRow(wxGenericTreeItem *item) const
+{
+    size_t row = 0;
+    for ( wxGenericTreeItem *parent = item->GetParent();
+          parent;
+          item = parent, parent = parent->GetParent() )
+    {
+        const size_t index = item->GetIndex();
+        row += parent->GetRowsIndex().GetRowsBefore(index);
+
+        // count the row of the parent itself, unless it's the hidden root
+        if ( parent != m_anchor || !HasFlag(wxTR_HIDE_ROOT) )
+            row++;
+    }
+
+    return row;
+}
+
+wxGenericTreeItem *wxGenericTreeCtrl::GetItemAtRow(size_t row) const
+{
+    wxCHECK_MSG( row < GetRowCount(), nullptr, "invalid row" );
+
+    wxGenericTreeItem *item = m_anchor;
+    if ( !HasFlag(wxTR_HIDE_ROOT) )
+    {
+        if ( !row )
+            return item;
+
+        row--;
+    }
+
+    // descend into the children subtree containing the row until we find the
+    // child at it
+    for ( ;; )
+    {
+        const wxTreeRowsIndex& index = item->GetRowsIndex();
+        const size_t n = index.FindRow(row);
+        row -= index.GetRowsBefore(n);
+
+        item = item->GetChildren()[n];
+        if ( !row )
+            return item;
+
+        row--;
+    }
+}
+
+void wxGenericTreeCtrl::UpdateItemPosition(wxGenericTreeItem *item) const
+{
+    if ( !HasUniformRows() )
+        return;
+
+    if ( item == m_anchor && HasFlag(wxTR_HIDE_ROOT) )
+        return;
+
+    // this must be consistent with CalculateLevel()
+    int level = 0;
+    for ( wxGenericTreeItem *parent = item->GetParent();
+          parent;
+          parent = parent->GetParent() )
+    {
+        level++;
+    }
+
+    const int indent = FromDIP(m_indent);
+
+    int x = level*indent;
+    if ( !HasFlag(wxTR_HIDE_ROOT) )
+        x += indent;
+
+    item->SetX(x + FromDIP(m_spacing));
+    item->SetY(2 + static_cast<int>(GetItemRow(item))*m_lineHeight);
+}
+
+wxGenericTreeItem *
+wxGenericTreeCtrl::HitTestItems(const wxPoint& point, int& flags) const
+{
+    if ( !HasUniformRows() )
+        return m_anchor->HitTest(point, this, flags, 0);
+
+    // the items start at 2, see CalculatePositions(), and, as in
+    // wxGenericTreeItem::HitTest(), the boundaries between them don't belong
+    // to any of them
+    const int y = point.y - 2;
+    if ( y <= 0 || y % m_lineHeight == 0 )
+        return nullptr;
+
+    const size_t row = y / m_lineHeight;
+    if ( row >= GetRowCount() )
+        return nullptr;
+
+    wxGenericTreeItem * const item = GetItemAtRow(row);
+    UpdateItemPosition(item);
+    item->GetHitTestFlags(point, this, flags);
+
+    return item;
+}
+
 wxTreeItemId wxGenericTreeCtrl::GetFirstVisibleItem() const
 {
     wxTreeItemId itemid = GetRootItem();
     if (!itemid.IsOk())
         return itemid;
 
+    if ( HasUniformRows() )
+    {
+        // start from the row at the top of the window instead of checking
+        // all the items above it
+        int y;
+        CalcUnscrolledPosition(0, 0, nullptr, &y);
+
+        const size_t row = y > 2 ? (y - 2) / m_lineHeight : 0;
+        if ( row >= GetRowCount() )
+            return wxTreeItemId();
+
+        itemid = GetItemAtRow(row);
+    }
+
+    // the items inside the collapsed ones can't be visible, so skip them
     do
     {
         if (IsVisible(itemid))
               return itemid;
-        itemid = GetNext(itemid);
+        itemid = DoGetNext(itemid, Next_Visible);
     } while (itemid.IsOk());
 
     return wxTreeItemId();
@@ -1546,41 +1960,75 @@ wxTreeItemId wxGenericTreeCtrl::GetPrevVisible(const wxTreeItemId& item) const
     wxCHECK_MSG( item.IsOk(), wxTreeItemId(), wxT("invalid tree item") );
     wxASSERT_MSG( IsVisible(item), wxT("this item itself should be visible") );
 
-    // find out the starting point
-    wxTreeItemId prevItem = GetPrevSibling(item);
-    if ( !prevItem.IsOk() )
-    {
-        prevItem = GetItemParent(item);
-    }
+    wxGenericTreeItem * const i = GetItemPtr(item);
+    if ( i == m_anchor )
+        return wxTreeItemId();
+
+    // the previous visible item is the one in the previous row
+    const size_t row = GetItemRow(i);
+    return row ? wxTreeItemId(GetItemAtRow(row - 1)) : wxTreeItemId();
+}
+
+// called by wxTextTreeCtrl when it marks itself for deletion
+void wxGenericTreeCtrl::ResetTextControl()
+{
+    m_textCtrl = nullptr;
+}
 
-    // find the first visible item after it
-    while ( prevItem.IsOk() && !IsVisible(prevItem) )
+const wxString& wxGenericTreeCtrl::GetItemLabel(wxGenericTreeItem *item) const
+{
+    if ( IsVirtual() )
     {
-        prevItem = GetNext(prevItem);
-        if ( !prevItem.IsOk() || prevItem == item )
+        const auto it = m_labelsCacheIndex.find(item);
+        if ( it != m_labelsCacheIndex.end() )
         {
-            // there are no visible items before item
-            return wxTreeItemId();
+            // just make it the most recently used one
+            m_labelsCache.splice(m_labelsCache.begin(), m_labelsCache, it->second);
+        }
+        else
+        {
+            // notice that we don't reset the item size here, the label is
+            // supposed to be the same as the one we had retrieved before
+            item->SetVirtualText(OnGetItemText(item));
+            CacheItemLabel(item);
         }
     }
 
-    // from there we must be able to navigate until this item
-    while ( prevItem.IsOk() )
+    return item->GetText();
+}
+
+void wxGenericTreeCtrl::CacheItemLabel(wxGenericTreeItem *item) const
+{
+    m_labelsCache.push_front(item);
+    m_labelsCacheIndex[item] = m_labelsCache.begin();
+
+    if ( m_labelsCache.size() > VIRTUAL_LABELS_CACHE_SIZE )
     {
-        const wxTreeItemId nextItem = GetNextVisible(prevItem);
-        if ( !nextItem.IsOk() || nextItem == item )
-            break;
+        wxGenericTreeItem* const oldest = m_labelsCache.back();
+        m_labelsCache.pop_back();
+        m_labelsCacheIndex.erase(oldest);
 
-        prevItem = nextItem;
+        oldest->DiscardVirtualText();
     }
+}
+
+void wxGenericTreeCtrl::UncacheItemLabel(wxGenericTreeItem *item) const
+{
+    const auto it = m_labelsCacheIndex.find(item);
+    if ( it == m_labelsCacheIndex.end() )
+        return;
 
-    return prevItem;
+    m_labelsCache.erase(it->second);
+    m_labelsCacheIndex.erase(it);
 }
 
-// called by wxTextTreeCtrl when it marks itself for deletion
-void wxGenericTreeCtrl::ResetTextControl()
+wxString wxGenericTreeCtrl::OnGetItemText(const wxTreeItemId& WXUNUSED(item)) const
 {
-    m_textCtrl = nullptr;
+    // this is a pure virtual function, in fact - which is not really pure
+    // because the controls which are not virtual don't need to implement it
+    wxFAIL_MSG("wxGenericTreeCtrl::OnGetItemText not supposed to be called");
+
+    return wxEmptyString;
 }
 
 void wxGenericTreeCtrl::ResetFindState()
@@ -1674,6 +2122,11 @@ wxTreeItemId wxGenericTreeCtrl::DoInsertItem(const wxTreeItemId& parentId,
     parent->Insert( item, previous == (size_t)-1 ? parent->GetChildren().size()
                                                  : previous );
 
+    // in virtual mode the items are usually created without labels, but if
+    // one is given, treat it as if it were returned by OnGetItemText()
+    if ( IsVirtual() && !text.empty() )
+        CacheItemLabel(item);
+
     InvalidateBestSize();
     return item;
 }
@@ -1694,6 +2147,9 @@ wxTreeItemId wxGenericTreeCtrl::AddRoot(const wxString& text,
         data->m_pItem = m_anchor;
     }
 
+    if ( IsVirtual() && !text.empty() )
+        CacheItemLabel(m_anchor);
+
     if (HasFlag(wxTR_HIDE_ROOT))
     {
         // if root is hidden, make sure we can navigate
@@ -1805,8 +2261,8 @@ void wxGenericTreeCtrl::Delete(const wxTreeItemId& itemId)
     {
         // .. unless there is a next sibling like wxMSW does it
         const auto& siblings = parent->GetChildren();
-        const int pos = FindItemIndex(siblings, item);
-        if ( wxSsize(siblings) > pos+1)
+        const size_t pos = item->GetIndex();
+        if ( siblings.size() > pos+1)
             to_be_selected = siblings[pos+1];
     }
 
@@ -1842,12 +2298,7 @@ void wxGenericTreeCtrl::Delete(const wxTreeItemId& itemId)
     // remove the item from the tree
     if ( parent )
     {
-        auto& siblings = parent->GetChildren();
-        const int index = FindItemIndex(siblings, item);
-        if ( index != wxNOT_FOUND )
-        {
-            siblings.erase(siblings.begin() + index);
-        }
+        parent->Remove(item->GetIndex());
     }
     else // deleting the root
     {
@@ -1858,6 +2309,7 @@ void wxGenericTreeCtrl::Delete(const wxTreeItemId& itemId)
     // and delete all of its children and the item itself now
     item->DeleteChildren(this);
     SendDeleteEvent(item);
+    UncacheItemLabel(item);
 
     if (item == m_select_me)
         m_select_me = nullptr;
@@ -1900,7 +2352,16 @@ void wxGenericTreeCtrl::Expand(const wxTreeItemId& itemId)
     item->Expand();
     if ( !IsFrozen() )
     {
-        CalculatePositions();
+        if ( HasUniformRows() )
+        {
+            // only the newly shown items need to be laid out, the positions
+            // of all the other ones are given by their rows
+            CalculateChildrenPositions(item);
+        }
+        else
+        {
+            CalculatePositions();
+        }
 
         RefreshSubtree(item);
     }
@@ -1950,7 +2411,10 @@ void wxGenericTreeCtrl::Collapse(const wxTreeItemId& itemId)
     }
 #endif
 
-    CalculatePositions();
+    // with uniform rows, the positions of the remaining items are given by
+    // their rows and don't need to be recalculated
+    if ( !HasUniformRows() )
+        CalculatePositions();
 
     RefreshSubtree(item);
 
@@ -2083,11 +2547,8 @@ wxGenericTreeCtrl::TagNextChildren(wxGenericTreeItem *crt_item,
         return TagAllChildrenUntilLast(crt_item, last_item, select);
 
     wxGenericTreeItems& children = parent->GetChildren();
-    const int index = FindItemIndex(children, crt_item);
-    wxASSERT( index != wxNOT_FOUND ); // I'm not a child of my parent?
-
     size_t count = children.size();
-    for (size_t n=(size_t)(index+1); n<count; ++n)
+    for (size_t n=crt_item->GetIndex()+1; n<count; ++n)
     {
         if ( TagAllChildrenUntilLast(children[n], last_item, select) )
             return true;
@@ -2128,6 +2589,9 @@ wxGenericTreeCtrl::SelectItemRange(wxGenericTreeItem *item1,
 {
     m_select_me = nullptr;
 
+    UpdateItemPosition(item1);
+    UpdateItemPosition(item2);
+
     // item2 is not necessary after item1
     // choice first' and 'last' between item1 and item2
     wxGenericTreeItem *first= (item1->GetY()<item2->GetY()) ? item1 : item2;
@@ -2334,6 +2798,8 @@ void wxGenericTreeCtrl::ScrollTo(const wxTreeItemId &item)
 
     wxGenericTreeItem *gitem = GetItemPtr(item);
 
+    UpdateItemPosition(gitem);
+
     int itemY = gitem->GetY();
 
     int start_x = 0;
@@ -2380,6 +2846,8 @@ void wxGenericTreeCtrl::SortChildren(const wxTreeItemId& itemId)
                   {
                       return OnCompareItems(a, b) < 0;
                   });
+
+        item->InvalidateRowsIndex();
     }
     //else: don't make the tree dirty as nothing changed
 }
@@ -2486,7 +2954,16 @@ void wxGenericTreeCtrl::AdjustMyScrollbars()
     if (m_anchor)
     {
         int x = 0, y = 0;
-        m_anchor->GetSize( x, y, this );
+        if ( HasUniformRows() )
+        {
+            // don't walk over all the items to find the extent of the tree
+            x = m_itemsWidth;
+            y = 2 + static_cast<int>(GetRowCount())*m_lineHeight;
+        }
+        else
+        {
+            m_anchor->GetSize( x, y, this );
+        }
         y += PIXELS_PER_UNIT+2; // one more scrollbar unit + 2 pixels
         x += PIXELS_PER_UNIT+2; // one more scrollbar unit + 2 pixels
         int x_pos = GetScrollPos( wxHORIZONTAL );
@@ -2512,6 +2989,11 @@ int wxGenericTreeCtrl::GetLineHeight(wxGenericTreeItem *item) const
 void wxGenericTreeCtrl::PaintItem(wxGenericTreeItem *item, wxDC& dc)
 {
     item->SetFont(this, dc);
+
+    // In virtual mode the item may be measured only now and if it turns out
+    // to be taller than the current line height, it is increased and the
+    // tree is marked as dirty, so that it is laid out and repainted using the
+    // new height in idle time.
     item->CalculateSize(this, dc);
 
     wxCoord text_h = item->GetTextHeight();
@@ -2676,7 +3158,7 @@ void wxGenericTreeCtrl::PaintItem(wxGenericTreeItem *item, wxDC& dc)
 
     dc.SetBackgroundMode(wxBRUSHSTYLE_TRANSPARENT);
     int extraH = (total_h > text_h) ? (total_h - text_h)/2 : 0;
-    dc.DrawText( item->GetText(),
+    dc.DrawText( GetItemLabel(item),
                  (wxCoord)(state_w + image_w + item->GetX()),
                  (wxCoord)(item->GetY() + extraH));
 
@@ -2737,21 +3219,15 @@ wxGenericTreeCtrl::PaintLevel(wxGenericTreeItem *item,
         // always expand hidden root
         int origY = y;
         wxGenericTreeItems& children = item->GetChildren();
-        int count = children.size();
-        if (count > 0)
+        if ( !children.empty() )
         {
-            int n = 0, oldY;
-            do {
-                oldY = y;
-                PaintLevel(children[n], dc, 1, y);
-            } while (++n < count);
-
-            if ( !HasFlag(wxTR_NO_LINES) && HasFlag(wxTR_LINES_AT_ROOT)
-                    && count > 0 )
+            int oldY = PaintChildren(item, dc, 1, y);
+
+            if ( !HasFlag(wxTR_NO_LINES) && HasFlag(wxTR_LINES_AT_ROOT) )
             {
                 // draw line down to last child
                 origY += GetLineHeight(children[0])>>1;
-                oldY += GetLineHeight(children[n-1])>>1;
+                oldY += GetLineHeight(children.back())>>1;
                 dc.DrawLine(3, origY, 3, oldY);
             }
         }
@@ -2805,6 +3281,10 @@ wxGenericTreeCtrl::PaintLevel(wxGenericTreeItem *item,
         // draw
         PaintItem(item, dc);
 
+        // the item may have been measured only now in virtual mode
+        if ( item->GetX() + item->GetWidth() > m_itemsWidth )
+            m_itemsWidth = item->GetX() + item->GetWidth();
+
         if (HasFlag(wxTR_ROW_LINES))
         {
             dc.SetPen(wxSystemSettings::GetColour(wxSYS_COLOUR_GRAYTEXT));
@@ -2876,20 +3356,14 @@ wxGenericTreeCtrl::PaintLevel(wxGenericTreeItem *item,
     if (item->IsExpanded())
     {
         wxGenericTreeItems& children = item->GetChildren();
-        int count = children.size();
-        if (count > 0)
+        if ( !children.empty() )
         {
-            int n = 0, oldY;
-            ++level;
-            do {
-                oldY = y;
-                PaintLevel(children[n], dc, level, y);
-            } while (++n < count);
-
-            if (!HasFlag(wxTR_NO_LINES) && count > 0)
+            int oldY = PaintChildren(item, dc, level + 1, y);
+
+            if (!HasFlag(wxTR_NO_LINES))
             {
                 // draw line down to last child
-                oldY += GetLineHeight(children[n-1])>>1;
+                oldY += GetLineHeight(children.back())>>1;
                 if (HasButtons())
                     y_mid += 5;
 
@@ -2915,6 +3389,75 @@ wxGenericTreeCtrl::PaintLevel(wxGenericTreeItem *item,
     }
 }
 
+int
+wxGenericTreeCtrl::PaintChildren(wxGenericTreeItem *item,
+                                 wxDC &dc,
+                                 int level,
+                                 int &y)
+{
+    wxGenericTreeItems& children = item->GetChildren();
+    const size_t count = children.size();
+
+    size_t n = 0;
+    int yBottom = INT_MAX;
+    int yLast = 0;
+    if ( HasUniformRows() )
+    {
+        // The rows of all the children subtrees are known, so we can skip
+        // the ones which are entirely above the area being repainted, and
+        // find the position of the last child without walking over all the
+        // expanded items, which is prohibitively slow for the trees with
+        // many of them.
+        const wxRect exposed = GetUpdateRegion().GetBox();
+        const wxTreeRowsIndex& index = item->GetRowsIndex();
+        const size_t rows = item->GetChildRows();
+
+        yLast = y + static_cast<int>(rows - children.back()->GetRows())
+                        *m_lineHeight;
+
+        const int yTop = dc.DeviceToLogicalY(exposed.y);
+        if ( yTop > y )
+        {
+            const size_t row = (yTop - y) / m_lineHeight;
+            if ( row >= rows )
+            {
+                // all the children are above the exposed area
+                y += static_cast<int>(rows)*m_lineHeight;
+                return yLast;
+            }
+
+            n = index.FindRow(row);
+            y += static_cast<int>(index.GetRowsBefore(n))*m_lineHeight;
+        }
+
+        yBottom = dc.DeviceToLogicalY(exposed.GetBottom());
+    }
+    else if ( !m_dirty )
+    {
+        // The positions of all items are known, so we can skip the subtrees
+        // which are entirely outside of the area being repainted.
+        const wxRect exposed = GetUpdateRegion().GetBox();
+
+        n = FindChildAtY(children, dc.DeviceToLogicalY(exposed.y));
+        if ( n > 0 )
+            y = children[n]->GetY();
+
+        yBottom = dc.DeviceToLogicalY(exposed.GetBottom());
+    }
+
+    for ( ; n < count; n++ )
+    {
+        PaintLevel(children[n], dc, level, y);
+
+        // Note that our caller will stop too in this case, so it doesn't
+        // matter that "y" is not updated to the end of all the children.
+        if ( y > yBottom )
+            break;
+    }
+
+    return HasUniformRows() ? yLast : children.back()->GetY();
+}
+
 void wxGenericTreeCtrl::DrawDropEffect(wxGenericTreeItem *item)
 {
     if ( item )
@@ -2957,6 +3500,8 @@ void wxGenericTreeCtrl::DrawBorder(const wxTreeItemId &item)
         m_dndEffectItem = nullptr;
     }
 
+    UpdateItemPosition(i);
+
     wxRect rect( i->GetX()-1, i->GetY()-1, i->GetWidth()+2, GetLineHeight(i)+2 );
     CalcScrolledPosition( rect.x, rect.y, &rect.x, &rect.y );
     RefreshRect( rect );
@@ -2982,6 +3527,8 @@ void wxGenericTreeCtrl::DrawLine(const wxTreeItemId &item, bool below)
         m_dndEffectItem = nullptr;
     }
 
+    UpdateItemPosition(i);
+
     wxRect rect( i->GetX()-1, i->GetY()-1, i->GetWidth()+2, GetLineHeight(i)+2 );
     CalcScrolledPosition( rect.x, rect.y, &rect.x, &rect.y );
     RefreshRect( rect );
@@ -3424,8 +3971,7 @@ wxGenericTreeCtrl::DoTreeHitTest(const wxPoint& point, int& flags) const
         return wxTreeItemId();
     }
 
-    wxGenericTreeItem *hit =  m_anchor->HitTest(CalcUnscrolledPosition(point),
-                                                this, flags, 0);
+    wxGenericTreeItem *hit = HitTestItems(CalcUnscrolledPosition(point), flags);
     if (hit == nullptr)
     {
         flags = wxTREE_HITTEST_NOWHERE;
@@ -3444,6 +3990,12 @@ bool wxGenericTreeCtrl::GetBoundingRect(const wxTreeItemId& item,
 
     wxGenericTreeItem *i = GetItemPtr(item);
 
+    // in virtual mode the items are not measured until they're shown
+    if ( IsVirtual() )
+        i->CalculateSize(wxConstCast(this, wxGenericTreeCtrl));
+
+    UpdateItemPosition(i);
+
     if ( textOnly )
     {
         int image_w = 0;
@@ -3561,7 +4113,7 @@ void wxGenericTreeCtrl::OnMouse( wxMouseEvent &event )
 
     // Is the mouse over a tree item button?
     int flags = 0;
-    wxGenericTreeItem *thisItem = m_anchor->HitTest(pt, this, flags, 0);
+    wxGenericTreeItem *thisItem = HitTestItems(pt, flags);
     wxGenericTreeItem *underMouse = thisItem;
 #if wxUSE_TOOLTIPS
     bool underMouseChanged = (underMouse != m_underMouse) ;
@@ -3646,7 +4198,7 @@ void wxGenericTreeCtrl::OnMouse( wxMouseEvent &event )
 
 
     flags = 0;
-    wxGenericTreeItem *item = m_anchor->HitTest(pt, this, flags, 0);
+    wxGenericTreeItem *item = HitTestItems(pt, flags);
 
     if ( event.Dragging() && !m_isDragging )
     {
@@ -3981,13 +4533,19 @@ wxGenericTreeCtrl::CalculateLevel(wxGenericTreeItem *item,
         goto Recurse;
     }
 
-    item->CalculateSize(this, dc);
+    // In virtual mode the items are only measured when they're shown, unless
+    // their size is needed to compute the positions of the following ones.
+    if ( !IsVirtual() || HasFlag(wxTR_HAS_VARIABLE_ROW_HEIGHT) )
+        item->CalculateSize(this, dc);
 
     // set its position
     item->SetX( x+spacing );
     item->SetY( y );
     y += GetLineHeight(item);
 
+    if ( item->GetX() + item->GetWidth() > m_itemsWidth )
+        m_itemsWidth = item->GetX() + item->GetWidth();
+
     if ( !item->IsExpanded() )
     {
         // we don't need to calculate collapsed branches
@@ -4002,14 +4560,54 @@ wxGenericTreeCtrl::CalculateLevel(wxGenericTreeItem *item,
         CalculateLevel( children[n], dc, level, y );  // recurse
 }
 
+void wxGenericTreeCtrl::CalculateChildrenPositions(wxGenericTreeItem *item)
+{
+    // see the comment in CalculatePositions()
+    if ( IsVirtual() && HasUniformRows() )
+        return;
+
+    wxGenericTreeItems& children = item->GetChildren();
+    if ( children.empty() )
+        return;
+
+    int level = 1;
+    for ( wxGenericTreeItem *parent = item->GetParent();
+          parent;
+          parent = parent->GetParent() )
+    {
+        level++;
+    }
+
+    wxInfoDC dc(this);
+    PrepareDC( dc );
+
+    UpdateItemPosition(item);
+
+    int y = item->GetY() + GetLineHeight(item);
+    const size_t count = children.size();
+    for ( size_t n = 0; n < count; ++n )
+        CalculateLevel( children[n], dc, level, y );
+}
+
 void wxGenericTreeCtrl::CalculatePositions()
 {
     if ( !m_anchor )
         return;
 
+    // In virtual mode the items are only measured when they're shown and if
+    // all rows have the same height, their positions are given by their rows,
+    // so there is nothing to do here. This is important because the tree gets
+    // dirty whenever showing an item increases the line height and we don't
+    // want to walk over all the items every time this happens. Notice that we
+    // also keep m_itemsWidth, updated when painting the items, in this case.
+    if ( IsVirtual() && HasUniformRows() )
+        return;
+
     wxInfoDC dc(this);
     PrepareDC( dc );
 
+    m_itemsWidth = 0;
+
     int y = 2;
     CalculateLevel( m_anchor, dc, 0, y ); // start recursion
 }
@@ -4027,6 +4625,8 @@ void wxGenericTreeCtrl::RefreshSubtree(wxGenericTreeItem *item)
 
     wxSize client = GetClientSize();
 
+    UpdateItemPosition(item);
+
     wxRect rect;
     CalcScrolledPosition(0, item->GetY(), nullptr, &rect.y);
     rect.width = client.x;
@@ -4042,6 +4642,8 @@ void wxGenericTreeCtrl::RefreshLine( wxGenericTreeItem *item )
     if (m_dirty || IsFrozen() )
         return;
 
+    UpdateItemPosition(item);
+
     wxRect rect;
     CalcScrolledPosition(0, item->GetY(), nullptr, &rect.y);
     rect.width = GetClientSize().x;
@@ -4119,13 +4721,14 @@ void wxGenericTreeCtrl::OnGetToolTip( wxTreeEvent &event )
 {
 #if wxUSE_TOOLTIPS
     wxTreeItemId itemId = event.GetItem();
-    const wxGenericTreeItem* const pItem = GetItemPtr(itemId);
+    wxGenericTreeItem* const pItem = GetItemPtr(itemId);
+    UpdateItemPosition(pItem);
 
     // Check if the item fits into the client area:
     if ( pItem->GetX() + pItem->GetWidth() > GetClientSize().x )
     {
         // If it doesn't, show its full text in the tooltip.
-        event.SetLabel(pItem->GetText());
+        event.SetLabel(GetItemText(itemId));
     }
     else
 #endif // wxUSE_TOOLTIPS
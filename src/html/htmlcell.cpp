@@ -318,6 +318,18 @@ wxHtmlWordCell::wxHtmlWordCell(const wxString& word, const wxDC& dc) : wxHtmlCel
     m_allowLinebreak = true;
 }
 
+wxHtmlWordCell::wxHtmlWordCell(const wxString& word,
+                               wxCoord width, wxCoord height, wxCoord descent)
+    : wxHtmlCell()
+    , m_Word(word)
+{
+    m_Width = width;
+    m_Height = height;
+    m_Descent = descent;
+    SetCanLiveOnPagebreak(false);
+    m_allowLinebreak = true;
+}
+
 void wxHtmlWordCell::SetPreviousWord(wxHtmlWordCell *cell)
 {
     if ( cell && m_Parent == cell->m_Parent &&
@@ -749,10 +761,6 @@ void wxHtmlContainerCell::Layout(int w)
 {
     wxHtmlCell::Layout(w);
 
-    if (m_LastLayout == w)
-        return;
-    m_LastLayout = w;
-
     // VS: Any attempt to layout with negative or zero width leads to hell,
     // but we can't ignore such attempts completely, since it sometimes
     // happen (e.g. when trying how small a table can be), so use at least one
@@ -760,33 +768,42 @@ void wxHtmlContainerCell::Layout(int w)
     if (w < 1)
         w = 1;
 
-    wxHtmlCell *nextCell;
-    long xpos = 0, ypos = m_IndentTop;
-    int xdelta = 0, ybasicpos = 0;
-    int s_width, s_indent;
-    int ysizeup = 0, ysizedown = 0;
-    int MaxLineWidth = 0;
-    int curLineWidth = 0;
-    m_MaxTotalWidth = 0;
-
-
     /*
 
     WIDTH ADJUSTING :
 
     */
 
+    int width;
     if (m_WidthFloatUnits == wxHTML_UNITS_PERCENT)
     {
-        if (m_WidthFloat < 0) m_Width = (100 + m_WidthFloat) * w / 100;
-        else m_Width = m_WidthFloat * w / 100;
+        if (m_WidthFloat < 0) width = (100 + m_WidthFloat) * w / 100;
+        else width = m_WidthFloat * w / 100;
     }
     else
     {
-        if (m_WidthFloat < 0) m_Width = w + m_WidthFloat;
-        else m_Width = m_WidthFloat;
+        if (m_WidthFloat < 0) width = w + m_WidthFloat;
+        else width = m_WidthFloat;
     }
 
+    // The layout only depends on our own width and not on the width of the
+    // parent, so there is nothing to do if it didn't change: notably, this
+    // avoids reflowing the contents of fixed width containers when the
+    // window is resized.
+    if (m_LastLayout != -1 && m_LastLayout == width)
+        return;
+    m_LastLayout = width;
+    m_Width = width;
+
+    wxHtmlCell *nextCell;
+    long xpos = 0, ypos = m_IndentTop;
+    int xdelta = 0, ybasicpos = 0;
+    int s_width, s_indent;
+    int ysizeup = 0, ysizedown = 0;
+    int MaxLineWidth = 0;
+    int curLineWidth = 0;
+    m_MaxTotalWidth = 0;
+
     if (m_Cells)
     {
         int l = (m_IndentLeft < 0) ? (-m_IndentLeft * m_Width / 100) : m_IndentLeft;
@@ -45,6 +45,10 @@ wxHtmlWinParser::wxHtmlWinParser(wxHtmlWindowInterface *wndIface)
     m_whitespaceMode = Whitespace_Normal;
     m_lastWordCell = nullptr;
     m_posColumn = 0;
+    m_wordExtentsFont = nullptr;
+    m_wordExtentsCurrent = nullptr;
+    m_wordExtentsScaleX =
+    m_wordExtentsScaleY = 0.0;
 
     {
         int i, j, k, l, m;
@@ -149,6 +153,7 @@ void wxHtmlWinParser::SetFonts(const wxString& normal_face,
                     for (m = 0; m < 7; m++) {
                         if (m_FontsTable[i][j][k][l][m] != nullptr)
                         {
+                            ClearWordExtents(m_FontsTable[i][j][k][l][m]);
                             delete m_FontsTable[i][j][k][l][m];
                             m_FontsTable[i][j][k][l][m] = nullptr;
                         }
@@ -421,6 +426,42 @@ void wxHtmlWinParser::AddWord(wxHtmlWordCell *word)
     m_lastWordCell = word;
 }
 
+wxHtmlWordCell *wxHtmlWinParser::CreateWordCell(const wxString& word)
+{
+    // Check that the font selected into the DC is still the one we had set,
+    // as it could have been changed by an overridden CreateCurrentFont().
+    if ( !m_wordExtentsCurrent ||
+            !m_DC->GetFont().IsSameAs(*m_wordExtentsFont) )
+        return new wxHtmlWordCell(word, *m_DC);
+
+    const auto it = m_wordExtentsCurrent->find(word);
+    if ( it != m_wordExtentsCurrent->end() )
+    {
+        const WordExtent& ext = it->second;
+        return new wxHtmlWordCell(word, ext.width, ext.height, ext.descent);
+    }
+
+    WordExtent ext;
+    m_DC->GetTextExtent(word, &ext.width, &ext.height, &ext.descent);
+    (*m_wordExtentsCurrent)[word] = ext;
+
+    return new wxHtmlWordCell(word, ext.width, ext.height, ext.descent);
+}
+
+void wxHtmlWinParser::ClearWordExtents(const wxFont *font)
+{
+    if ( font )
+        m_wordExtents.erase(font);
+    else
+        m_wordExtents.clear();
+
+    if ( !font || font == m_wordExtentsFont )
+    {
+        m_wordExtentsFont = nullptr;
+        m_wordExtentsCurrent = nullptr;
+    }
+}
+
 void wxHtmlWinParser::AddPreBlock(const wxString& text)
 {
     if ( text.find('\t') != wxString::npos )
@@ -506,6 +547,28 @@ void wxHtmlWinParser::SetFontSize(int s)
 
 void wxHtmlWinParser::SetDC(wxDC *dc, double pixel_scale, double font_scale)
 {
+    if ( dc )
+    {
+        // Cached word extents can't be reused if they could be different when
+        // measured using the new DC.
+        double scaleX, scaleY;
+        dc->GetUserScale(&scaleX, &scaleY);
+        scaleX *= dc->GetContentScaleFactor() * font_scale;
+        scaleY *= dc->GetContentScaleFactor() * font_scale;
+
+        const wxSize ppi = dc->GetPPI();
+        if ( ppi != m_wordExtentsPPI ||
+                scaleX != m_wordExtentsScaleX ||
+                scaleY != m_wordExtentsScaleY )
+        {
+            ClearWordExtents();
+
+            m_wordExtentsPPI = ppi;
+            m_wordExtentsScaleX = scaleX;
+            m_wordExtentsScaleY = scaleY;
+        }
+    }
+
     m_DC = dc;
     m_PixelScale = pixel_scale;
     m_FontScale = font_scale;
@@ -555,6 +618,7 @@ wxFont* wxHtmlWinParser::CreateCurrentFont()
 
     if (*fontptr != nullptr && (*faceptr != face))
     {
+        ClearWordExtents(*fontptr);
         wxDELETE(*fontptr);
     }
 
@@ -570,6 +634,10 @@ wxFont* wxHtmlWinParser::CreateCurrentFont()
                        );
     }
     m_DC->SetFont(**fontptr);
+
+    m_wordExtentsFont = *fontptr;
+    m_wordExtentsCurrent = &m_wordExtents[*fontptr];
+
     return (*fontptr);
 }
 
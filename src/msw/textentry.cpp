@@ -470,6 +470,12 @@ public:
 
         m_fixedCompleter->SetCompletions(strings);
 
+        // The fixed completer returns only the strings matching the prefix,
+        // but here we rely on IAutoComplete itself to filter them, so make
+        // sure it gets all of them, even if a different prefix had been used
+        // with a custom completer before.
+        m_enumStrings->UpdatePrefix(wxString());
+
         m_enumStrings->ChangeCompleter(m_fixedCompleter);
 
         DoRefresh();
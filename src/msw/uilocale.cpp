@@ -784,6 +784,55 @@ public:
         return 0;
     }
 
+    std::string GetSortKey(const wxString& str, int flags) const override
+    {
+        // Sort keys produced by LCMapStringEx() are documented to compare in
+        // the same way as the strings compared by CompareStringEx() with the
+        // same flags.
+        DWORD dwFlags = LCMAP_SORTKEY;
+
+        if ( flags & wxCompare_CaseInsensitive )
+            dwFlags |= NORM_IGNORECASE;
+
+        const wxWX2WCbuf buf = str.wc_str();
+
+        // Note that for LCMAP_SORTKEY the destination is a byte array and its
+        // size, which includes the trailing NUL, is in bytes.
+        const int size = ::LCMapStringEx
+            (
+                m_nameDisplay,
+                dwFlags,
+                buf, -1,
+                nullptr, 0,
+                nullptr,               // [in] version information -- not used
+                wxRESERVED_PARAM,
+                0                      // sort handle -- not used
+            );
+
+        if ( size > 0 )
+        {
+            std::string key(size, '\0');
+            if ( ::LCMapStringEx
+                   (
+                       m_nameDisplay,
+                       dwFlags,
+                       buf, -1,
+                       reinterpret_cast<LPWSTR>(&key[0]), size,
+                       nullptr,
+                       wxRESERVED_PARAM,
+                       0
+                   ) )
+            {
+                key.resize(size - 1);
+                return key;
+            }
+        }
+
+        wxLogLastError(wxT("LCMapStringEx(LCMAP_SORTKEY)"));
+
+        return GetDefaultSortKey(str, flags);
+    }
+
 private:
     // Ctor is private, use CreateDefault() or Create() instead.
     //
@@ -666,9 +666,11 @@ NSView* wxMacEditHelper::ms_viewCurrentlyEdited = nil;
                 // starting with the prefix, but there could be exceptions
                 // and, for compatibility with MSW which simply ignores all
                 // entries that don't match the current text control contents,
-                // we ignore them as well. Besides, our own wxTextCompleterFixed
-                // doesn't respect this rule and, moreover, we need to extract
-                // just the rest of the string anyhow.
+                // we ignore them as well. Notice that our own
+                // wxTextCompleterFixed matches the prefix case-insensitively,
+                // so the strings differing from it in case are ignored here
+                // too. Besides, we need to extract just the rest of the string
+                // anyhow.
                 wxString completion;
                 if ( s.StartsWith(prefix, &completion) )
                 {
@@ -585,6 +585,8 @@ void wxPGProperty::Init()
 
     m_maxLen = 0; // infinite maximum length
 
+    m_visibleRow = 0;
+
     m_flags = wxPGFlags::Property;
 
     m_depth = 1;
@@ -2408,6 +2410,15 @@ wxPropertyGrid* wxPGProperty::GetGridIfDisplayed() const
 
 int wxPGProperty::GetY2( int lh ) const
 {
+    // Use the index of the visible rows if possible, as computing the
+    // position from the heights of the preceding siblings is linear.
+    if ( m_parentState )
+    {
+        const int row = m_parentState->GetVisibleRow(this);
+        if ( row != wxNOT_FOUND )
+            return row*lh;
+    }
+
     const wxPGProperty* parent;
     const wxPGProperty* child = this;
 
@@ -2452,6 +2463,9 @@ void wxPGProperty::DoAddChild( wxPGProperty* prop, int index,
     }
 
     prop->m_parent = this;
+
+    if ( m_parentState )
+        m_parentState->VisibleRowsChanged();
 }
 
 void wxPGProperty::DoPreAddChild( int index, wxPGProperty* prop )
@@ -2469,6 +2483,9 @@ void wxPGProperty::DoPreAddChild( int index, wxPGProperty* prop )
         prop->m_flags |= wxPGFlags::CustomImage;
 
     prop->m_parent = this;
+
+    if ( m_parentState )
+        m_parentState->VisibleRowsChanged();
 }
 
 void wxPGProperty::AddPrivateChild( wxPGProperty* prop )
@@ -2514,12 +2531,17 @@ void wxPGProperty::RemoveChild( wxPGProperty* p )
     if ( it != m_children.end() )
     {
         m_children.erase(it);
+        if ( m_parentState )
+            m_parentState->VisibleRowsChanged();
     }
 }
 
 void wxPGProperty::RemoveChild(unsigned int index)
 {
     m_children.erase(m_children.begin()+index);
+
+    if ( m_parentState )
+        m_parentState->VisibleRowsChanged();
 }
 
 #if WXWIN_COMPATIBILITY_3_2
@@ -2527,12 +2549,18 @@ void wxPGProperty::SortChildren(int (*fCmp)(wxPGProperty**, wxPGProperty**))
 {
     wxArray_SortFunction<wxPGProperty*> sf(fCmp);
     std::sort(m_children.begin(), m_children.end(), sf);
+
+    if ( m_parentState )
+        m_parentState->VisibleRowsChanged();
 }
 #endif // WXWIN_COMPATIBILITY_3_2
 
 void wxPGProperty::SortChildren(bool (*fCmp)(wxPGProperty*, wxPGProperty*))
 {
     std::sort(m_children.begin(), m_children.end(), fCmp);
+
+    if ( m_parentState )
+        m_parentState->VisibleRowsChanged();
 }
 
 void wxPGProperty::AdaptListToValue( wxVariant& list, wxVariant* value ) const
@@ -2681,7 +2709,8 @@ wxPGProperty* wxPGProperty::GetItemAtY( unsigned int y,
 {
     wxCHECK( nextItemY, nullptr );
 
-    // Linear search at the moment
+    // Linear search, wxPropertyGridPageState::DoGetItemAtY() uses the index
+    // of the visible rows and should be preferred for the root property.
     //
     // nextItemY = y of next visible property, final value will be written back.
     wxPGProperty* result = nullptr;
@@ -2752,6 +2781,9 @@ wxPGProperty* wxPGProperty::GetItemAtY( unsigned int y ) const
     wxCHECK_MSG( pg, nullptr,
                  wxS("Cannot obtain property item for detached property") );
 
+    if ( m_parentState && m_parentState->DoGetRoot() == this )
+        return m_parentState->DoGetItemAtY(y);
+
     unsigned int nextItem = 0;
     return GetItemAtY(y, pg->GetRowHeight(), &nextItem);
 }
@@ -456,6 +456,7 @@ void wxPropertyGrid::Init2()
         m_pState->InitNonCatMode();
 
         m_pState->m_properties = m_pState->m_abcArray;
+        m_pState->VisibleRowsChanged();
     }
 
     GetClientSize(&m_width,&m_height);
@@ -1883,12 +1884,7 @@ wxBitmap wxPropertyGrid::RescaleBitmap(const wxBitmap& srcBmp,
 
 wxPGProperty* wxPropertyGrid::DoGetItemAtY( int y ) const
 {
-    // Outside?
-    if ( y < 0 )
-        return nullptr;
-
-    unsigned int a = 0;
-    return m_pState->DoGetRoot()->GetItemAtY(y, m_lineHeight, &a);
+    return m_pState->DoGetItemAtY(y);
 }
 
 // -----------------------------------------------------------------------
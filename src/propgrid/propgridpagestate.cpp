@@ -203,6 +203,7 @@ wxPropertyGridPageState::wxPropertyGridPageState()
     , m_vhCalcPending(false)
     , m_isSplitterPreSet(false)
     , m_dontCenterSplitter(false)
+    , m_visibleRowsValid(false)
 {
     m_regularArray.SetParentState(this);
 }
@@ -305,6 +306,9 @@ void wxPropertyGridPageState::DoClear()
 
         m_virtualHeight = 0;
         m_vhCalcPending = false;
+
+        m_visibleRows.clear();
+        m_visibleRowsValid = false;
     }
 }
 
@@ -529,6 +533,8 @@ bool wxPropertyGridPageState::EnableCategories( bool enable )
         m_properties = m_abcArray;
     }
 
+    VisibleRowsChanged();
+
     // fix parents, indexes, and depths
     wxPGProperty* parent = m_properties;
     unsigned int i = 0;
@@ -618,6 +624,8 @@ void wxPropertyGridPageState::DoSortChildren(wxPGProperty* p, wxPGPropertyValues
     // Fix indices
     p->FixIndicesOfChildren();
 
+    VisibleRowsChanged();
+
     if ( !!(flags & wxPGPropertyValuesFlags::Recurse) )
     {
         // Apply sort recursively
@@ -663,8 +671,51 @@ wxPGProperty* wxPropertyGridPageState::DoGetItemAtY( int y ) const
     if ( y < 0 )
         return nullptr;
 
-    unsigned int a = 0;
-    return m_properties->GetItemAtY(y, GetGrid()->GetRowHeight(), &a);
+    const int lh = GetGrid()->GetRowHeight();
+    if ( lh <= 0 )
+        return nullptr;
+
+    EnsureVisibleRows();
+
+    const size_t row = y / lh;
+    return row < m_visibleRows.size() ? m_visibleRows[row] : nullptr;
+}
+
+int wxPropertyGridPageState::GetVisibleRow(const wxPGProperty* p) const
+{
+    EnsureVisibleRows();
+
+    const unsigned int row = p->m_visibleRow;
+    if ( row < m_visibleRows.size() && m_visibleRows[row] == p )
+        return row;
+
+    return wxNOT_FOUND;
+}
+
+void wxPropertyGridPageState::EnsureVisibleRows() const
+{
+    if ( m_visibleRowsValid )
+        return;
+
+    m_visibleRows.clear();
+    AddVisibleRows(m_properties);
+    m_visibleRowsValid = true;
+}
+
+void wxPropertyGridPageState::AddVisibleRows(const wxPGProperty* parent) const
+{
+    // This must be kept in sync with wxPGProperty::GetChildrenHeight().
+    for ( wxPGProperty* p : parent->m_children )
+    {
+        if ( p->HasFlag(wxPGFlags::Hidden) )
+            continue;
+
+        p->m_visibleRow = m_visibleRows.size();
+        m_visibleRows.push_back(p);
+
+        if ( p->IsExpanded() && p->HasAnyChild() )
+            AddVisibleRows(p);
+    }
 }
 
 // -----------------------------------------------------------------------
@@ -1734,7 +1785,18 @@ wxPGProperty* wxPropertyGridPageState::DoInsert( wxPGProperty* parent, int index
         (parentIsCategory || parentIsRoot) )
         m_dictName[property->GetBaseName()] = property;
 
-    VirtualHeightChanged();
+    // Update the virtual height incrementally if possible, as recomputing it
+    // from scratch would make appending many properties one by one, which
+    // recalculates the virtual size after each of them, quadratic.
+    if ( !m_vhCalcPending && m_pPropGrid && !IsInNonCatMode() )
+    {
+        m_virtualHeight += GetAddedPropertyHeight(property);
+        VisibleRowsChanged();
+    }
+    else
+    {
+        VirtualHeightChanged();
+    }
 
     // Update values of all parents if they are containers of composed values.
     property->UpdateParentValues();
@@ -1754,6 +1816,30 @@ wxPGProperty* wxPropertyGridPageState::DoInsert( wxPGProperty* parent, int index
 
 // -----------------------------------------------------------------------
 
+unsigned int
+wxPropertyGridPageState::GetAddedPropertyHeight(const wxPGProperty* property) const
+{
+    // This must be kept in sync with wxPGProperty::GetChildrenHeight().
+    const int lh = m_pPropGrid->GetRowHeight();
+
+    for ( const wxPGProperty* p = property; p != m_properties; p = p->GetParent() )
+    {
+        if ( p->HasFlag(wxPGFlags::Hidden) )
+            return 0;
+
+        wxPGProperty* const parent = p->GetParent();
+        if ( !parent )
+            return 0;
+
+        if ( parent != m_properties && !parent->IsExpanded() )
+            return 0;
+    }
+
+    return lh + property->GetChildrenHeight(lh);
+}
+
+// -----------------------------------------------------------------------
+
 void wxPropertyGridPageState::DoRemoveChildrenFromSelection(wxPGProperty* p,
                                                             bool recursive,
                                                             wxPGSelectPropertyFlags selFlags)
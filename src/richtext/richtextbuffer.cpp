@@ -2492,6 +2492,115 @@ bool wxRichTextParagraphLayoutBox::Layout(wxReadOnlyDC& dc, wxRichTextDrawingCon
     return true;
 }
 
+/// Lay out only the paragraphs in the given range and move the following ones
+bool wxRichTextParagraphLayoutBox::LayoutParagraphs(wxReadOnlyDC& dc, wxRichTextDrawingContext& context, const wxRect& rect, const wxRichTextRange& range, int style)
+{
+    if (!IsShown() || IsDirty() || m_children.GetCount() == 0)
+        return false;
+
+    // Floating objects can affect any paragraph below them, so they require
+    // the full layout.
+    if (wxRichTextBuffer::GetFloatingLayoutMode() &&
+            (!GetFloatCollector() || GetFloatCollector()->HasFloats()))
+        return false;
+
+    wxRichTextAttr attr(GetAttributes());
+    AdjustAttributes(attr, context);
+
+    // With vertical alignment or a fixed height, the positions of all
+    // paragraphs depend on the size of the others.
+    if ((attr.GetTextBoxAttr().HasVerticalAlignment() &&
+            (attr.GetTextBoxAttr().GetVerticalAlignment() > wxTEXT_BOX_ATTR_VERTICAL_ALIGNMENT_TOP)) ||
+        attr.GetTextBoxAttr().GetSize().GetHeight().IsValid() ||
+        (style & wxRICHTEXT_FIXED_HEIGHT))
+        return false;
+
+    wxRichTextParagraph* firstParagraph = GetParagraphAtPosition(range.GetStart());
+    if (!firstParagraph)
+        return false;
+
+    wxRichTextObjectList::compatibility_iterator node = m_children.Find(firstParagraph);
+    if (!node)
+        return false;
+
+    context.SetLayingOut(true);
+
+    // Use the same parameters as Layout() would for the top-level box.
+    if (!GetParent() || (style & wxRICHTEXT_FIXED_WIDTH))
+        attr.GetTextBoxAttr().GetWidth().SetValue(rect.GetWidth(), wxTEXT_ATTR_UNITS_PIXELS);
+
+    style &= ~(wxRICHTEXT_FIXED_WIDTH|wxRICHTEXT_LAYOUT_SPECIFIED_RECT);
+
+    wxRect availableSpace = GetAvailableContentArea(dc, context, rect);
+
+    wxRichTextObjectList::compatibility_iterator previousNode = node->GetPrevious();
+    if (previousNode)
+    {
+        wxRichTextObject* previous = previousNode->GetData();
+        availableSpace.y = previous->GetPosition().y + previous->GetCachedSize().y;
+    }
+
+    wxRichTextObject* last = m_children.GetLast()->GetData();
+    const int oldBottom = last->GetPosition().y + last->GetCachedSize().y;
+
+    // Lay out the paragraphs in the range.
+    while (node)
+    {
+        wxRichTextParagraph* child = wxDynamicCast(node->GetData(), wxRichTextParagraph);
+        if (child && child->GetRange().GetStart() > range.GetEnd())
+            break;
+
+        if (child && child->IsShown())
+        {
+            child->LayoutToBestSize(dc, context, GetBuffer(),
+                    attr, child->GetAttributes(), availableSpace, rect, style);
+
+            availableSpace.y += child->GetCachedSize().y;
+        }
+
+        node = node->GetNext();
+    }
+
+    // And just move all the others, as Layout() does for the paragraphs
+    // outside of the invalid range.
+    int inc = 0;
+    if (node)
+        inc = availableSpace.y - node->GetData()->GetPosition().y;
+
+    while (node)
+    {
+        wxRichTextParagraph* child = wxDynamicCast(node->GetData(), wxRichTextParagraph);
+        if (child)
+        {
+            if (child->GetLines().empty())
+            {
+                child->LayoutToBestSize(dc, context, GetBuffer(),
+                        attr, child->GetAttributes(), availableSpace, rect, style);
+            }
+            else if (inc != 0)
+            {
+                child->Move(wxPoint(child->GetPosition().x, child->GetPosition().y + inc));
+            }
+
+            availableSpace.y += child->GetCachedSize().y;
+        }
+
+        node = node->GetNext();
+    }
+
+    // The width is fixed, so only the height of the box can have changed.
+    const int newBottom = last->GetPosition().y + last->GetCachedSize().y;
+    if (newBottom != oldBottom)
+    {
+        const int diff = newBottom - oldBottom;
+        SetCachedSize(wxSize(GetCachedSize().x, GetCachedSize().y + diff));
+        SetMinSize(wxSize(GetMinSize().x, GetMinSize().y + diff));
+        SetMaxSize(wxSize(GetMaxSize().x, GetMaxSize().y + diff));
+    }
+
+    return true;
+}
+
 /// Get/set the size for the given range.
 bool wxRichTextParagraphLayoutBox::GetRangeSize(const wxRichTextRange& range, wxSize& size, int& descent, wxReadOnlyDC& dc, wxRichTextDrawingContext& context, int flags, const wxPoint& position, const wxSize& parentSize, wxArrayInt* WXUNUSED(partialExtents)) const
 {
@@ -6782,6 +6891,9 @@ wxRichTextPlainText::wxRichTextPlainText(const wxString& text, wxRichTextObject*
         SetAttributes(*style);
 
     m_text = text;
+    m_cachedExtentsScale = 0.0;
+    m_cachedExtentsDescent = 0;
+    m_cachedExtentsCaps = false;
 }
 
 #define USE_KERNING_FIX 1
@@ -7220,6 +7332,60 @@ void wxRichTextPlainText::Copy(const wxRichTextPlainText& obj)
     wxRichTextObject::Copy(obj);
 
     m_text = obj.m_text;
+
+    // Don't copy the cached extents, they will be recomputed if needed.
+    m_cachedExtents.Clear();
+    m_cachedExtentsScale = 0.0;
+    m_cachedExtentsDescent = 0;
+    m_cachedExtentsCaps = false;
+}
+
+/// Get the cached partial extents for the entire text, updating them if necessary.
+const wxArrayInt* wxRichTextPlainText::GetCachedExtents(wxReadOnlyDC& dc, wxRichTextDrawingContext& context, const wxRichTextAttr& attr, bool create) const
+{
+    // Tabs widths depend on the position of the text, so we can't cache them,
+    // and virtual text can change at any time.
+    if (m_text.empty() || m_text.find(wxT('\t')) != wxString::npos || context.HasVirtualText(this))
+        return nullptr;
+
+    double scaleX, scaleY;
+    dc.GetUserScale(& scaleX, & scaleY);
+    const double scale = scaleX * dc.GetContentScaleFactor();
+    const wxSize ppi = dc.GetPPI();
+    const bool caps = attr.HasTextEffects() &&
+        (attr.GetTextEffects() & (wxTEXT_ATTR_EFFECT_CAPITALS|wxTEXT_ATTR_EFFECT_SMALL_CAPITALS)) != 0;
+
+    if (m_cachedExtents.GetCount() == m_text.length() &&
+            scale == m_cachedExtentsScale &&
+            ppi == m_cachedExtentsPPI &&
+            caps == m_cachedExtentsCaps &&
+            dc.GetFont() == m_cachedExtentsFont)
+        return & m_cachedExtents;
+
+    if (!create)
+        return nullptr;
+
+    wxString text(m_text);
+    wxString toRemove = wxRichTextLineBreakChar;
+    text.Replace(toRemove, wxT(" "));
+    if (caps)
+        text.MakeUpper();
+
+    m_cachedExtents.Clear();
+    dc.GetPartialTextExtents(text, m_cachedExtents);
+    if (m_cachedExtents.GetCount() != m_text.length())
+    {
+        m_cachedExtents.Clear();
+        return nullptr;
+    }
+
+    dc.GetTextExtent(wxT("X"), nullptr, nullptr, & m_cachedExtentsDescent);
+    m_cachedExtentsFont = dc.GetFont();
+    m_cachedExtentsPPI = ppi;
+    m_cachedExtentsScale = scale;
+    m_cachedExtentsCaps = caps;
+
+    return & m_cachedExtents;
 }
 
 /// Get/set the object size for the given range. Returns false if the range
@@ -7274,9 +7440,51 @@ bool wxRichTextPlainText::GetRangeSize(const wxRichTextRange& range, wxSize& siz
         }
     }
 
-    bool haveDescent = false;
     int startPos = range.GetStart() - GetRange().GetStart();
 
+    // If we have the partial extents of the entire text, the size of any part
+    // of it can be computed without measuring anything: notice that we only
+    // measure the text if it hadn't been done yet when partial extents are
+    // requested, as this is what happens during layout.
+    const wxArrayInt* const cachedExtents = GetCachedExtents(dc, context, textAttr, partialExtents != nullptr);
+    if (cachedExtents)
+    {
+        const int widthBefore = startPos > 0 ? (*cachedExtents)[startPos - 1] : 0;
+        const int endPos = range.GetEnd() - GetRange().GetStart();
+
+        int w;
+        if (partialExtents)
+        {
+            int oldWidth;
+            if (partialExtents->GetCount() > 0)
+                oldWidth = (*partialExtents)[partialExtents->GetCount()-1];
+            else
+                oldWidth = 0;
+
+            for (int i = startPos; i <= endPos; i++)
+                partialExtents->Add(oldWidth + (*cachedExtents)[i] - widthBefore);
+
+            if (partialExtents->GetCount() > 0)
+                w = (*partialExtents)[partialExtents->GetCount()-1];
+            else
+                w = 0;
+        }
+        else
+        {
+            w = endPos >= startPos ? (*cachedExtents)[endPos] - widthBefore : 0;
+        }
+
+        size = wxSize(w, dc.GetCharHeight());
+        descent = m_cachedExtentsDescent;
+
+        if ( bScript )
+            dc.SetFont(font);
+
+        return true;
+    }
+
+    bool haveDescent = false;
+
     wxString stringChunk;
 
     {
@@ -7452,6 +7660,25 @@ wxRichTextObject* wxRichTextPlainText::DoSplit(long pos)
     newObject->SetAttributes(GetAttributes());
     newObject->SetProperties(GetProperties());
 
+    // The extents of both parts can be deduced from the cached ones, if any.
+    if (m_cachedExtents.GetCount() == firstPart.length() + secondPart.length())
+    {
+        const int widthBefore = index > 0 ? m_cachedExtents[index - 1] : 0;
+        for (size_t i = index; i < m_cachedExtents.GetCount(); i++)
+            newObject->m_cachedExtents.Add(m_cachedExtents[i] - widthBefore);
+        newObject->m_cachedExtentsFont = m_cachedExtentsFont;
+        newObject->m_cachedExtentsPPI = m_cachedExtentsPPI;
+        newObject->m_cachedExtentsScale = m_cachedExtentsScale;
+        newObject->m_cachedExtentsDescent = m_cachedExtentsDescent;
+        newObject->m_cachedExtentsCaps = m_cachedExtentsCaps;
+
+        m_cachedExtents.RemoveAt(index, m_cachedExtents.GetCount() - index);
+    }
+    else
+    {
+        m_cachedExtents.Clear();
+    }
+
     newObject->SetRange(wxRichTextRange(pos, GetRange().GetEnd()));
     GetRange().SetEnd(pos-1);
 
@@ -7472,6 +7699,8 @@ bool wxRichTextPlainText::DeleteRange(const wxRichTextRange& range)
 
     r.LimitTo(GetRange());
 
+    m_cachedExtents.Clear();
+
     if (r.GetStart() == GetRange().GetStart() && r.GetEnd() == GetRange().GetEnd())
     {
         m_text.Empty();
@@ -7544,6 +7773,7 @@ bool wxRichTextPlainText::Merge(wxRichTextObject* object, wxRichTextDrawingConte
     if (textObject)
     {
         m_text += textObject->GetText();
+        m_cachedExtents.Clear();
         wxRichTextApplyStyle(m_attributes, textObject->GetAttributes());
         return true;
     }
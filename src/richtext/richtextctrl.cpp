@@ -373,6 +373,9 @@ void wxRichTextCtrl::Init()
     m_fullLayoutRequired = false;
     m_fullLayoutTime = 0;
     m_fullLayoutSavedPosition = 0;
+    m_enableIncrementalLayout = false;
+    m_incrementalLayoutPosition = 0;
+    m_incrementalLayoutEnd = -1;
     m_delayedLayoutThreshold = wxRICHTEXT_DEFAULT_DELAYED_LAYOUT_THRESHOLD;
     m_caretPositionForDefaultStyle = -2;
     m_focusObject = & m_buffer;
@@ -2828,6 +2831,8 @@ void wxRichTextCtrl::OnSize(wxSizeEvent& event)
         m_fullLayoutRequired = true;
         m_fullLayoutTime = wxGetLocalTimeMillis();
         m_fullLayoutSavedPosition = GetFirstVisiblePosition();
+        m_incrementalLayoutPosition = 0;
+        m_incrementalLayoutEnd = GetBuffer().GetOwnRange().GetEnd();
         LayoutContent(true /* onlyVisibleRect */);
     }
     else
@@ -2854,13 +2859,127 @@ void wxRichTextCtrl::ForceDelayedLayout()
     {
         m_fullLayoutRequired = false;
         m_fullLayoutTime = 0;
-        GetBuffer().Invalidate(wxRICHTEXT_ALL);
+
+        // Only the part not laid out yet needs to be done in incremental mode
+        // unless the buffer has changed in the meanwhile.
+        if (m_enableIncrementalLayout &&
+                m_incrementalLayoutEnd == GetBuffer().GetOwnRange().GetEnd())
+        {
+            if (m_incrementalLayoutPosition <= m_incrementalLayoutEnd)
+                GetBuffer().Invalidate(wxRichTextRange(m_incrementalLayoutPosition,
+                                                       m_incrementalLayoutEnd));
+        }
+        else
+            GetBuffer().Invalidate(wxRICHTEXT_ALL);
         ShowPosition(m_fullLayoutSavedPosition);
         Refresh(false);
         Update();
     }
 }
 
+// Lay out the next part of the buffer in incremental delayed layout mode
+bool wxRichTextCtrl::ContinueDelayedLayout()
+{
+    wxRichTextBuffer& buffer = GetBuffer();
+
+    // If the buffer was modified since the last step, the positions are not
+    // reliable any more, so start again from the beginning.
+    const long end = buffer.GetOwnRange().GetEnd();
+    if (end != m_incrementalLayoutEnd)
+    {
+        m_incrementalLayoutPosition = 0;
+        m_incrementalLayoutEnd = end;
+    }
+
+    // Only an up to date layout can be updated partially below.
+    LayoutContent();
+
+    // Remember the position of the first visible line on screen: as the
+    // paragraphs above it are laid out, their height may change, but we want
+    // to keep showing the same text to the user.
+    const int viewY = GetUnscaledPoint(GetLogicalPoint(wxPoint(0, 0))).y;
+    wxRichTextLine* line = buffer.GetLineAtYPosition(viewY);
+    const long anchorPos = line ? line->GetAbsoluteRange().GetStart() : -1;
+    const int anchorOffset = line ? line->GetAbsolutePosition().y - viewY : 0;
+
+    // Lay out the paragraphs in increasingly big chunks until we run out of
+    // time: the paragraphs following the laid out ones are just moved, so
+    // their old layout serves as an estimate of their size until we get to
+    // them.
+    wxRect availableSpace(GetUnscaledSize(GetClientSize()));
+    if (availableSpace.width == 0)
+        availableSpace.width = 10;
+    if (availableSpace.height == 0)
+        availableSpace.height = 10;
+
+    wxInfoDC dc(this);
+
+    PrepareDC(dc);
+    dc.SetUserScale(GetScale(), GetScale());
+
+    wxRichTextDrawingContext context(& buffer);
+
+    const wxLongLong startTime = wxGetLocalTimeMillis();
+    long chunkSize = 1000;
+    while (m_incrementalLayoutPosition <= end)
+    {
+        long chunkEnd = wxMin(m_incrementalLayoutPosition + chunkSize, end);
+
+        // Invalidate() rounds the range to the paragraph boundaries, so do
+        // the same thing here to avoid laying out the last paragraph twice.
+        wxRichTextParagraph* para = buffer.GetParagraphAtPosition(chunkEnd);
+        if (para)
+            chunkEnd = wxMax(chunkEnd, para->GetRange().GetEnd());
+
+        const wxRichTextRange range(m_incrementalLayoutPosition, chunkEnd);
+        if (!buffer.LayoutParagraphs(dc, context, availableSpace, range,
+                                     wxRICHTEXT_FIXED_WIDTH|wxRICHTEXT_VARIABLE_HEIGHT))
+        {
+            // This buffer can't be laid out partially, so fall back to the
+            // normal layout, starting from the chunk start.
+            buffer.Invalidate(range);
+            LayoutContent();
+        }
+
+        m_incrementalLayoutPosition = chunkEnd + 1;
+
+        if (wxGetLocalTimeMillis() - startTime > wxRICHTEXT_DEFAULT_INCREMENTAL_LAYOUT_TIME)
+            break;
+
+        chunkSize *= 2;
+    }
+
+    dc.SetUserScale(1.0, 1.0);
+
+    if (!IsFrozen())
+        SetupScrollbars();
+
+    if (GetDelayedImageLoading())
+        RequestDelayedImageProcessing();
+
+    if (anchorPos != -1)
+    {
+        line = buffer.GetLineAtPosition(anchorPos);
+        if (line)
+        {
+            int ppuX, ppuY;
+            GetScrollPixelsPerUnit(& ppuX, & ppuY);
+            if (ppuY > 0)
+            {
+                const int y = (int) (0.5 + (line->GetAbsolutePosition().y - anchorOffset) * GetScale());
+                const int yUnits = wxMax(0, y / ppuY);
+
+                int startXUnits, startYUnits;
+                GetViewStart(& startXUnits, & startYUnits);
+                if (yUnits != startYUnits)
+                    Scroll(-1, yUnits);
+            }
+        }
+    }
+
+    return m_incrementalLayoutPosition > end;
+}
+
 /// Idle-time processing
 void wxRichTextCtrl::OnIdle(wxIdleEvent& event)
 {
@@ -2878,11 +2997,26 @@ void wxRichTextCtrl::OnIdle(wxIdleEvent& event)
 
     if (m_fullLayoutRequired && (wxGetLocalTimeMillis() > (m_fullLayoutTime + layoutInterval)))
     {
-        m_fullLayoutRequired = false;
-        m_fullLayoutTime = 0;
-        GetBuffer().Invalidate(wxRICHTEXT_ALL);
-        ShowPosition(m_fullLayoutSavedPosition);
-        Refresh(false);
+        if (m_enableIncrementalLayout)
+        {
+            if (ContinueDelayedLayout())
+            {
+                m_fullLayoutRequired = false;
+                m_fullLayoutTime = 0;
+            }
+            else
+                event.RequestMore();
+
+            Refresh(false);
+        }
+        else
+        {
+            m_fullLayoutRequired = false;
+            m_fullLayoutTime = 0;
+            GetBuffer().Invalidate(wxRICHTEXT_ALL);
+            ShowPosition(m_fullLayoutSavedPosition);
+            Refresh(false);
+        }
     }
 
     const int imageProcessingInterval = wxRICHTEXT_DEFAULT_DELAYED_IMAGE_PROCESSING_INTERVAL;
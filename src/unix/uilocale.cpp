@@ -32,6 +32,7 @@
 
 #include "wx/uilocale.h"
 #include "wx/private/glibc.h"
+#include "wx/private/sortkey.h"
 #include "wx/private/uilocale.h"
 
 #include "wx/unix/private/uilocale.h"
@@ -216,6 +217,7 @@ public:
 
     int CompareStrings(const wxString& lhs, const wxString& rhs,
                        int flags) const override;
+    std::string GetSortKey(const wxString& str, int flags) const override;
 
 private:
 #ifdef HAVE_LANGINFO_H
@@ -963,6 +965,36 @@ wxUILocaleImplUnix::CompareStrings(const wxString& lhs, const wxString& rhs,
     return 0;
 }
 
+std::string
+wxUILocaleImplUnix::GetSortKey(const wxString& str,
+                               int WXUNUSED(flags)) const
+{
+    // Comparing the results of wcsxfrm() is the same as using wcscoll(), as
+    // CompareStrings() does.
+    const wxWX2WCbuf buf = str.wc_str();
+
+    size_t len;
+#ifdef HAVE_LOCALE_T
+    if ( m_locale )
+        len = wcsxfrm_l(nullptr, buf, 0, m_locale);
+    else
+#endif // HAVE_LOCALE_T
+        len = wcsxfrm(nullptr, buf, 0);
+
+    wxWCharBuffer xfrm(len);
+
+#ifdef HAVE_LOCALE_T
+    if ( m_locale )
+        wcsxfrm_l(xfrm.data(), buf, len + 1, m_locale);
+    else
+#endif // HAVE_LOCALE_T
+        wcsxfrm(xfrm.data(), buf, len + 1);
+
+    std::string key;
+    wxPrivate::AppendSortKeyXfrm(key, xfrm.data());
+    return key;
+}
+
 wxLocaleNumberFormatting
 wxUILocaleImplUnix::DoGetNumberFormatting(wxLocaleCategory cat) const
 {
@@ -735,5 +735,141 @@ void wxAnyTestCase::Misc()
     CPPUNIT_ASSERT_EQUAL(gs_myClassInstances.size(), 0);
 }
 
+TEST_CASE("wxVariant::Inline", "[variant]")
+{
+    // The data of the built-in types is stored inside the variant itself,
+    // check that it is handled correctly when copying it.
+    wxVariant v(17L);
+    CHECK( v.GetType() == "long" );
+    CHECK( v.GetLong() == 17 );
+
+    wxVariant v2(v);
+    CHECK( v2 == v );
+
+    v2 = 18L;
+    CHECK( v.GetLong() == 17 );
+    CHECK( v2.GetLong() == 18 );
+    CHECK( v2 != v );
+
+    v2 = v;
+    CHECK( v2 == v );
+
+    const wxVariant& v2ref = v2;
+    v2 = v2ref;
+    CHECK( v2.GetLong() == 17 );
+
+    v = 1.5;
+    CHECK( v.GetType() == "double" );
+    CHECK( v.GetDouble() == 1.5 );
+    CHECK( v.GetLong() == 1 );
+    CHECK( v != v2 );
+
+    v = true;
+    CHECK( v.GetType() == "bool" );
+    CHECK( v.GetBool() );
+
+    v = wxUniChar('x');
+    CHECK( v.GetType() == "char" );
+    CHECK( v.GetChar() == 'x' );
+
+    v = wxLongLong(wxLL(0x123456789));
+    CHECK( v.GetType() == "longlong" );
+    CHECK( v.GetLongLong() == wxLongLong(wxLL(0x123456789)) );
+
+    v = wxDateTime(1, wxDateTime::Jan, 2000);
+    CHECK( v.GetType() == "datetime" );
+    CHECK( v.GetDateTime() == wxDateTime(1, wxDateTime::Jan, 2000) );
+
+    // Short strings are stored inline too, but long ones are not.
+    v = "ab";
+    CHECK( v.GetType() == "string" );
+    CHECK( v.GetString() == "ab" );
+    CHECK( v == wxVariant("ab") );
+
+    const wxString longStr(wxString('x', 100));
+    v = longStr;
+    CHECK( v.GetType() == "string" );
+    CHECK( v.GetString() == longStr );
+    CHECK( v != wxVariant("ab") );
+
+    v2 = v;
+    CHECK( v2.GetData() == v.GetData() );
+
+    v = "ab";
+    CHECK( v2.GetString() == longStr );
+
+    // Comparing inline and heap-allocated data works too.
+    v = wxVariant(wxAny(17L));
+    CHECK( v.GetLong() == 17 );
+    CHECK( v == wxVariant(17L) );
+    CHECK( wxVariant(17L) == v );
+
+    // The data returned by GetData() must remain valid after the variant is
+    // destroyed if its reference count was incremented.
+    wxVariantData* data;
+    {
+        wxVariant vTemp(42L);
+        data = vTemp.GetData();
+        data->IncRef();
+
+        CHECK( vTemp.GetData() == data );
+        CHECK( vTemp.GetLong() == 42 );
+    }
+    CHECK( wxVariant(data).GetLong() == 42 );
+
+    // The same is true for the data returned by the const overload, which
+    // doesn't modify the variant, but must be updated when its value changes.
+    {
+        const wxVariant vConst(43L);
+        data = vConst.GetData();
+        data->IncRef();
+
+        CHECK( vConst.GetData() == data );
+        CHECK( vConst.GetLong() == 43 );
+    }
+    CHECK( wxVariant(data).GetLong() == 43 );
+
+    wxVariant vChanged(1L);
+    const wxVariant& vChangedRef = vChanged;
+    wxString str;
+    vChangedRef.GetData()->Write(str);
+    CHECK( str == "1" );
+
+    vChanged = 2L;
+    str.clear();
+    vChangedRef.GetData()->Write(str);
+    CHECK( str == "2" );
+
+    // Check moving inline and non-inline data.
+    wxVariant v3(std::move(v2));
+    CHECK( v3.GetString() == longStr );
+    CHECK( v2.IsNull() );
+
+    v3 = wxVariant(3L, "name");
+    CHECK( v3.GetLong() == 3 );
+    CHECK( v3.GetName() == "name" );
+
+    wxVariant v4(std::move(v3));
+    CHECK( v4.GetLong() == 3 );
+    CHECK( v3.IsNull() );
+
+    v4.MakeNull();
+    CHECK( v4.IsNull() );
+    CHECK( v4.GetType() == "null" );
+
+    // And storing inline data in lists.
+    wxVariant list;
+    list.NullList();
+    list.Append(1L);
+    list.Append("s");
+    list.Append(2.5);
+
+    const wxVariant listCopy(list);
+    CHECK( listCopy.GetCount() == 3 );
+    CHECK( listCopy[0].GetLong() == 1 );
+    CHECK( listCopy[1].GetString() == "s" );
+    CHECK( listCopy[2].GetDouble() == 2.5 );
+}
+
 #endif // wxUSE_ANY
 
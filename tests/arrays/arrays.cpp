@@ -415,6 +415,94 @@ TEST_CASE("wxSortedArrayString", "[dynarray]")
     CHECK( ad.Index("z") == wxNOT_FOUND );
 }
 
+TEST_CASE("wxArrayString::SortBig", "[dynarray]")
+{
+    // Use enough strings to sort them using multiple threads, if possible.
+    const size_t count = 100000;
+
+    wxArrayString a;
+    a.reserve(count);
+    for ( size_t n = 0; n < count; n++ )
+        a.push_back(wxString::Format("%zu", (n*7919) % count));
+
+    std::vector<wxString> expected(a.begin(), a.end());
+    std::sort(expected.begin(), expected.end());
+
+    wxSortedArrayString sorted(a);
+    CHECK( sorted.size() == count );
+    CHECK( std::equal(sorted.begin(), sorted.end(), expected.begin()) );
+    CHECK( sorted.Index("12345") != wxNOT_FOUND );
+
+    a.Sort();
+    CHECK( std::equal(a.begin(), a.end(), expected.begin()) );
+
+    a.Sort(true /* reverse */);
+    std::reverse(expected.begin(), expected.end());
+    CHECK( std::equal(a.begin(), a.end(), expected.begin()) );
+}
+
+TEST_CASE("wxStringSearchIndex", "[dynarray]")
+{
+    const wxArrayString
+        strings{"foo", "Foobar", "bar", "fo", "", "food", "baz", "FOO"};
+
+    typedef std::vector<size_t> Indices;
+
+    wxStringSearchIndex empty;
+    CHECK( empty.GetCount() == 0 );
+    CHECK( empty.FindPrefix("foo").empty() );
+    CHECK( empty.FindSubstring("foo").empty() );
+
+    SECTION("Case-sensitive")
+    {
+        wxStringSearchIndex index(strings);
+        REQUIRE( index.GetCount() == strings.size() );
+        CHECK( index.GetString(1) == "Foobar" );
+
+        CHECK( index.FindPrefix("foo") == Indices({0, 5}) );
+        CHECK( index.FindPrefix("fo") == Indices({0, 3, 5}) );
+        CHECK( index.FindPrefix("Foo") == Indices({1}) );
+        CHECK( index.FindPrefix("food!") == Indices() );
+        CHECK( index.FindPrefix("x") == Indices() );
+        CHECK( index.FindPrefix("").size() == strings.size() );
+
+        CHECK( index.FindSubstring("oo") == Indices({0, 1, 5}) );
+        CHECK( index.FindSubstring("ba") == Indices({1, 2, 6}) );
+        CHECK( index.FindSubstring("OO") == Indices({7}) );
+        CHECK( index.FindSubstring("oof") == Indices() );
+        CHECK( index.FindSubstring("").size() == strings.size() );
+    }
+
+    SECTION("Case-insensitive")
+    {
+        wxStringSearchIndex index(strings, false);
+
+        CHECK( index.FindPrefix("foo") == Indices({0, 1, 5, 7}) );
+        CHECK( index.FindPrefix("FOOB") == Indices({1}) );
+        CHECK( index.FindSubstring("oO") == Indices({0, 1, 5, 7}) );
+        CHECK( index.FindSubstring("AZ") == Indices({6}) );
+
+        // The original strings must be returned, not their lower case
+        // versions.
+        CHECK( index.GetString(7) == "FOO" );
+    }
+
+    SECTION("Non-ASCII")
+    {
+        wxArrayString nonASCII;
+        nonASCII.push_back(wxString::FromUTF8("\xc3\x89t\xc3\xa9"));
+        nonASCII.push_back(wxString::FromUTF8("\xc3\xa9t\xc3\xa9"));
+        nonASCII.push_back("et");
+
+        wxStringSearchIndex index(nonASCII);
+
+        CHECK( index.FindPrefix(wxString::FromUTF8("\xc3\xa9")) ==
+                Indices({1}) );
+        CHECK( index.FindSubstring(wxString::FromUTF8("t\xc3\xa9")) ==
+                Indices({0, 1}) );
+    }
+}
+
 TEST_CASE("Arrays::Split", "[dynarray]")
 {
     // test wxSplit:
@@ -921,6 +1009,37 @@ TEST_CASE("wxCmpNaturalGeneric", "[wxString][compare]")
     CHECK(wxCmpNaturalGeneric("a5th 5", "a 10th 10") > 0);
 }
 
+TEST_CASE("wxGetNaturalSortKey", "[wxString][compare]")
+{
+    const wxString strings[] =
+    {
+        "", " ", ",", "0", "00", "01", "1", "5", "05", "10", "a", "A", "AB",
+        "z", "1st", " 1st", ",1st", "01st", "5th", "10th", "a1st", "a01st",
+        "a5th", "a10th", "a 10th", "a5th 5", "a 10th 10", "a10th10",
+        "9999999999999999999", "99999999999999999999", "file_2.txt",
+        "File_10.txt", "file-2.txt", wxString::FromUTF8("\xc3\xa9t\xc3\xa9"),
+    };
+
+    for ( const wxString& s1 : strings )
+    {
+        const std::string key1 = wxGetNaturalSortKey(s1);
+        for ( const wxString& s2 : strings )
+        {
+            INFO("Comparing \"" << s1 << "\" and \"" << s2 << "\"");
+
+            const int rc = key1.compare(wxGetNaturalSortKey(s2));
+            const int expected = wxCmpNaturalGeneric(s1, s2);
+            CHECK( (rc > 0) - (rc < 0) == (expected > 0) - (expected < 0) );
+        }
+    }
+
+    // Sorting using wxCmpNaturalGeneric() uses the keys internally, check
+    // that it still works as expected.
+    wxArrayString a{"file10", "File1", "file2", "file 3", "file02b"};
+    a.Sort(wxCmpNaturalGeneric);
+    CHECK( a == wxArrayString{"file 3", "File1", "file2", "file02b", "file10"} );
+}
+
 TEST_CASE("wxCmpNatural", "[wxString][compare]")
 {
     // We can't expect much from the native natural comparison function as it's
@@ -17,3 +17,37 @@ BENCHMARK_FUNC(ParseDate)
     return dt.ParseDate("May 23, 2011") && dt.GetMonth() == wxDateTime::May;
 }
 
+
+BENCHMARK_FUNC(ParseFormat)
+{
+    wxDateTime dt;
+    wxString::const_iterator end;
+    return dt.ParseFormat("2011-05-23 12:34:56", "%Y-%m-%d %H:%M:%S",
+                          wxDefaultDateTime, &end) &&
+                dt.GetMonth() == wxDateTime::May;
+}
+
+BENCHMARK_FUNC(ParseFormatParser)
+{
+    static const wxDateTimeParser parser("%Y-%m-%d %H:%M:%S");
+
+    wxDateTime dt;
+    return parser.Parse("2011-05-23 12:34:56", dt) &&
+                dt.GetMonth() == wxDateTime::May;
+}
+
+BENCHMARK_FUNC(FormatDate)
+{
+    static const wxDateTime dt(23, wxDateTime::May, 2011, 12, 34, 56);
+
+    return dt.Format("%a, %d %b %Y %H:%M:%S").length() == 25;
+}
+
+BENCHMARK_FUNC(FormatDateFormatter)
+{
+    static const wxDateTime dt(23, wxDateTime::May, 2011, 12, 34, 56);
+    static const wxDateTimeFormatter formatter("%a, %d %b %Y %H:%M:%S");
+
+    wxChar buf[64];
+    return formatter.Format(dt, buf, WXSIZEOF(buf)) == 25;
+}
@@ -0,0 +1,198 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/hashmaps.cpp
+// Purpose:     wxHashMap and wxFlatHashMap benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/hashmap.h"
+#include "wx/flathashmap.h"
+
+#include "bench.h"
+
+// The number of elements in the maps can be changed using the numeric
+// parameter of the benchmark program.
+static long GetNumElements()
+{
+    return Bench::GetNumericParameter(1000);
+}
+
+WX_DECLARE_HASH_MAP(long, long, wxIntegerHash, wxIntegerEqual, LongHashMap);
+WX_DECLARE_FLAT_HASH_MAP(long, long, wxIntegerHash, wxIntegerEqual,
+                         LongFlatHashMap);
+
+WX_DECLARE_STRING_HASH_MAP(int, StringHashMap);
+WX_DECLARE_FLAT_STRING_HASH_MAP(int, StringFlatHashMap);
+
+// ----------------------------------------------------------------------------
+// Generic benchmark functions
+// ----------------------------------------------------------------------------
+
+// Keys are spread out to not be consecutive, as this would be too favourable
+// for the identity hash used for the integers.
+static long MakeLongKey(long n)
+{
+    return n * 7919;
+}
+
+static const wxString& MakeStringKey(long n)
+{
+    static std::vector<wxString> s_keys;
+    while ( static_cast<long>(s_keys.size()) <= n )
+        s_keys.push_back(wxString::Format("key number %zu", s_keys.size()));
+
+    return s_keys[n];
+}
+
+template <typename Map, typename MakeKey>
+bool DoInsert(MakeKey makeKey)
+{
+    const long count = GetNumElements();
+
+    Map map;
+    for ( long n = 0; n < count; n++ )
+        map[makeKey(n)] = n;
+
+    return map.size() == static_cast<size_t>(count);
+}
+
+template <typename Map, typename MakeKey>
+bool DoFind(MakeKey makeKey)
+{
+    const long count = GetNumElements();
+
+    static Map s_map;
+    if ( s_map.empty() )
+    {
+        for ( long n = 0; n < count; n++ )
+            s_map[makeKey(n)] = n;
+    }
+
+    // Look up both the existing and non-existing keys.
+    long found = 0;
+    for ( long n = 0; n < 2*count; n++ )
+    {
+        if ( s_map.find(makeKey(n)) != s_map.end() )
+            found++;
+    }
+
+    return found == count;
+}
+
+template <typename Map, typename MakeKey>
+bool DoIterate(MakeKey makeKey)
+{
+    const long count = GetNumElements();
+
+    static Map s_map;
+    if ( s_map.empty() )
+    {
+        for ( long n = 0; n < count; n++ )
+            s_map[makeKey(n)] = n;
+    }
+
+    long sum = 0;
+    for ( typename Map::const_iterator it = s_map.begin();
+          it != s_map.end();
+          ++it )
+    {
+        sum += it->second;
+    }
+
+    return sum == count*(count - 1)/2;
+}
+
+template <typename Map, typename MakeKey>
+bool DoErase(MakeKey makeKey)
+{
+    const long count = GetNumElements();
+
+    Map map;
+    for ( long n = 0; n < count; n++ )
+        map[makeKey(n)] = n;
+
+    for ( long n = 0; n < count; n++ )
+        map.erase(makeKey(n));
+
+    return map.empty();
+}
+
+// ----------------------------------------------------------------------------
+// Benchmarks for integer keys
+// ----------------------------------------------------------------------------
+
+BENCHMARK_FUNC(HashMapLongInsert)
+{
+    return DoInsert<LongHashMap>(MakeLongKey);
+}
+
+BENCHMARK_FUNC(FlatHashMapLongInsert)
+{
+    return DoInsert<LongFlatHashMap>(MakeLongKey);
+}
+
+BENCHMARK_FUNC(HashMapLongFind)
+{
+    return DoFind<LongHashMap>(MakeLongKey);
+}
+
+BENCHMARK_FUNC(FlatHashMapLongFind)
+{
+    return DoFind<LongFlatHashMap>(MakeLongKey);
+}
+
+BENCHMARK_FUNC(HashMapLongIterate)
+{
+    return DoIterate<LongHashMap>(MakeLongKey);
+}
+
+BENCHMARK_FUNC(FlatHashMapLongIterate)
+{
+    return DoIterate<LongFlatHashMap>(MakeLongKey);
+}
+
+BENCHMARK_FUNC(HashMapLongErase)
+{
+    return DoErase<LongHashMap>(MakeLongKey);
+}
+
+BENCHMARK_FUNC(FlatHashMapLongErase)
+{
+    return DoErase<LongFlatHashMap>(MakeLongKey);
+}
+
+// ----------------------------------------------------------------------------
+// Benchmarks for string keys
+// ----------------------------------------------------------------------------
+
+BENCHMARK_FUNC(HashMapStringInsert)
+{
+    return DoInsert<StringHashMap>(MakeStringKey);
+}
+
+BENCHMARK_FUNC(FlatHashMapStringInsert)
+{
+    return DoInsert<StringFlatHashMap>(MakeStringKey);
+}
+
+BENCHMARK_FUNC(HashMapStringFind)
+{
+    return DoFind<StringHashMap>(MakeStringKey);
+}
+
+BENCHMARK_FUNC(FlatHashMapStringFind)
+{
+    return DoFind<StringFlatHashMap>(MakeStringKey);
+}
+
+BENCHMARK_FUNC(HashMapStringErase)
+{
+    return DoErase<StringHashMap>(MakeStringKey);
+}
+
+BENCHMARK_FUNC(FlatHashMapStringErase)
+{
+    return DoErase<StringFlatHashMap>(MakeStringKey);
+}
@@ -93,6 +93,16 @@ const wxString g_verylongString =
 // to wxWidgets' implementation of wxVsnPrintf() !
 #define sys_printf swprintf
 
+// wrapper allowing to use wxString::Format() with the macros above: it
+// doesn't use the buffer but still formats the string in the same way
+template <typename... Targs>
+static int
+StringFormat(wxChar* WXUNUSED(buffer), size_t WXUNUSED(size),
+             const wxFormatString& format, Targs... args)
+{
+    return wxString::Format(format, args...).length();
+}
+
 
 // ----------------------------------------------------------------------------
 // main
@@ -132,3 +142,34 @@ BENCHMARK_FUNC(SystemSnprintf)
     return true;
 }
 
+
+BENCHMARK_FUNC(SystemSnprintfNarrow)
+{
+    char buffer[BUFSIZE];
+    DO_LONG_BENCHMARK(snprintf, )
+    DO_BENCHMARK(snprintf, )
+    return true;
+}
+
+BENCHMARK_FUNC(StringFormatWithPositionals)
+{
+#if wxUSE_PRINTF_POS_PARAMS
+    wxChar *buffer = nullptr;
+    DO_LONG_POSITIONAL_BENCHMARK(StringFormat, )
+    DO_POSITIONAL_BENCHMARK(StringFormat, )
+#endif
+    return true;
+}
+
+BENCHMARK_FUNC(StringFormat)
+{
+    wxChar *buffer = nullptr;
+    DO_LONG_BENCHMARK(StringFormat, )
+    DO_BENCHMARK(StringFormat, )
+    return true;
+}
+
+BENCHMARK_FUNC(StringFormatShort)
+{
+    return wxString::Format("%d: %s", 17, "short string").length() == 16;
+}
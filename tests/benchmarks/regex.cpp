@@ -72,3 +72,77 @@ BENCHMARK_FUNC(REFindTD)
 
     return matches == 21; // result of "grep -c"
 }
+
+// ----------------------------------------------------------------------------
+// Benchmark the same regex using JIT and/or separate match data
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Count the matches of the given regex in the test text using wxRegExMatch
+// and matching the text in place.
+int CountMatchesInPlace(const wxRegEx& re)
+{
+    const wxString& text = GetTestText();
+    const wxStringCharType* p = text.wx_str();
+    const wxStringCharType* const end = p + text.length();
+
+    wxRegExMatch match;
+
+    int matches = 0;
+    for ( ; re.Matches(p, end, match); ++matches )
+    {
+        size_t start, len;
+        if ( !match.Get(&start, &len) )
+            return -1;
+
+        p += start + len;
+    }
+
+    return matches;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(REFindTDInPlace)
+{
+    static wxRegEx re("<td>[^<]*</td>", wxRE_ICASE | wxRE_NEWLINE);
+
+    return CountMatchesInPlace(re) == 21;
+}
+
+BENCHMARK_FUNC(REFindTDJIT)
+{
+    static wxRegEx re("<td>[^<]*</td>", wxRE_ICASE | wxRE_NEWLINE | wxRE_JIT);
+
+    return CountMatchesInPlace(re) == 21;
+}
+
+BENCHMARK_FUNC(REReplaceTD)
+{
+    static wxRegEx re("<td>([^<]*)</td>", wxRE_ICASE | wxRE_NEWLINE | wxRE_JIT);
+
+    wxString text = GetTestText();
+    return re.Replace(&text, "[\\1]") == 21;
+}
+
+// ----------------------------------------------------------------------------
+// Benchmark matching several regexes at once
+// ----------------------------------------------------------------------------
+
+BENCHMARK_FUNC(RESetFindAll)
+{
+    static wxRegExSet set;
+    if ( !set.IsValid() )
+    {
+        set.Add("<td>[^<]*</td>", wxRE_ICASE | wxRE_NEWLINE);
+        set.Add("<a [^>]*>", wxRE_ICASE | wxRE_NEWLINE);
+        set.Add("<img [^>]*>", wxRE_ICASE | wxRE_NEWLINE);
+        if ( !set.Compile(wxRE_JIT) )
+            return false;
+    }
+
+    wxVector<wxRegExSet::Match> matches;
+    return set.FindAll(GetTestText(), matches) >= 21;
+}
@@ -329,6 +329,119 @@ BENCHMARK_FUNC(ArrStrSort)
     return !a.empty();
 }
 
+// Return a big array of strings looking like file names, in random order.
+static const wxArrayString& GetBigStringArray()
+{
+    static wxArrayString s_strings;
+    if ( s_strings.empty() )
+    {
+        const unsigned count = 100000;
+        s_strings.reserve(count);
+        for ( unsigned n = 0; n < count; n++ )
+        {
+            const unsigned num = (n*7919) % count;
+            s_strings.push_back(wxString::Format("%s_%05u.%s",
+                                                 num % 3 ? "Image" : "document",
+                                                 num,
+                                                 num % 2 ? "png" : "txt"));
+        }
+    }
+
+    return s_strings;
+}
+
+BENCHMARK_FUNC(ArrStrSortBig)
+{
+    wxArrayString a(GetBigStringArray());
+    a.Sort();
+    return a[0] < a[1];
+}
+
+BENCHMARK_FUNC(SortedArrStrAdd)
+{
+    const wxArrayString& strings = GetBigStringArray();
+
+    wxSortedArrayString a;
+    for ( size_t n = 0; n < strings.size(); n++ )
+        a.Add(strings[n]);
+
+    return a[0] < a[1];
+}
+
+BENCHMARK_FUNC(SortedArrStrFromArray)
+{
+    wxSortedArrayString a(GetBigStringArray());
+    return a[0] < a[1];
+}
+
+// Sorting using wxCmpNaturalGeneric() uses the natural sort keys internally,
+// compare it with calling the comparison function directly.
+static wxArrayString GetStringsToSortNaturally()
+{
+    const wxArrayString& strings = GetBigStringArray();
+
+    return wxArrayString(10000, &strings[0]);
+}
+
+BENCHMARK_FUNC(ArrStrSortNatural)
+{
+    wxArrayString a = GetStringsToSortNaturally();
+    a.Sort([](const wxString& s1, const wxString& s2)
+           {
+               return wxCmpNaturalGeneric(s1, s2);
+           });
+    return a[0] < a[1];
+}
+
+BENCHMARK_FUNC(ArrStrSortNaturalKeys)
+{
+    wxArrayString a = GetStringsToSortNaturally();
+    a.Sort(wxCmpNaturalGeneric);
+    return a[0] < a[1];
+}
+
+BENCHMARK_FUNC(ArrStrFindPrefix)
+{
+    const wxArrayString& a = GetBigStringArray();
+
+    size_t found = 0;
+    for ( size_t n = 0; n < a.size(); n++ )
+    {
+        if ( a[n].Lower().StartsWith("image_123") )
+            found++;
+    }
+
+    return found == 66;
+}
+
+BENCHMARK_FUNC(SearchIndexFindPrefix)
+{
+    static wxStringSearchIndex s_index(GetBigStringArray(), false);
+
+    return s_index.FindPrefix("image_123").size() == 66;
+}
+
+BENCHMARK_FUNC(ArrStrFindSubstring)
+{
+    const wxArrayString& a = GetBigStringArray();
+
+    size_t found = 0;
+    for ( size_t n = 0; n < a.size(); n++ )
+    {
+        if ( a[n].Lower().find("_9999") != wxString::npos )
+            found++;
+    }
+
+    return found == 10;
+}
+
+BENCHMARK_FUNC(SearchIndexFindSubstring)
+{
+    static wxStringSearchIndex s_index(GetBigStringArray(), false);
+
+    return s_index.FindSubstring("_9999").size() == 10;
+}
+
 BENCHMARK_FUNC(VectorStrPushBack)
 {
     std::vector<wxString> v;
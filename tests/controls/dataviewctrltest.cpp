@@ -26,6 +26,10 @@
 #include "testableframe.h"
 #include "asserthelper.h"
 
+#include <map>
+#include <memory>
+#include <vector>
+
 // ----------------------------------------------------------------------------
 // test class
 // ----------------------------------------------------------------------------
@@ -406,6 +410,148 @@ protected:
     wxDECLARE_NO_COPY_CLASS(DataViewCtrlWithCustomModelTestCase);
 };
 
+// Model with a single container item containing string items, which can be
+// added or deleted several at once, used for testing ItemsAdded() and
+// ItemsDeleted() handling.
+class DataViewCtrlBulkTestModel : public wxDataViewModel
+{
+public:
+    DataViewCtrlBulkTestModel()
+        : m_parentLabel("parent")
+    {
+    }
+
+    wxDataViewItem GetParentItem() const
+    {
+        return wxDataViewItem(const_cast<wxString*>(&m_parentLabel));
+    }
+
+    wxDataViewItemArray AddChildren(const std::vector<wxString>& labels)
+    {
+        wxDataViewItemArray items;
+        for ( size_t n = 0; n < labels.size(); n++ )
+        {
+            m_children.push_back(std::unique_ptr<wxString>(new wxString(labels[n])));
+            items.push_back(wxDataViewItem(m_children.back().get()));
+        }
+
+        ItemsAdded(GetParentItem(), items);
+
+        return items;
+    }
+
+    void DeleteChildren(const wxDataViewItemArray& items)
+    {
+        // Keep the labels alive until the control is notified about deleting
+        // them, as it may still use the corresponding items.
+        std::vector<std::unique_ptr<wxString>> deleted;
+        for ( size_t n = 0; n < items.size(); n++ )
+        {
+            for ( auto it = m_children.begin(); it != m_children.end(); ++it )
+            {
+                if ( it->get() == items[n].GetID() )
+                {
+                    deleted.push_back(std::move(*it));
+                    m_children.erase(it);
+                    break;
+                }
+            }
+        }
+
+        ItemsDeleted(GetParentItem(), items);
+    }
+
+    // Overridden wxDataViewModel methods.
+
+    void GetValue(wxVariant &variant, const wxDataViewItem &item,
+                  unsigned int WXUNUSED(col)) const override
+    {
+        variant = *static_cast<wxString*>(item.GetID());
+    }
+
+    bool SetValue(const wxVariant &WXUNUSED(variant),
+                  const wxDataViewItem &WXUNUSED(item),
+                  unsigned int WXUNUSED(col)) override
+    {
+        return false;
+    }
+
+    wxDataViewItem GetParent(const wxDataViewItem &item) const override
+    {
+        return item == GetParentItem() ? wxDataViewItem() : GetParentItem();
+    }
+
+    bool IsContainer(const wxDataViewItem &item) const override
+    {
+        return !item.IsOk() || item == GetParentItem();
+    }
+
+    unsigned int GetChildren(const wxDataViewItem &item,
+                             wxDataViewItemArray &children) const override
+    {
+        if ( !item.IsOk() )
+        {
+            children.push_back(GetParentItem());
+        }
+        else if ( item == GetParentItem() )
+        {
+            for ( size_t n = 0; n < m_children.size(); n++ )
+                children.push_back(wxDataViewItem(m_children[n].get()));
+        }
+
+        return children.size();
+    }
+
+private:
+    wxString m_parentLabel;
+    std::vector<std::unique_ptr<wxString>> m_children;
+};
+
+class DataViewCtrlBulkTestCase
+{
+public:
+    DataViewCtrlBulkTestCase();
+    ~DataViewCtrlBulkTestCase();
+
+protected:
+    // Add the children with the given labels to the model.
+    void AddChildren(const std::vector<wxString>& labels)
+    {
+        const wxDataViewItemArray items = m_model->AddChildren(labels);
+        for ( size_t n = 0; n < labels.size(); n++ )
+            m_items[labels[n]] = items[n];
+    }
+
+    // Delete the children with the given labels from the model.
+    void DeleteChildren(const std::vector<wxString>& labels)
+    {
+        wxDataViewItemArray items;
+        for ( size_t n = 0; n < labels.size(); n++ )
+        {
+            items.push_back(m_items[labels[n]]);
+            m_items.erase(labels[n]);
+        }
+
+        m_model->DeleteChildren(items);
+    }
+
+    // Check that the items with the given labels are shown in this order, in
+    // consecutive rows.
+    void CheckRows(const std::vector<wxString>& labels);
+
+    // The dataview control.
+    wxDataViewCtrl *m_dvc;
+
+    // The dataview model.
+    DataViewCtrlBulkTestModel *m_model;
+
+    // The container item and its children, indexed by their labels.
+    wxDataViewItem m_parent;
+    std::map<wxString, wxDataViewItem> m_items;
+
+    wxDECLARE_NO_COPY_CLASS(DataViewCtrlBulkTestCase);
+};
+
 // ----------------------------------------------------------------------------
 // test initialization
 // ----------------------------------------------------------------------------
@@ -500,6 +646,66 @@ DataViewCtrlWithCustomModelTestCase::~DataViewCtrlWithCustomModelTestCase()
     delete m_dvc;
 }
 
+DataViewCtrlBulkTestCase::DataViewCtrlBulkTestCase()
+{
+    m_dvc = new wxDataViewCtrl(wxTheApp->GetTopWindow(),
+                               wxID_ANY,
+                               wxDefaultPosition,
+                               wxSize(400, 200),
+                               wxDV_SINGLE);
+
+    m_model = new DataViewCtrlBulkTestModel();
+    m_dvc->AssociateModel(m_model);
+    m_model->DecRef();
+
+    m_dvc->AppendTextColumn("Value", 0);
+
+    m_parent = m_model->GetParentItem();
+    m_items["parent"] = m_parent;
+
+    AddChildren({"d", "b", "f"});
+
+    m_dvc->Layout();
+    m_dvc->Expand(m_parent);
+    m_dvc->Refresh();
+    m_dvc->Update();
+}
+
+DataViewCtrlBulkTestCase::~DataViewCtrlBulkTestCase()
+{
+    delete m_dvc;
+}
+
+void DataViewCtrlBulkTestCase::CheckRows(const std::vector<wxString>& labels)
+{
+    m_dvc->Refresh();
+    m_dvc->Update();
+
+#ifdef __WXGTK__
+    WaitFor("wxDataViewCtrl update", [this, labels]() {
+        return !m_dvc->GetItemRect(m_items[labels.back()]).IsEmpty();
+    });
+#endif // __WXGTK__
+
+    wxRect rectPrev;
+    for ( size_t n = 0; n < labels.size(); n++ )
+    {
+        INFO("Checking item \"" << labels[n] << "\"");
+
+        const wxRect rect = m_dvc->GetItemRect(m_items[labels[n]]);
+        REQUIRE( !rect.IsEmpty() );
+
+        if ( n > 0 )
+        {
+            // Allow for the spacing between the rows, but not for another row.
+            CHECK( rect.y >= rectPrev.y + rectPrev.height );
+            CHECK( rect.y < rectPrev.y + 2*rectPrev.height );
+        }
+
+        rectPrev = rect;
+    }
+}
+
 // ----------------------------------------------------------------------------
 // the tests themselves
 // ----------------------------------------------------------------------------
@@ -861,6 +1067,74 @@ TEST_CASE_METHOD(MultiColumnsDataViewCtrlTestCase,
     CHECK( m_lastColumn->GetWidth() >= lastColumnMinWidth );
 }
 
+TEST_CASE_METHOD(DataViewCtrlBulkTestCase,
+                 "wxDVC::ItemsAdded",
+                 "[wxDataViewCtrl][item]")
+{
+    SECTION("Unsorted")
+    {
+        m_dvc->Select(m_items["f"]);
+
+        AddChildren({"a", "c"});
+        CheckRows({"parent", "d", "b", "f", "a", "c"});
+
+        CHECK( m_dvc->GetSelection() == m_items["f"] );
+    }
+
+    SECTION("Sorted")
+    {
+        m_dvc->GetColumn(0)->SetSortOrder(true);
+        m_dvc->Select(m_items["f"]);
+
+        AddChildren({"e", "a", "c"});
+        CheckRows({"parent", "a", "b", "c", "d", "e", "f"});
+
+        CHECK( m_dvc->GetSelection() == m_items["f"] );
+    }
+
+    SECTION("Sorted collapsed")
+    {
+        // Changing the sort order while the parent is collapsed doesn't sort
+        // its children immediately, check that adding new ones still works
+        // in this case.
+        m_dvc->Collapse(m_parent);
+        m_dvc->GetColumn(0)->SetSortOrder(true);
+
+        AddChildren({"e", "a", "c"});
+
+        m_dvc->Expand(m_parent);
+        CheckRows({"parent", "a", "b", "c", "d", "e", "f"});
+    }
+}
+
+TEST_CASE_METHOD(DataViewCtrlBulkTestCase,
+                 "wxDVC::ItemsDeleted",
+                 "[wxDataViewCtrl][delete]")
+{
+    AddChildren({"a", "c", "e"});
+
+    SECTION("Unsorted")
+    {
+        m_dvc->Select(m_items["f"]);
+
+        DeleteChildren({"e", "b", "a"});
+        CheckRows({"parent", "d", "f", "c"});
+
+        CHECK( m_dvc->GetSelection() == m_items["f"] );
+    }
+
+    SECTION("Sorted")
+    {
+        m_dvc->GetColumn(0)->SetSortOrder(true);
+        m_dvc->Select(m_items["f"]);
+
+        DeleteChildren({"e", "b"});
+        CheckRows({"parent", "a", "c", "d", "f"});
+
+        CHECK( m_dvc->GetSelection() == m_items["f"] );
+    }
+}
+
 #if wxUSE_UIACTIONSIMULATOR
 
 TEST_CASE_METHOD(SingleSelectDataViewCtrlTestCase,
@@ -32,6 +32,7 @@
 
 #include "waitfor.h"
 
+#include <limits>
 #include <memory>
 
 // To disable tests which work locally, but not when run on GitHub CI.
@@ -2680,6 +2681,218 @@ TEST_CASE("wxGrid::Events", "[grid][event]")
     CHECK( selectEvents.GetCount() == 0 );
 }
 
+TEST_CASE("GridTypedTable", "[grid][table]")
+{
+    wxGridTypedTable table(3, 3);
+
+    CHECK( table.GetColType(0) == wxGRID_VALUE_STRING );
+
+    REQUIRE( table.SetColValues(0, std::vector<wxString>{"b", "a", "b"}) );
+    REQUIRE( table.SetColValues(1, std::vector<wxLongLong_t>{3, 1, 2}) );
+    REQUIRE( table.SetColValues(2, std::vector<double>{0.5, 1.5, 2.5}) );
+
+    CHECK( table.GetTypeName(0, 1) == wxGRID_VALUE_NUMBER );
+    CHECK( table.CanGetValueAs(0, 2, wxGRID_VALUE_FLOAT) );
+    CHECK( table.CanGetValueAs(0, 2, wxGRID_VALUE_STRING) );
+    CHECK( !table.CanGetValueAs(0, 2, wxGRID_VALUE_BOOL) );
+
+    CHECK( table.GetValue(1, 0) == "a" );
+    CHECK( table.GetValueAsLong(0, 1) == 3 );
+    CHECK( table.GetValue(0, 1) == "3" );
+    CHECK( table.GetValueAsDouble(1, 2) == 1.5 );
+
+    SECTION("Set")
+    {
+        table.SetValue(0, 1, "17");
+        CHECK( table.GetValueAsLong(0, 1) == 17 );
+
+        table.SetValueAsDouble(2, 2, 4.0);
+        CHECK( table.GetValueAsDouble(2, 2) == 4.0 );
+
+        table.SetValue(2, 2, "");
+        CHECK( table.IsEmptyCell(2, 2) );
+        CHECK( !table.IsEmptyCell(2, 1) );
+    }
+
+    SECTION("Sort")
+    {
+        table.SortByCol(1);
+
+        std::vector<wxLongLong_t> longs;
+        REQUIRE( table.GetColValues(1, longs) );
+        CHECK( longs == std::vector<wxLongLong_t>{1, 2, 3} );
+
+        std::vector<wxString> strings;
+        REQUIRE( table.GetColValues(0, strings) );
+        CHECK( strings == std::vector<wxString>{"a", "b", "b"} );
+
+        // Sorting is stable, so the rows with "b" keep their relative order.
+        table.SortByCol(0, false);
+        REQUIRE( table.GetColValues(1, longs) );
+        CHECK( longs == std::vector<wxLongLong_t>{2, 3, 1} );
+
+        CHECK( !table.GetColValues(2, longs) );
+    }
+
+    SECTION("ChangeType")
+    {
+        REQUIRE( table.SetColType(1, wxGRID_VALUE_STRING) );
+        CHECK( table.GetValue(2, 1) == "2" );
+
+        REQUIRE( table.SetColType(0, wxGRID_VALUE_BOOL) );
+        CHECK( table.GetValueAsBool(0, 0) );
+    }
+
+    SECTION("LongLong")
+    {
+        const auto maxValue = std::numeric_limits<wxLongLong_t>::max();
+        const auto minValue = std::numeric_limits<wxLongLong_t>::min();
+        REQUIRE( table.SetColValues(1, std::vector<wxLongLong_t>{maxValue, minValue, 2}) );
+
+        // The values not fitting into long are clamped, not truncated.
+        CHECK( table.GetValueAsLong(0, 1) == std::numeric_limits<long>::max() );
+        CHECK( table.GetValueAsLong(1, 1) == std::numeric_limits<long>::min() );
+        CHECK( table.GetValueAsLong(2, 1) == 2 );
+
+        std::vector<wxLongLong_t> longs;
+        REQUIRE( table.GetColValues(1, longs) );
+        CHECK( longs[0] == maxValue );
+
+        table.SetValueAsDouble(2, 1, 1e30);
+        CHECK( table.GetValue(2, 1) == wxString() << maxValue );
+    }
+
+    SECTION("EmptyNumber")
+    {
+        table.SetValue(0, 1, "");
+        CHECK( table.IsEmptyCell(0, 1) );
+        CHECK( table.GetValue(0, 1) == "" );
+        CHECK( table.GetValueAsLong(0, 1) == 0 );
+
+        table.SetValue(2, 1, "0");
+        CHECK( !table.IsEmptyCell(2, 1) );
+        CHECK( table.GetValue(2, 1) == "0" );
+
+        // Empty cells are sorted after all the others.
+        table.SortByCol(1);
+        CHECK( table.GetValue(0, 1) == "0" );
+        CHECK( table.GetValue(1, 1) == "1" );
+        CHECK( table.IsEmptyCell(2, 1) );
+
+        // And remain empty when converting the column to another type.
+        REQUIRE( table.SetColType(1, wxGRID_VALUE_FLOAT) );
+        CHECK( table.IsEmptyCell(2, 1) );
+        CHECK( !table.IsEmptyCell(0, 1) );
+
+        REQUIRE( table.SetColType(1, wxGRID_VALUE_NUMBER) );
+        CHECK( table.IsEmptyCell(2, 1) );
+
+        table.SetValueAsLong(2, 1, 0);
+        CHECK( !table.IsEmptyCell(2, 1) );
+    }
+
+    SECTION("Dictionary")
+    {
+        // Replace the only "a" and check that another string can reuse its
+        // dictionary entry without affecting the other cells.
+        table.SetValue(1, 0, "c");
+        table.SetValue(0, 0, "d");
+        table.SetValue(0, 0, "d");
+
+        std::vector<wxString> strings;
+        REQUIRE( table.GetColValues(0, strings) );
+        CHECK( strings == std::vector<wxString>{"d", "c", "b"} );
+
+        REQUIRE( table.DeleteRows(0, 2) );
+        REQUIRE( table.AppendRows(2) );
+        table.SetValue(1, 0, "a");
+        table.SetValue(2, 0, "d");
+
+        REQUIRE( table.GetColValues(0, strings) );
+        CHECK( strings == std::vector<wxString>{"b", "a", "d"} );
+
+        table.SortByCol(0);
+        REQUIRE( table.GetColValues(0, strings) );
+        CHECK( strings == std::vector<wxString>{"a", "b", "d"} );
+    }
+
+    SECTION("InsertDelete")
+    {
+        REQUIRE( table.InsertRows(1, 2) );
+        CHECK( table.GetNumberRows() == 5 );
+        CHECK( table.GetValueAsLong(3, 1) == 1 );
+        CHECK( table.IsEmptyCell(1, 1) );
+        CHECK( table.IsEmptyCell(1, 2) );
+
+        REQUIRE( table.DeleteRows(0, 3) );
+        CHECK( table.GetNumberRows() == 2 );
+        CHECK( table.GetValue(0, 0) == "a" );
+
+        REQUIRE( table.InsertCols(0) );
+        CHECK( table.GetNumberCols() == 4 );
+        CHECK( table.GetColType(2) == wxGRID_VALUE_NUMBER );
+    }
+}
+
+namespace TypedTableEmptyCells
+{
+
+// Renderers giving access to the text they draw.
+class NumberRenderer : public wxGridCellNumberRenderer
+{
+public:
+    using wxGridCellNumberRenderer::GetString;
+};
+
+class FloatRenderer : public wxGridCellFloatRenderer
+{
+public:
+    FloatRenderer() : wxGridCellFloatRenderer(-1, 1) { }
+
+    using wxGridCellFloatRenderer::GetString;
+};
+
+} // namespace TypedTableEmptyCells
+
+TEST_CASE_METHOD(GridTestCase, "Grid::TypedTableEmptyCells", "[grid][table]")
+{
+    using namespace TypedTableEmptyCells;
+
+    wxGridTypedTable table(2, 2);
+    REQUIRE( table.SetColType(0, wxGRID_VALUE_NUMBER) );
+    REQUIRE( table.SetColType(1, wxGRID_VALUE_FLOAT) );
+
+    table.SetValueAsLong(0, 0, 17);
+    table.SetValueAsDouble(0, 1, 1.5);
+
+    m_grid->SetTable(&table);
+
+    CHECK( table.CanGetValueAs(0, 0, wxGRID_VALUE_NUMBER) );
+    CHECK( !table.CanGetValueAs(1, 0, wxGRID_VALUE_NUMBER) );
+    CHECK( table.CanGetValueAs(1, 0, wxGRID_VALUE_STRING) );
+
+    wxObjectDataPtr<NumberRenderer> numberRenderer(new NumberRenderer);
+    wxObjectDataPtr<FloatRenderer> floatRenderer(new FloatRenderer);
+
+    CHECK( numberRenderer->GetString(*m_grid, 0, 0) == "17" );
+    CHECK( numberRenderer->GetString(*m_grid, 1, 0) == "" );
+    CHECK( floatRenderer->GetString(*m_grid, 0, 1) == "1.5" );
+    CHECK( floatRenderer->GetString(*m_grid, 1, 1) == "" );
+
+    // The newly inserted rows must be shown as empty too.
+    REQUIRE( table.InsertRows(0) );
+    CHECK( numberRenderer->GetString(*m_grid, 0, 0) == "" );
+    CHECK( floatRenderer->GetString(*m_grid, 0, 1) == "" );
+    CHECK( numberRenderer->GetString(*m_grid, 1, 0) == "17" );
+
+    // Check that drawing the grid with empty cells works too.
+    m_grid->Refresh();
+    m_grid->Update();
+
+    // Remove the grid table before our local object goes out of scope.
+    m_grid->SetTable(nullptr);
+}
+
 //
 // TestableGrid
 //
@@ -1560,6 +1560,102 @@ TEST_CASE("PropertyGridTestCase", "[propgrid]")
         }
     }
 
+    SECTION("Append_VirtualHeight")
+    {
+        wxPropertyGridPage* page = pgManager->GetPage(0);
+
+        const auto checkHeight = [page]()
+        {
+            unsigned int h1 = page->GetVirtualHeight();
+            unsigned int h2 = page->GetActualVirtualHeight();
+            CHECK(h1 == h2);
+        };
+
+        checkHeight();
+
+        wxPGProperty* cat = page->Append(new wxPropertyCategory("Appended Category"));
+        checkHeight();
+
+        page->Append(new wxStringProperty("Appended String"));
+        checkHeight();
+
+        page->Append(new wxFontProperty("Appended Font"));
+        checkHeight();
+
+        wxPGProperty* hidden = new wxIntProperty("Appended Hidden");
+        hidden->Hide(true);
+        page->Append(hidden);
+        checkHeight();
+
+        page->Collapse(cat);
+        checkHeight();
+
+        page->AppendIn(cat, new wxIntProperty("Appended Int"));
+        checkHeight();
+
+        page->Expand(cat);
+        checkHeight();
+    }
+
+    SECTION("GetItemAtY")
+    {
+        pgManager->SelectPage(0);
+        wxPropertyGrid* pg = pgManager->GetGrid();
+        const int lh = pg->GetRowHeight();
+
+        // Compare the results with the linear search over all properties.
+        const auto checkRows = [pg, lh]()
+        {
+            for ( int row = 0; ; row++ )
+            {
+                INFO("Row " << row);
+
+                unsigned int nextY = 0;
+                wxPGProperty* p = pg->GetRoot()->GetItemAtY(row*lh, lh, &nextY);
+                CHECK( pg->GetItemAtY(row*lh + lh/2) == p );
+                if ( !p )
+                    break;
+
+                CHECK( p->GetY() == row*lh );
+            }
+        };
+
+        checkRows();
+
+        wxPGProperty* cat = nullptr;
+        for ( auto it = pg->GetIterator(wxPG_ITERATE_CATEGORIES); !it.AtEnd(); ++it )
+        {
+            cat = *it;
+            break;
+        }
+        REQUIRE( cat );
+
+        pg->Collapse(cat);
+        checkRows();
+
+        pg->Expand(cat);
+        checkRows();
+
+        std::vector<wxPGProperty*> arr = GetPropertiesInRandomOrder(pg);
+        arr.resize(arr.size() / 2);
+        for ( wxPGProperty* p : arr )
+            pg->HideProperty(p, true);
+        checkRows();
+
+        for ( wxPGProperty* p : arr )
+            pg->HideProperty(p, false);
+        checkRows();
+
+        pg->Sort();
+        checkRows();
+
+        pg->EnableCategories(false);
+        checkRows();
+
+        pg->EnableCategories(true);
+        checkRows();
+    }
+
     SECTION("SetFlagsAsString_GetFlagsAsString")
     {
         std::uniform_int_distribution<int> distrib(0, 1);
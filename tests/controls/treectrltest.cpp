@@ -23,10 +23,15 @@
 #include "wx/artprov.h"
 #include "wx/imaglist.h"
 #include "wx/treectrl.h"
+#include "wx/generic/treectlg.h"
 #include "wx/uiaction.h"
 #include "testableframe.h"
 #include "waitfor.h"
 
+#include <map>
+#include <memory>
+#include <vector>
+
 // ----------------------------------------------------------------------------
 // test class
 // ----------------------------------------------------------------------------
@@ -702,4 +707,194 @@ TEST_CASE_METHOD(TreeCtrlTestCase, "wxTreeCtrl::Sort", "[treectrl]")
     CHECK(m_tree->GetNextChild(m_root, cookie) == zitem);
 }
 
+TEST_CASE("wxGenericTreeCtrl::Rows", "[treectrl]")
+{
+    std::unique_ptr<wxGenericTreeCtrl>
+        tree(new wxGenericTreeCtrl(wxTheApp->GetTopWindow(), wxID_ANY,
+                                   wxDefaultPosition, wxSize(400, 400)));
+
+    const wxTreeItemId root = tree->AddRoot("root");
+    std::vector<wxTreeItemId> children;
+    for ( int n = 0; n < 3; n++ )
+    {
+        const wxTreeItemId child =
+            tree->AppendItem(root, wxString::Format("child %d", n));
+        for ( int m = 0; m < 2; m++ )
+            tree->AppendItem(child, wxString::Format("grandchild %d.%d", n, m));
+
+        children.push_back(child);
+    }
+
+    // Return the number of the items not hidden by the collapsed ones after
+    // checking that they can be iterated over in both directions and that
+    // hit testing finds them at their positions.
+    const auto checkRows = [&tree]() -> size_t
+    {
+        std::vector<wxTreeItemId> rows;
+        for ( wxTreeItemId item = tree->GetRootItem();
+              item.IsOk();
+              item = tree->GetNextVisible(item) )
+        {
+            rows.push_back(item);
+        }
+
+        for ( size_t n = 0; n < rows.size(); n++ )
+        {
+            INFO("Row " << n << ": " << tree->GetItemText(rows[n]));
+
+            CHECK( tree->GetPrevVisible(rows[n]) ==
+                    (n ? rows[n - 1] : wxTreeItemId()) );
+
+            wxRect rect;
+            REQUIRE( tree->GetBoundingRect(rows[n], rect) );
+
+            int flags = 0;
+            CHECK( tree->HitTest(wxPoint(1, rect.y + rect.height / 2),
+                                 flags) == rows[n] );
+        }
+
+        return rows.size();
+    };
+
+    CHECK( checkRows() == 1 );
+
+    tree->Expand(root);
+    CHECK( checkRows() == 4 );
+
+    tree->Expand(children[1]);
+    CHECK( checkRows() == 6 );
+
+    tree->Collapse(root);
+    CHECK( checkRows() == 1 );
+
+    tree->Expand(root);
+    CHECK( checkRows() == 6 );
+
+    tree->Delete(tree->GetLastChild(children[1]));
+    CHECK( checkRows() == 5 );
+
+    tree->AppendItem(children[1], "new grandchild");
+    tree->Expand(children[2]);
+    CHECK( checkRows() == 8 );
+
+    tree->DeleteChildren(children[1]);
+    CHECK( checkRows() == 6 );
+
+    tree->Delete(children[0]);
+    CHECK( checkRows() == 5 );
+}
+
+// ----------------------------------------------------------------------------
+// virtual mode test
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Virtual tree control remembering how many times each label was requested.
+class VirtualTreeCtrl : public wxGenericTreeCtrl
+{
+public:
+    explicit VirtualTreeCtrl(wxWindow* parent)
+        : wxGenericTreeCtrl(parent, wxID_ANY,
+                            wxDefaultPosition, wxSize(400, 200),
+                            wxTR_DEFAULT_STYLE | wxTR_VIRTUAL)
+    {
+    }
+
+    wxTreeItemId AppendVirtualItem(const wxTreeItemId& parent,
+                                   const wxString& label)
+    {
+        const wxTreeItemId item = AppendItem(parent, wxString());
+        m_labels[item.GetID()] = label;
+        return item;
+    }
+
+    // Return the number of times the label of the item was requested since
+    // the last call to this function.
+    int GetAndResetRequests(const wxTreeItemId& item)
+    {
+        const int count = m_requests[item.GetID()];
+        m_requests[item.GetID()] = 0;
+        return count;
+    }
+
+protected:
+    wxString OnGetItemText(const wxTreeItemId& item) const override
+    {
+        m_requests[item.GetID()]++;
+
+        const auto it = m_labels.find(item.GetID());
+        return it != m_labels.end() ? it->second : wxString();
+    }
+
+private:
+    std::map<void*, wxString> m_labels;
+    mutable std::map<void*, int> m_requests;
+};
+
+} // anonymous namespace
+
+TEST_CASE("wxGenericTreeCtrl::Virtual", "[treectrl]")
+{
+    std::unique_ptr<VirtualTreeCtrl>
+        tree(new VirtualTreeCtrl(wxTheApp->GetTopWindow()));
+
+    // Use more items than the number of labels kept in memory.
+    const int count = 2000;
+
+    const wxTreeItemId root = tree->AddRoot(wxString());
+    std::vector<wxTreeItemId> items;
+    for ( int n = 0; n < count; n++ )
+        items.push_back(tree->AppendVirtualItem(root, wxString::Format("item %d", n)));
+
+    tree->Expand(root);
+
+    const wxTreeItemId& first = items.front();
+
+    CHECK( tree->GetItemText(first) == "item 0" );
+    CHECK( tree->GetAndResetRequests(first) == 1 );
+
+    // The label is cached now, so it shouldn't be requested again.
+    CHECK( tree->GetItemText(first) == "item 0" );
+    CHECK( tree->GetAndResetRequests(first) == 0 );
+
+    // Accessing all the other labels evicts the first one from the cache...
+    for ( int n = 1; n < count; n++ )
+        CHECK( tree->GetItemText(items[n]) == wxString::Format("item %d", n) );
+
+    // ... so it must be requested again when it's needed.
+    CHECK( tree->GetItemText(first) == "item 0" );
+    CHECK( tree->GetAndResetRequests(first) == 1 );
+
+    // Check that painting the item retrieves its label even if it had been
+    // already measured and so its size doesn't need to be computed again.
+    bool painted = false;
+    tree->Bind(wxEVT_PAINT, [&painted](wxPaintEvent& event)
+        {
+            painted = true;
+            event.Skip();
+        });
+
+    const auto repaint = [&tree, &painted]()
+    {
+        painted = false;
+        tree->Refresh();
+        tree->Update();
+
+        return WaitFor("tree repaint", [&painted]() { return painted; });
+    };
+
+    tree->ScrollTo(first);
+    if ( !repaint() )
+        return;
+
+    for ( int n = 1; n < count; n++ )
+        tree->GetItemText(items[n]);
+    tree->GetAndResetRequests(first);
+
+    if ( repaint() )
+        CHECK( tree->GetAndResetRequests(first) >= 1 );
+}
+
 #endif //wxUSE_TREECTRL
@@ -1852,6 +1852,143 @@ TEST_CASE("wxDateTime::DateOnly", "[datetime]")
     CHECK( wxDateTime::Now().GetDateOnly() == wxDateTime::Today() );
 }
 
+TEST_CASE("wxDateTimeFormatter", "[datetime]")
+{
+    static const char* const formats[] =
+    {
+        "%Y-%m-%d %H:%M:%S.%l",
+        "%F %T",
+        "%a %A %b %B %d %j %w",
+        "%I:%M %p",
+        "%y/%m/%d %%",
+        "%c, %x, %X",
+        "%5d|%-m|%3Y|%U|%V",
+        "no specs at all",
+        "trailing %",
+    };
+
+    static const wxDateTime dates[] =
+    {
+        wxDateTime(1, wxDateTime::Jan, 2000),
+        wxDateTime(29, wxDateTime::Feb, 2024, 12, 34, 56, 789),
+        wxDateTime(31, wxDateTime::Dec, 1999, 23, 59, 59, 999),
+        wxDateTime(7, wxDateTime::Jul, 1969, 0, 5, 9, 12),
+        wxDateTime(15, wxDateTime::Mar, 99, 13, 1, 2, 3),
+    };
+
+    for ( const char* format : formats )
+    {
+        const wxDateTimeFormatter formatter(format);
+
+        for ( const wxDateTime& dt : dates )
+        {
+            INFO("Format \"" << format << "\", date " << dt.FormatISOCombined());
+
+            for ( const wxDateTime::TimeZone& tz : { wxDateTime::TimeZone(wxDateTime::Local),
+                                                     wxDateTime::TimeZone(wxDateTime::UTC) } )
+            {
+                const wxString expected = dt.Format(format, tz);
+
+                CHECK( formatter.Format(dt, tz) == expected );
+
+                wxString s("prefix");
+                formatter.FormatTo(s, dt, tz);
+                CHECK( s == "prefix" + expected );
+
+                wxChar buf[256];
+                CHECK( formatter.Format(dt, buf, WXSIZEOF(buf), tz) == expected.length() );
+                CHECK( wxString(buf) == expected );
+
+                // check that truncation works as expected too
+                const size_t len = expected.length() / 2;
+                CHECK( formatter.Format(dt, buf, len + 1, tz) == expected.length() );
+                CHECK( wxString(buf) == expected.substr(0, len) );
+
+                CHECK( formatter.Format(dt, buf, 0, tz) == expected.length() );
+            }
+        }
+    }
+}
+
+TEST_CASE("wxDateTimeParser", "[datetime]")
+{
+    static const struct ParseTestData
+    {
+        const char* format;
+        const char* date;
+    } parseTestDates[] =
+    {
+        { "%Y-%m-%d %H:%M:%S",  "2011-05-23 12:34:56"   },
+        { "%Y-%m-%d %H:%M:%S",  "2011-05-23  12:34:56"  },
+        { "%Y-%m-%d %H:%M:%S",  "2011-05-23 24:34:56"   },
+        { "%Y-%m-%d %H:%M:%S",  "2011-02-30 12:34:56"   },
+        { "%Y-%m-%d %H:%M:%S",  "2011-05-23 12:34"      },
+        { "%F %T.%l",           "2024-02-29 01:02:03.456" },
+        { "%d/%m/%y",           "23/05/11"              },
+        { "%d/%m/%y",           "23/05/75"              },
+        { "%e.%m.%Y",           "1.1.2000"              },
+        { "%a %d %b %Y",        "Mon 23 May 2011"       },
+        { "%a %d %b %Y",        "Tue 23 May 2011"       },
+        { "%A, %B %d, %Y",      "monday, may 23, 2011"  },
+        { "%I:%M %p",           "12:30 AM"              },
+        { "%I:%M %p",           "12:30 PM"              },
+        { "%I:%M %p",           "1:30 pm"               },
+        { "%I:%M %p",           "13:30 PM"              },
+        { "%j %Y",              "366 2000"              },
+        { "%j %Y",              "366 2001"              },
+        { "%H%M%S",             "123456"                },
+        { "%4Y%2m",             "201105"                },
+        { "100%% %d",           "100% 23"               },
+        { "%Y-%m-%dT%H:%M:%S%z", "2011-05-23T12:34:56+02:00" },
+        { "%x",                 "05/23/11"              },
+    };
+
+    const wxDateTime dateDef(1, wxDateTime::Jan, 2020, 1, 2, 3);
+
+    for ( const auto& d : parseTestDates )
+    {
+        INFO("Parsing \"" << d.date << "\" using \"" << d.format << "\"");
+
+        const wxDateTimeParser parser(d.format);
+        const wxString date(d.date);
+
+        wxDateTime dtExpected;
+        wxString::const_iterator endExpected;
+        const bool
+            okExpected = dtExpected.ParseFormat(date, d.format, dateDef,
+                                                &endExpected);
+
+        wxDateTime dt;
+        wxString::const_iterator end;
+        REQUIRE( parser.Parse(date, dt, dateDef, &end) == okExpected );
+        if ( !okExpected )
+            continue;
+
+        CHECK( dt == dtExpected );
+        CHECK( end == endExpected );
+
+        wxDateTime dt2;
+        CHECK( parser.Parse(date, dt2, dateDef) == (end == date.end()) );
+    }
+
+    // check that the default format works as expected too
+    const wxDateTime dt(29, wxDateTime::Feb, 2024, 12, 34, 56);
+
+    wxDateTime dtParsed;
+    CHECK( wxDateTimeParser().Parse(dt.Format(), dtParsed) );
+    CHECK( dtParsed == dt );
+
+    // and that trailing characters are only accepted when asked for them
+    const wxDateTimeParser parser("%Y-%m-%d");
+    const wxString date("2024-02-29 and more");
+    CHECK_FALSE( parser.Parse(date, dtParsed) );
+
+    wxString::const_iterator end;
+    CHECK( parser.Parse(date, dtParsed, wxDefaultDateTime, &end) );
+    CHECK( dtParsed.GetDateOnly() == wxDateTime(29, wxDateTime::Feb, 2024) );
+    CHECK( wxString(end, date.end()) == " and more" );
+}
+
 TEST_CASE("wxDateTime::TranslateFromUnicodeFormat", "[datetime]")
 {
 #if defined(__WINDOWS__) || defined(__DARWIN__)
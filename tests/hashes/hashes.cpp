@@ -21,6 +21,7 @@
 #include "wx/hash.h"
 #include "wx/hashmap.h"
 #include "wx/hashset.h"
+#include "wx/flathashmap.h"
 
 #if defined wxLongLong_t && !defined wxLongLongIsLong
     #define TEST_LONGLONG
@@ -556,3 +557,159 @@ void HashesTestCase::wxHashSetTest()
     CPPUNIT_ASSERT( it->ptr == &dummy );
     CPPUNIT_ASSERT( it->str == wxT("ABC") );
 }
+
+// --------------------------------------------------------------------------
+// wxFlatHashMap and wxFlatHashSet
+// --------------------------------------------------------------------------
+
+WX_DECLARE_FLAT_HASH_MAP( int*, int*, wxPointerHash, wxPointerEqual,
+                          myFlatPtrHashMap );
+WX_DECLARE_FLAT_HASH_MAP( long, long, wxIntegerHash, wxIntegerEqual,
+                          myFlatLongHashMap );
+WX_DECLARE_FLAT_HASH_MAP( unsigned short, unsigned, wxIntegerHash,
+                          wxIntegerEqual, myFlatUShortHashMap );
+WX_DECLARE_FLAT_STRING_HASH_MAP( wxString, myFlatStringHashMap );
+
+WX_DECLARE_FLAT_HASH_SET( wxString, wxStringHash, wxStringEqual,
+                          myFlatStringHashSet );
+
+TEST_CASE("wxFlatHashMap::Basic", "[hashmap][flat]")
+{
+    HashMapTest<myFlatStringHashMap>();
+    HashMapTest<myFlatPtrHashMap>();
+    HashMapTest<myFlatLongHashMap>();
+    HashMapTest<myFlatUShortHashMap>();
+}
+
+TEST_CASE("wxFlatHashMap::API", "[hashmap][flat]")
+{
+    myFlatStringHashMap map;
+    CHECK( map.empty() );
+    CHECK( map.bucket_count() == 0 );
+    CHECK( map.find("none") == map.end() );
+    CHECK( map.begin() == map.end() );
+    CHECK_THROWS_AS( map.at("none"), std::out_of_range );
+
+    map["one"] = "1";
+    CHECK( map.insert(std::make_pair(wxString("two"), wxString("2"))).second );
+    CHECK( !map.insert(std::make_pair(wxString("one"), wxString("0"))).second );
+    CHECK( map.emplace("three", "3").second );
+
+    CHECK( map.size() == 3 );
+    CHECK( map.count("two") == 1 );
+    CHECK( map.contains("three") );
+    CHECK( !map.contains("four") );
+    CHECK( map.at("one") == "1" );
+    CHECK_THROWS_AS( map.at("four"), std::out_of_range );
+
+    const myFlatStringHashMap& cmap = map;
+    CHECK( cmap.at("three") == "3" );
+    CHECK_THROWS_AS( cmap.at("four"), std::out_of_range );
+
+    myFlatStringHashMap::const_iterator it = cmap.find("two");
+    REQUIRE( it != cmap.end() );
+    CHECK( it->second == "2" );
+
+    myFlatStringHashMap moved(std::move(map));
+    CHECK( moved.size() == 3 );
+    CHECK( map.empty() );
+
+    map = moved;
+    CHECK( map.size() == 3 );
+
+    map.clear();
+    CHECK( map.empty() );
+    CHECK( map.find("one") == map.end() );
+
+    map["four"] = "4";
+    CHECK( map.size() == 1 );
+}
+
+TEST_CASE("wxFlatHashMap::EraseWhileIterating", "[hashmap][flat]")
+{
+    myFlatLongHashMap map;
+    for ( long n = 0; n < 1000; n++ )
+        map[n] = n;
+
+    for ( myFlatLongHashMap::iterator it = map.begin(); it != map.end(); )
+    {
+        if ( it->first % 3 == 0 )
+            it = map.erase(it);
+        else
+            ++it;
+    }
+
+    CHECK( map.size() == 666 );
+
+    size_t count = 0;
+    for ( myFlatLongHashMap::const_iterator it = map.begin();
+          it != map.end();
+          ++it )
+    {
+        CHECK( it->first % 3 != 0 );
+        CHECK( it->second == it->first );
+        count++;
+    }
+
+    CHECK( count == map.size() );
+}
+
+namespace
+{
+
+// Hash function which is as bad as possible.
+struct ConstantHash
+{
+    size_t operator()(long) const { return 17; }
+};
+
+} // anonymous namespace
+
+WX_DECLARE_FLAT_HASH_MAP( long, wxString, ConstantHash, wxIntegerEqual,
+                          myFlatBadHashMap );
+
+TEST_CASE("wxFlatHashMap::BadHash", "[hashmap][flat]")
+{
+    myFlatBadHashMap map;
+    for ( long n = 0; n < 500; n++ )
+        map[n] = wxString::Format("%ld", n);
+
+    CHECK( map.size() == 500 );
+
+    for ( long n = 0; n < 500; n += 2 )
+        CHECK( map.erase(n) == 1 );
+
+    CHECK( map.size() == 250 );
+
+    for ( long n = 0; n < 500; n++ )
+    {
+        INFO("n=" << n);
+        if ( n % 2 )
+            CHECK( map.at(n) == wxString::Format("%ld", n) );
+        else
+            CHECK( map.find(n) == map.end() );
+    }
+}
+
+TEST_CASE("wxFlatHashSet", "[hashset][flat]")
+{
+    myFlatStringHashSet set;
+
+    set.insert("abc");
+    set.insert("bbc");
+    set.insert("cbc");
+    set.insert("abc");
+
+    CHECK( set.size() == 3 );
+    CHECK( set.count("bbc") == 1 );
+    CHECK( set.count("xyz") == 0 );
+
+    CHECK( set.erase("bbc") == 1 );
+    CHECK( set.erase("bbc") == 0 );
+    CHECK( set.size() == 2 );
+
+    myFlatStringHashSet copy(set);
+    CHECK( copy.size() == 2 );
+    CHECK( copy.count("abc") == 1 );
+    CHECK( copy.count("cbc") == 1 );
+}
@@ -332,6 +332,181 @@ TEST_CASE("wxTranslations::CorruptCatalog", "[translations]")
     delete cat;
 }
 
+// Build a catalog with a hash table in the .mo format from the given original
+// strings and their translations.
+static std::string
+MakeCatalog(const std::vector<std::pair<std::string, std::string>>& entries)
+{
+    // Use the same hash function as GNU gettext.
+    auto hashString = [](const std::string& str)
+    {
+        wxUint64 hval = 0;
+        for ( const char c : str )
+        {
+            if ( !c )
+                break;
+
+            hval <<= 4;
+            hval += static_cast<unsigned char>(c);
+
+            const wxUint64 g = hval & (~static_cast<wxUint64>(0) << 28);
+            if ( g )
+            {
+                hval ^= g >> 24;
+                hval ^= g;
+            }
+        }
+        return hval;
+    };
+
+    const wxUint32 count = entries.size();
+    const wxUint32 hashSize = 13;
+    REQUIRE( count < hashSize );
+
+    const wxUint32 ofsOrig = 28;
+    const wxUint32 ofsTrans = ofsOrig + 8*count;
+    const wxUint32 ofsHash = ofsTrans + 8*count;
+
+    std::string mo(ofsHash + 4*hashSize, '\0');
+
+    auto put32 = [&mo](wxUint32 ofs, wxUint32 v)
+    {
+        for ( int n = 0; n < 4; n++, v >>= 8 )
+            mo[ofs + n] = static_cast<char>(v & 0xff);
+    };
+
+    put32( 0, 0x950412de);
+    put32( 8, count);
+    put32(12, ofsOrig);
+    put32(16, ofsTrans);
+    put32(20, hashSize);
+    put32(24, ofsHash);
+
+    for ( wxUint32 n = 0; n < count; n++ )
+    {
+        const std::string& orig = entries[n].first;
+        put32(ofsOrig + 8*n, orig.length());
+        put32(ofsOrig + 8*n + 4, mo.length());
+        mo.append(orig).append(1, '\0');
+
+        const std::string& trans = entries[n].second;
+        put32(ofsTrans + 8*n, trans.length());
+        put32(ofsTrans + 8*n + 4, mo.length());
+        mo.append(trans).append(1, '\0');
+
+        const wxUint64 hval = hashString(orig);
+        wxUint32 idx = hval % hashSize;
+        const wxUint32 incr = 1 + hval % (hashSize - 2);
+        while ( mo[ofsHash + 4*idx] )
+            idx = (idx + incr) % hashSize;
+        put32(ofsHash + 4*idx, n + 1);
+    }
+
+    return mo;
+}
+
+TEST_CASE("wxTranslations::Lookup", "[translations]")
+{
+    const std::string mo = MakeCatalog(
+    {
+        { "", "Content-Type: text/plain; charset=UTF-8\n"
+              "Plural-Forms: nplurals=2; plural=(n != 1);\n" },
+        { "Hello", "Bonjour" },
+        { "ctx\x04Open", "Ouvrir" },
+        { std::string("file\0files", 10), std::string("fichier\0fichiers", 16) },
+        { "Untranslated", "" },
+        { "Caf\xc3\xa9", "Bistro" },
+    });
+
+    wxCharTypeBuffer<char> data(mo.data(), mo.length());
+    std::unique_ptr<wxMsgCatalog> cat(wxMsgCatalog::CreateFromData(data, "test"));
+    REQUIRE( cat );
+
+    const wxString* s = cat->GetString("Hello");
+    REQUIRE( s );
+    CHECK( *s == "Bonjour" );
+
+    // The same string must be returned when it is found again.
+    CHECK( cat->GetString("Hello") == s );
+
+    CHECK( !cat->GetString("Open") );
+    s = cat->GetString("Open", UINT_MAX, "ctx");
+    REQUIRE( s );
+    CHECK( *s == "Ouvrir" );
+
+    s = cat->GetString("file", 1);
+    REQUIRE( s );
+    CHECK( *s == "fichier" );
+    s = cat->GetString("file", 2);
+    REQUIRE( s );
+    CHECK( *s == "fichiers" );
+
+    s = cat->GetString(wxString::FromUTF8("Caf\xc3\xa9"));
+    REQUIRE( s );
+    CHECK( *s == "Bistro" );
+
+    CHECK( !cat->GetString("Untranslated") );
+    CHECK( !cat->GetString("Missing") );
+    CHECK( !cat->GetString("Missing") );
+
+    s = cat->GetString(wxString());
+    REQUIRE( s );
+    CHECK( s->StartsWith("Content-Type") );
+
+    // Non-owned data doesn't need to remain valid after creating the catalog.
+    {
+        std::string temp(mo);
+        cat.reset(wxMsgCatalog::CreateFromData(
+                    wxScopedCharBuffer::CreateNonOwned(temp.data(), temp.length()),
+                    "test"));
+        std::fill(temp.begin(), temp.end(), '\0');
+    }
+    REQUIRE( cat );
+
+    s = cat->GetString("Hello");
+    REQUIRE( s );
+    CHECK( *s == "Bonjour" );
+
+    // Check that catalogs created by msgfmt can be used too.
+    cat.reset(wxMsgCatalog::CreateFromFile("intl/fr/internat.mo", "internat"));
+    REQUIRE( cat );
+
+    s = cat->GetString("&Open bogus file");
+    REQUIRE( s );
+    CHECK( *s == "&Ouvrir un fichier" );
+
+    s = cat->GetString("Enter your number:");
+    REQUIRE( s );
+    CHECK( *s == wxString::FromUTF8("Entrez votre num\xc3\xa9ro:") );
+
+    CHECK( !cat->GetString("Missing") );
+}
+
+TEST_CASE("wxTranslations::Cached", "[translations]")
+{
+    wxFileTranslationsLoader::AddCatalogLookupPathPrefix("./intl");
+
+    // Use a function to check that the same call site is reused every time.
+    const auto translate = []() -> const wxString&
+    {
+        return wxGETTEXT_CACHED("&Open bogus file");
+    };
+
+    wxTranslations* const trans = new wxTranslations;
+    wxTranslations::Set(trans);
+    wxON_BLOCK_EXIT1( wxTranslations::Set, nullptr );
+
+    CHECK( translate() == "&Open bogus file" );
+
+    trans->SetLanguage(wxLANGUAGE_FRENCH);
+    REQUIRE( trans->AddAvailableCatalog("internat") );
+    CHECK( translate() == "&Ouvrir un fichier" );
+    CHECK( &translate() == &translate() );
+
+    wxTranslations::Set(nullptr);
+    CHECK( translate() == "&Open bogus file" );
+}
+
 TEST_CASE("wxTranslations::GetBestTranslation", "[translations]")
 {
     wxFileTranslationsLoader::AddCatalogLookupPathPrefix("./intl");
@@ -569,6 +744,60 @@ TEST_CASE("wxUILocale::CompareStrings", "[uilocale]")
     }
 }
 
+// There is no native support for generating the sort keys under macOS, so
+// they don't order the strings as CompareStrings() does there, even for the
+// current locale.
+#ifndef __DARWIN__
+
+// Check that sort keys order the strings in the same way as CompareStrings().
+static void CheckSortKeys(const wxUILocale& l, int flags)
+{
+    const wxString strings[] =
+    {
+        "", "a", "A", "ab", "aB", "ae", u8("ä"), "b", "B", "ss", u8("ß"),
+        "z", u8("ö"), "1", "10", "2", " ", "-", wxString("a\0b", 3),
+    };
+
+    for ( const wxString& s1 : strings )
+    {
+        const std::string key1 = l.GetSortKey(s1, flags);
+        for ( const wxString& s2 : strings )
+        {
+            INFO("Comparing \"" << s1 << "\" and \"" << s2 << "\"");
+
+            const int rc = key1.compare(l.GetSortKey(s2, flags));
+            CHECK( (rc > 0) - (rc < 0) == l.CompareStrings(s1, s2, flags) );
+        }
+    }
+}
+
+TEST_CASE("wxUILocale::GetSortKey", "[uilocale]")
+{
+    SECTION("Current")
+    {
+        const wxUILocale& l = wxUILocale::GetCurrent();
+
+        CheckSortKeys(l, wxCompare_CaseSensitive);
+        CheckSortKeys(l, wxCompare_CaseInsensitive);
+    }
+
+    SECTION("Other")
+    {
+        const char* const tags[] = { "en", "de-DE", "sv" };
+        for ( const char* tag : tags )
+        {
+            const wxUILocale l(wxUILocale::FromTag(tag));
+            if ( !CheckSupported(l, tag) )
+                continue;
+
+            CheckSortKeys(l, wxCompare_CaseSensitive);
+            CheckSortKeys(l, wxCompare_CaseInsensitive);
+        }
+    }
+}
+
+#endif // !__DARWIN__
+
 // Small helper for making the test below more concise.
 static void CheckTag(const wxString& tag)
 {
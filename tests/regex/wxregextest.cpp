@@ -134,6 +134,112 @@ TEST_CASE("wxRegEx::Match", "[regex][match]")
         "Fri Jul 13 18:37:52 CEST 2001\tFri\tJul\t13\t2001");
 }
 
+TEST_CASE("wxRegEx::MatchData", "[regex][match]")
+{
+    wxRegEx re("([[:alpha:]]+)(-([[:digit:]]+))?");
+    REQUIRE( re.IsValid() );
+
+    wxRegExMatch match;
+    CHECK( match.GetCount() == 0 );
+
+    const wxString text("12 abc-34 def");
+    REQUIRE( re.Matches(text, match) );
+    REQUIRE( match.GetCount() == 4 );
+
+    size_t start, len;
+    REQUIRE( match.Get(&start, &len) );
+    CHECK( text.Mid(start, len) == "abc-34" );
+    REQUIRE( match.Get(&start, &len, 3) );
+    CHECK( text.Mid(start, len) == "34" );
+    CHECK_FALSE( match.Get(&start, &len, 4) );
+
+    // Matching the range, which must give offsets relative to its start, and
+    // reusing the same match object should work too.
+    const wxStringCharType* const p = text.wx_str();
+    const wxStringCharType* const end = p + text.length();
+    REQUIRE( re.Matches(p + 9, end, match) );
+    REQUIRE( match.Get(&start, &len) );
+    CHECK( start == 1 );
+    CHECK( len == 3 );
+
+    // The optional group didn't match anything.
+    CHECK_FALSE( match.Get(&start, &len, 3) );
+
+    CHECK_FALSE( re.Matches(p, p + 3, match) );
+    CHECK( match.GetCount() == 0 );
+
+    // This must not affect the results stored in wxRegEx itself.
+    REQUIRE( re.Matches("xyz") );
+    CHECK( re.Matches(text, match) );
+    CHECK( re.GetMatch("xyz") == "xyz" );
+}
+
+TEST_CASE("wxRegEx::JIT", "[regex][jit]")
+{
+    // JIT compilation may be unavailable, but this must still work.
+    wxRegEx re("<td>([^<]*)</td>", wxRE_ICASE | wxRE_JIT);
+    REQUIRE( re.IsValid() );
+
+    REQUIRE( re.Matches("<TR><TD>foo</TD></TR>") );
+    CHECK( re.GetMatch("<TR><TD>foo</TD></TR>", 1) == "foo" );
+
+    wxString text("<td>1</td><td>2</td>");
+    CHECK( re.Replace(&text, "[\\1]") == 2 );
+    CHECK( text == "[1][2]" );
+}
+
+TEST_CASE("wxRegExSet", "[regex][set]")
+{
+    wxRegExSet set;
+    CHECK( set.Add("foo([[:digit:]]+)") == 0 );
+    CHECK( set.Add("***=a+b", wxRE_ICASE) == 1 );
+    CHECK( set.Add("\\bbar") == 2 );
+    CHECK( set.Add("^x.*y$", wxRE_NEWLINE) == 3 );
+    CHECK( set.GetCount() == 4 );
+
+    // Invalid patterns and patterns with back references are not added.
+    {
+        wxLogNull noLog;
+        CHECK( set.Add("foo(") == wxNOT_FOUND );
+        CHECK( set.Add("(a)\\1") == wxNOT_FOUND );
+    }
+    CHECK( set.GetCount() == 4 );
+
+    REQUIRE( set.Compile(wxRE_JIT) );
+
+    const wxString text("zbar A+B foo12 bar\nxyz\nxy");
+
+    wxRegExMatch match;
+    REQUIRE( set.Matches(text, match) == 1 );
+
+    size_t start, len;
+    REQUIRE( set.GetMatch(match, 1, &start, &len) );
+    CHECK( text.Mid(start, len) == "A+B" );
+
+    wxVector<wxRegExSet::Match> matches;
+    REQUIRE( set.FindAll(text, matches) == 4 );
+
+    CHECK( matches[0].pattern == 1 );
+    CHECK( matches[1].pattern == 0 );
+    CHECK( text.Mid(matches[1].start, matches[1].len) == "foo12" );
+    CHECK( matches[2].pattern == 2 );
+    CHECK( matches[2].start == 15 );
+    CHECK( matches[3].pattern == 3 );
+    CHECK( text.Mid(matches[3].start, matches[3].len) == "xy" );
+
+    // Check that subexpressions of the patterns can be retrieved too.
+    REQUIRE( set.Matches(text.wx_str() + 9, text.wx_str() + 14, match) == 0 );
+    REQUIRE( set.GetMatch(match, 0, &start, &len, 1) );
+    CHECK( start == 3 );
+    CHECK( len == 2 );
+
+    // Adding a new pattern requires compiling the set again.
+    CHECK( set.Add("baz") == 4 );
+    CHECK_FALSE( set.IsValid() );
+    REQUIRE( set.Compile() );
+    CHECK( set.Matches("foo baz", match) == 4 );
+}
+
 static void
 CheckReplace(const char* pattern,
              const char* original,
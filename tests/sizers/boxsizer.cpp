@@ -17,6 +17,7 @@
     #include "wx/app.h"
     #include "wx/sizer.h"
     #include "wx/listbox.h"
+    #include "wx/stattext.h"
 #endif // WX_PRECOMP
 
 #include "asserthelper.h"
@@ -286,6 +287,77 @@ TEST_CASE_METHOD(BoxSizerTestCase, "BoxSizer::SetMinSize", "[sizer]")
     CHECK(m_sizer->GetMinSize().x == 100);
 }
 
+TEST_CASE_METHOD(BoxSizerTestCase, "BoxSizer::Nested", "[sizer]")
+{
+    wxBoxSizer* const inner = new wxBoxSizer(wxVERTICAL);
+    wxWindow* const child1 = new wxWindow(m_win, wxID_ANY);
+    child1->SetInitialSize(wxSize(20, 10));
+    inner->Add(child1);
+    wxWindow* const child2 = new wxWindow(m_win, wxID_ANY);
+    child2->SetInitialSize(wxSize(30, 10));
+    inner->Add(child2);
+
+    wxWindow* const child3 = new wxWindow(m_win, wxID_ANY);
+    child3->SetInitialSize(wxSize(10, 10));
+    m_sizer->Add(inner);
+    m_sizer->Add(child3);
+
+    m_win->Layout();
+    CHECK( child2->GetPosition() == wxPoint(0, 10) );
+    CHECK( child3->GetPosition() == wxPoint(30, 0) );
+
+    // Changing the size of an item of the nested sizer must be taken into
+    // account by the next layout of both sizers.
+    child2->SetInitialSize(wxSize(40, 15));
+    m_win->Layout();
+    CHECK( inner->GetSize() == wxSize(40, 25) );
+    CHECK( child3->GetPosition() == wxPoint(40, 0) );
+
+    // And so must be changing the nested sizer minimal size directly.
+    inner->SetMinSize(50, 0);
+    m_win->Layout();
+    CHECK( inner->GetSize() == wxSize(50, 25) );
+    CHECK( child3->GetPosition() == wxPoint(50, 0) );
+}
+
+#if wxUSE_STATTEXT
+TEST_CASE_METHOD(BoxSizerTestCase, "BoxSizer::ChangeInNestedLayout", "[sizer]")
+{
+    // Create a child window with its own sizer whose contents changes when
+    // it's resized by the layout of its parent, as it often happens with
+    // wxStaticText::Wrap(), and check that the child layout uses the new
+    // minimal size of its contents and not the one computed before.
+    wxWindow* const child = new wxWindow(m_win, wxID_ANY);
+    wxStaticText* const text = new wxStaticText(child, wxID_ANY, "x");
+
+    wxBoxSizer* const childSizer = new wxBoxSizer(wxVERTICAL);
+    wxBoxSizer* const inner = new wxBoxSizer(wxHORIZONTAL);
+    inner->Add(text);
+    childSizer->Add(inner);
+    child->SetSizer(childSizer);
+
+    m_sizer->Add(child, wxSizerFlags(1).Expand());
+
+    bool changed = false;
+    child->Bind(wxEVT_SIZE, [&](wxSizeEvent&)
+    {
+        if ( !changed )
+        {
+            changed = true;
+            text->SetLabel("Much longer text");
+        }
+
+        // Don't skip the event to avoid the default handler laying out the
+        // window again and hiding the problem.
+        child->Layout();
+    });
+
+    m_win->Layout();
+    CHECK( changed );
+    CHECK( text->GetSize() == text->GetBestSize() );
+}
+#endif // wxUSE_STATTEXT
+
 #if wxUSE_LISTBOX
 TEST_CASE_METHOD(BoxSizerTestCase, "BoxSizer::BestSizeRespectsMaxSize", "[sizer]")
 {
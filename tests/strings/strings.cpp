@@ -94,6 +94,47 @@ TEST_CASE("StringFormat", "[wxString]")
     CHECK( wxString::Format("%1$o %1$d %1$x", 20) == "24 20 14" );
 }
 
+TEST_CASE("StringFormatSameBuffer", "[wxString]")
+{
+    // Check that reusing the same buffer for different format strings works,
+    // i.e. that nothing is cached just based on the format string pointer.
+    char fmt[32];
+
+    strcpy(fmt, "%d apples");
+    CHECK( wxString::Format(fmt, 3) == "3 apples" );
+    CHECK( wxString::Format(fmt, 4) == "4 apples" );
+
+    strcpy(fmt, "%s pears");
+    CHECK( wxString::Format(fmt, "five") == "five pears" );
+
+    strcpy(fmt, "%d %s");
+    CHECK( wxString::Format(fmt, 6, "plums") == "6 plums" );
+
+    wchar_t wfmt[32];
+
+    wcscpy(wfmt, L"%c%c");
+    CHECK( wxString::Format(wfmt, 'o', 'k') == "ok" );
+
+    wcscpy(wfmt, L"%.1f");
+    CHECK( wxString::Format(wfmt, 1.25) == "1.2" );
+
+    // The same applies to wxString used as format.
+    wxString sfmt("%d");
+    CHECK( wxString::Format(sfmt, 7) == "7" );
+    sfmt = "%s";
+    CHECK( wxString::Format(sfmt, "eight") == "eight" );
+
+    // And to formatting into a fixed size buffer.
+    wchar_t buf[16];
+    strcpy(fmt, "%d-%d");
+    CHECK( wxSnprintf(buf, WXSIZEOF(buf), fmt, 1, 2) == 3 );
+    CHECK( wxString(buf) == "1-2" );
+
+    strcpy(fmt, "%s");
+    CHECK( wxSnprintf(buf, WXSIZEOF(buf), fmt, "nine") == 4 );
+    CHECK( wxString(buf) == "nine" );
+}
+
 TEST_CASE("StringFormatUnicode", "[wxString]")
 {
     // For some completely mysterious reason, the test below sometimes crashes